@@ -1143,6 +1143,8 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&);
   };
 
+  class ConsumeCodeCacheTask;
+
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
@@ -1179,6 +1181,10 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+
+    // The task consuming cached_data in the background, if any (see
+    // StartConsumingCodeCache). Not owned.
+    ConsumeCodeCacheTask* consume_cache_task;
   };
 
   /**
@@ -1265,6 +1271,16 @@ class V8_EXPORT ScriptCompiler {
     virtual void Run() = 0;
   };
 
+  /**
+   * A task which the embedder can run on a background thread to prepare cached
+   * data for consumption. Returned by ScriptCompiler::StartConsumingCodeCache.
+   */
+  class ConsumeCodeCacheTask {
+   public:
+    virtual ~ConsumeCodeCacheTask() {}
+    virtual void Run() = 0;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kProduceParserCache,
@@ -1328,6 +1344,22 @@ class V8_EXPORT ScriptCompiler {
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
 
+  /**
+   * Returns a task which verifies the checksum of the cached data of the
+   * source, and copies the data if it is not pointer-aligned. Deserializing
+   * the data, which allocates the compiled code on the heap, is still done on
+   * the main thread when the source is compiled with kConsumeCodeCache.
+   *
+   * The user is responsible for running the task on a background thread and
+   * deleting it after the source has been compiled. The checks done by the
+   * task are only used if ConsumeCodeCacheTask::Run has returned before the
+   * source is compiled; otherwise they are repeated on the main thread. The
+   * task must not be deleted while it runs, and the source and its cached
+   * data must be kept alive until the task has returned.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(Isolate* isolate,
+                                                       Source* source);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -5248,6 +5280,29 @@ class V8_EXPORT HeapObjectStatistics {
 };
 
 
+/**
+ * Execution statistics of the interpreter's handler for a single bytecode.
+ * The cycle counts are estimates from samples; they include the dispatch to
+ * the next handler and any calls made by the handler.
+ */
+class V8_EXPORT BytecodeHandlerStatistics {
+ public:
+  BytecodeHandlerStatistics();
+  const char* bytecode_name() { return bytecode_name_; }
+  size_t execution_count() { return execution_count_; }
+  size_t sample_count() { return sample_count_; }
+  uint64_t sampled_cycles() { return sampled_cycles_; }
+
+ private:
+  const char* bytecode_name_;
+  size_t execution_count_;
+  size_t sample_count_;
+  uint64_t sampled_cycles_;
+
+  friend class Isolate;
+};
+
+
 class RetainedObjectInfo;
 
 
@@ -5752,6 +5807,41 @@ class V8_EXPORT Isolate {
   bool GetHeapObjectStatisticsAtLastGC(HeapObjectStatistics* object_statistics,
                                        size_t type_index);
 
+  /**
+   * Starts collecting statistics about the interpreter's bytecode handlers.
+   * Statistics are only collected if the handlers were instrumented with
+   * --ignition-handler-statistics.
+   */
+  void StartBytecodeHandlerStatistics();
+
+  /**
+   * Stops collecting bytecode handler statistics. The statistics collected so
+   * far are kept.
+   */
+  void StopBytecodeHandlerStatistics();
+
+  /**
+   * Clears the bytecode handler statistics collected so far.
+   */
+  void ResetBytecodeHandlerStatistics();
+
+  /**
+   * Returns the number of bytecodes the interpreter has handlers for.
+   */
+  size_t NumberOfBytecodeHandlers();
+
+  /**
+   * Get the statistics collected for a bytecode handler.
+   *
+   * \param handler_statistics The BytecodeHandlerStatistics object to fill in.
+   * \param index The index of the bytecode, which ranges from 0 to
+   *   NumberOfBytecodeHandlers() - 1.
+   * \returns true on success, false if the index is out of range or the
+   *   handlers are not instrumented.
+   */
+  bool GetBytecodeHandlerStatistics(
+      BytecodeHandlerStatistics* handler_statistics, size_t index);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -7913,12 +8003,13 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       resource_column_offset(origin.ResourceColumnOffset()),
       resource_options(origin.Options()),
       source_map_url(origin.SourceMapUrl()),
-      cached_data(data) {}
+      cached_data(data),
+      consume_cache_task(NULL) {}
 
 
 ScriptCompiler::Source::Source(Local<String> string,
                                CachedData* data)
-    : source_string(string), cached_data(data) {}
+    : source_string(string), cached_data(data), consume_cache_task(NULL) {}
 
 
 ScriptCompiler::Source::~Source() {
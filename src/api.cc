@@ -38,6 +38,7 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/icu_util.h"
+#include "src/interpreter/interpreter.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
 #include "src/messages.h"
@@ -56,6 +57,7 @@
 #include "src/runtime-profiler.h"
 #include "src/runtime/runtime.h"
 #include "src/simulator.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/snapshot.h"
 #include "src/startup-data-util.h"
@@ -1830,9 +1832,16 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   i::ScriptData* script_data = NULL;
   if (options == kConsumeParserCache || options == kConsumeCodeCache) {
     DCHECK(source->cached_data);
-    // ScriptData takes care of pointer-aligning the data.
-    script_data = new i::ScriptData(source->cached_data->data,
-                                    source->cached_data->length);
+    if (source->consume_cache_task != NULL) {
+      // The data has been prepared on a background thread.
+      script_data = static_cast<i::BackgroundCodeCacheTask*>(
+                        source->consume_cache_task)->ReleaseScriptData();
+    }
+    if (script_data == NULL) {
+      // ScriptData takes care of pointer-aligning the data.
+      script_data = new i::ScriptData(source->cached_data->data,
+                                      source->cached_data->length);
+    }
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -2089,6 +2098,17 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
 }
 
 
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    Isolate* v8_isolate, Source* source) {
+  DCHECK(source->cached_data);
+  DCHECK_NULL(source->consume_cache_task);
+  ConsumeCodeCacheTask* task = new i::BackgroundCodeCacheTask(
+      source->cached_data->data, source->cached_data->length);
+  source->consume_cache_task = task;
+  return task;
+}
+
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
                                            Local<String> full_source_string,
@@ -5518,6 +5538,13 @@ HeapObjectStatistics::HeapObjectStatistics()
       object_size_(0) {}
 
 
+BytecodeHandlerStatistics::BytecodeHandlerStatistics()
+    : bytecode_name_(nullptr),
+      execution_count_(0),
+      sample_count_(0),
+      sampled_cycles_(0) {}
+
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -7471,6 +7498,49 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
 }
 
 
+void Isolate::StartBytecodeHandlerStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->interpreter()->StartHandlerStatistics();
+}
+
+
+void Isolate::StopBytecodeHandlerStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->interpreter()->StopHandlerStatistics();
+}
+
+
+void Isolate::ResetBytecodeHandlerStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->interpreter()->ResetHandlerStatistics();
+}
+
+
+size_t Isolate::NumberOfBytecodeHandlers() {
+  return i::interpreter::HandlerStatistics::kNumberOfBytecodes;
+}
+
+
+bool Isolate::GetBytecodeHandlerStatistics(
+    BytecodeHandlerStatistics* handler_statistics, size_t index) {
+  if (!handler_statistics) return false;
+  if (!i::FLAG_ignition_handler_statistics) return false;
+  if (index >= NumberOfBytecodeHandlers()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  const i::interpreter::HandlerStatistics& statistics =
+      isolate->interpreter()->handler_statistics();
+  i::interpreter::Bytecode bytecode =
+      i::interpreter::Bytecodes::FromByte(static_cast<uint8_t>(index));
+  handler_statistics->bytecode_name_ =
+      i::interpreter::Bytecodes::ToString(bytecode);
+  handler_statistics->execution_count_ = statistics.execution_counts[index];
+  handler_statistics->sample_count_ = statistics.sample_counts[index];
+  handler_statistics->sampled_cycles_ = statistics.sampled_cycles[index];
+  return true;
+}
+
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
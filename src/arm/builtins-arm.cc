@@ -1011,6 +1011,11 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ Assert(eq, kFunctionDataShouldBeBytecodeArrayOnInterpreterEntry);
   }
 
+  // Reset code age.
+  __ mov(r9, Operand(BytecodeArray::kNoAgeBytecodeAge));
+  __ strb(r9, FieldMemOperand(kInterpreterBytecodeArrayRegister,
+                              BytecodeArray::kBytecodeAgeOffset));
+
   // Push new.target, bytecode array and zero for bytecode array offset.
   __ mov(r0, Operand(0));
   __ Push(r3, kInterpreterBytecodeArrayRegister, r0);
@@ -1050,6 +1055,13 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   __ add(r4, fp, Operand(InterpreterFrameConstants::kRegisterFileFromFp));
   __ mov(kInterpreterBytecodeOffsetRegister,
          Operand(BytecodeArray::kHeaderSize - kHeapObjectTag));
+
+  // Dispatch through the threaded code if the function is hot enough to have
+  // some.
+  Label threaded_dispatch;
+  __ ldr(r1, FieldMemOperand(kInterpreterBytecodeArrayRegister,
+                             BytecodeArray::kThreadedCodeOffset));
+  __ JumpIfNotRoot(r1, Heap::kUndefinedValueRootIndex, &threaded_dispatch);
   __ mov(kInterpreterDispatchTableRegister,
          Operand(ExternalReference::interpreter_dispatch_table_address(
              masm->isolate())));
@@ -1064,6 +1076,18 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   // Even though the first bytecode handler was called, we will never return.
   __ Abort(kUnexpectedReturnFromBytecodeHandler);
 
+  // The threaded code holds the handler for each bytecode offset. The dispatch
+  // table register points into it such that it is indexed by bytecode offset.
+  __ bind(&threaded_dispatch);
+  __ add(kInterpreterDispatchTableRegister, r1,
+         Operand(BytecodeArray::kThreadedDispatchTableBias));
+  __ ldr(ip, MemOperand(kInterpreterDispatchTableRegister,
+                        kInterpreterBytecodeOffsetRegister, LSL,
+                        kPointerSizeLog2));
+  __ add(ip, ip, Operand(Code::kHeaderSize - kHeapObjectTag));
+  __ Call(ip);
+  __ Abort(kUnexpectedReturnFromBytecodeHandler);
+
   // If the bytecode array is no longer present, then the underlying function
   // has been switched to a different kind of code and we heal the closure by
   // switching the code entry field over to the new code object as well.
@@ -1658,9 +1682,15 @@ void Builtins::Generate_HandleFastApiCall(MacroAssembler* masm) {
 }
 
 
-void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
+static void Generate_OnStackReplacementHelper(MacroAssembler* masm,
+                                              bool has_handler_frame) {
   // Lookup the function in the JavaScript frame.
-  __ ldr(r0, MemOperand(fp, JavaScriptFrameConstants::kFunctionOffset));
+  if (has_handler_frame) {
+    __ ldr(r0, MemOperand(fp, StandardFrameConstants::kCallerFPOffset));
+    __ ldr(r0, MemOperand(r0, JavaScriptFrameConstants::kFunctionOffset));
+  } else {
+    __ ldr(r0, MemOperand(fp, JavaScriptFrameConstants::kFunctionOffset));
+  }
   {
     FrameAndConstantPoolScope scope(masm, StackFrame::INTERNAL);
     // Pass function as argument.
@@ -1676,6 +1706,12 @@ void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
 
   __ bind(&skip);
 
+  // Drop the handler frame that is sitting on top of the actual JavaScript
+  // frame. This is the case when OSR is triggered from bytecode.
+  if (has_handler_frame) {
+    __ LeaveFrame(StackFrame::STUB);
+  }
+
   // Load deoptimization data from the code object.
   // <deopt_data> = <code>[#deoptimization_data_offset]
   __ ldr(r1, FieldMemOperand(r0, Code::kDeoptimizationDataOffset));
@@ -1700,6 +1736,14 @@ void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
   }
 }
 
+void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
+  Generate_OnStackReplacementHelper(masm, false);
+}
+
+void Builtins::Generate_InterpreterOnStackReplacement(MacroAssembler* masm) {
+  Generate_OnStackReplacementHelper(masm, true);
+}
+
 
 // static
 void Builtins::Generate_DatePrototype_GetField(MacroAssembler* masm,
@@ -1081,6 +1081,20 @@ ExternalReference ExternalReference::interpreter_dispatch_counters(
       isolate->interpreter()->bytecode_dispatch_counters_table());
 }
 
+ExternalReference ExternalReference::interpreter_handler_statistics(
+    Isolate* isolate) {
+  return ExternalReference(
+      isolate->interpreter()->handler_statistics_address());
+}
+
+ExternalReference
+ExternalReference::interpreter_sample_bytecode_handler_function(
+    Isolate* isolate) {
+  return ExternalReference(Redirect(
+      isolate,
+      FUNCTION_ADDR(interpreter::Interpreter::SampleBytecodeHandler)));
+}
+
 ExternalReference::ExternalReference(StatsCounter* counter)
   : address_(reinterpret_cast<Address>(counter->GetInternalPointer())) {}
 
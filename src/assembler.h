@@ -918,6 +918,9 @@ class ExternalReference BASE_EMBEDDED {
 
   static ExternalReference interpreter_dispatch_table_address(Isolate* isolate);
   static ExternalReference interpreter_dispatch_counters(Isolate* isolate);
+  static ExternalReference interpreter_handler_statistics(Isolate* isolate);
+  static ExternalReference interpreter_sample_bytecode_handler_function(
+      Isolate* isolate);
 
   static ExternalReference incremental_marking_record_write_function(
       Isolate* isolate);
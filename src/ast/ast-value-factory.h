@@ -30,6 +30,7 @@
 
 #include "src/api.h"
 #include "src/hashmap.h"
+#include "src/parsing/keyword-table.h"
 #include "src/utils.h"
 
 // AstString, AstValue and AstValueFactory are for storing strings and values
@@ -294,6 +295,9 @@ class AstValueFactory {
 #define F(name) name##_ = NULL;
     OTHER_CONSTANTS(F)
 #undef F
+    for (int i = 0; i < KeywordTable::kWordCount; i++) {
+      keyword_table_strings_[i] = NULL;
+    }
   }
 
   Zone* zone() const { return zone_; }
@@ -309,6 +313,16 @@ class AstValueFactory {
     return GetTwoByteStringInternal(literal);
   }
   const AstRawString* GetString(Handle<String> literal);
+  // Returns the string of the word at |index| in the KeywordTable. The string
+  // table is only searched the first time a word is used.
+  const AstRawString* GetKeywordTableString(int index) {
+    DCHECK(0 <= index && index < KeywordTable::kWordCount);
+    if (keyword_table_strings_[index] == NULL) {
+      keyword_table_strings_[index] =
+          GetOneByteStringInternal(KeywordTable::word(index));
+    }
+    return keyword_table_strings_[index];
+  }
   const AstConsString* NewConsString(const AstString* left,
                                      const AstString* right);
 
@@ -367,6 +381,8 @@ class AstValueFactory {
 #define F(name) AstValue* name##_;
   OTHER_CONSTANTS(F)
 #undef F
+
+  const AstRawString* keyword_table_strings_[KeywordTable::kWordCount];
 };
 }  // namespace internal
 }  // namespace v8
@@ -287,8 +287,7 @@ bool Scope::Analyze(ParseInfo* info) {
   }
 
 #ifdef DEBUG
-  if (info->script_is_native() ? FLAG_print_builtin_scopes
-                               : FLAG_print_scopes) {
+  if (info->is_native() ? FLAG_print_builtin_scopes : FLAG_print_scopes) {
     scope->Print();
   }
   scope->CheckScopePositions();
@@ -686,7 +685,7 @@ bool Scope::AllocateVariables(ParseInfo* info, AstNodeFactory* factory) {
   if (!ResolveVariablesRecursively(info, factory)) return false;
 
   // 3) Allocate variables.
-  AllocateVariablesRecursively(info->isolate());
+  AllocateVariablesRecursively();
 
   return true;
 }
@@ -1130,7 +1129,7 @@ bool Scope::ResolveVariable(ParseInfo* info, VariableProxy* proxy,
   Variable* var = LookupRecursive(proxy, &binding_kind, factory);
 
 #ifdef DEBUG
-  if (info->script_is_native()) {
+  if (info->is_native()) {
     // To avoid polluting the global object in native scripts
     //  - Variables must not be allocated to the global scope.
     CHECK_NOT_NULL(outer_scope());
@@ -1272,10 +1271,9 @@ bool Scope::MustAllocateInContext(Variable* var) {
 }
 
 
-bool Scope::HasArgumentsParameter(Isolate* isolate) {
+bool Scope::HasArgumentsParameter() {
   for (int i = 0; i < params_.length(); i++) {
-    if (params_[i]->name().is_identical_to(
-            isolate->factory()->arguments_string())) {
+    if (params_[i]->raw_name() == ast_value_factory_->arguments_string()) {
       return true;
     }
   }
@@ -1297,7 +1295,7 @@ void Scope::AllocateHeapSlot(Variable* var) {
 }
 
 
-void Scope::AllocateParameterLocals(Isolate* isolate) {
+void Scope::AllocateParameterLocals() {
   DCHECK(is_function_scope());
   Variable* arguments = LookupLocal(ast_value_factory_->arguments_string());
   // Functions have 'arguments' declared implicitly in all non arrow functions.
@@ -1306,7 +1304,7 @@ void Scope::AllocateParameterLocals(Isolate* isolate) {
   bool uses_sloppy_arguments = false;
 
   if (arguments != nullptr && MustAllocate(arguments) &&
-      !HasArgumentsParameter(isolate)) {
+      !HasArgumentsParameter()) {
     // 'arguments' is used. Unless there is also a parameter called
     // 'arguments', we must be conservative and allocate all parameters to
     // the context assuming they will be captured by the arguments object.
@@ -1381,9 +1379,9 @@ void Scope::AllocateReceiver() {
 }
 
 
-void Scope::AllocateNonParameterLocal(Isolate* isolate, Variable* var) {
+void Scope::AllocateNonParameterLocal(Variable* var) {
   DCHECK(var->scope() == this);
-  DCHECK(!var->IsVariable(isolate->factory()->dot_result_string()) ||
+  DCHECK(var->raw_name() != ast_value_factory_->dot_result_string() ||
          !var->IsStackLocal());
   if (var->IsUnallocated() && MustAllocate(var)) {
     if (MustAllocateInContext(var)) {
@@ -1395,14 +1393,13 @@ void Scope::AllocateNonParameterLocal(Isolate* isolate, Variable* var) {
 }
 
 
-void Scope::AllocateDeclaredGlobal(Isolate* isolate, Variable* var) {
+void Scope::AllocateDeclaredGlobal(Variable* var) {
   DCHECK(var->scope() == this);
-  DCHECK(!var->IsVariable(isolate->factory()->dot_result_string()) ||
+  DCHECK(var->raw_name() != ast_value_factory_->dot_result_string() ||
          !var->IsStackLocal());
   if (var->IsUnallocated()) {
     if (var->IsStaticGlobalObjectProperty()) {
       DCHECK_EQ(-1, var->index());
-      DCHECK(var->name()->IsString());
       var->AllocateTo(VariableLocation::GLOBAL, num_heap_slots_++);
       num_global_slots_++;
     } else {
@@ -1413,10 +1410,10 @@ void Scope::AllocateDeclaredGlobal(Isolate* isolate, Variable* var) {
 }
 
 
-void Scope::AllocateNonParameterLocalsAndDeclaredGlobals(Isolate* isolate) {
+void Scope::AllocateNonParameterLocalsAndDeclaredGlobals() {
   // All variables that have no rewrite yet are non-parameter locals.
   for (int i = 0; i < temps_.length(); i++) {
-    AllocateNonParameterLocal(isolate, temps_[i]);
+    AllocateNonParameterLocal(temps_[i]);
   }
 
   ZoneList<VarAndOrder> vars(variables_.occupancy(), zone());
@@ -1429,12 +1426,12 @@ void Scope::AllocateNonParameterLocalsAndDeclaredGlobals(Isolate* isolate) {
   vars.Sort(VarAndOrder::Compare);
   int var_count = vars.length();
   for (int i = 0; i < var_count; i++) {
-    AllocateNonParameterLocal(isolate, vars[i].var());
+    AllocateNonParameterLocal(vars[i].var());
   }
 
   if (FLAG_global_var_shortcuts) {
     for (int i = 0; i < var_count; i++) {
-      AllocateDeclaredGlobal(isolate, vars[i].var());
+      AllocateDeclaredGlobal(vars[i].var());
     }
   }
 
@@ -1443,11 +1440,11 @@ void Scope::AllocateNonParameterLocalsAndDeclaredGlobals(Isolate* isolate) {
   // because of the current ScopeInfo implementation (see
   // ScopeInfo::ScopeInfo(FunctionScope* scope) constructor).
   if (function_ != nullptr) {
-    AllocateNonParameterLocal(isolate, function_->proxy()->var());
+    AllocateNonParameterLocal(function_->proxy()->var());
   }
 
   if (rest_parameter_ != nullptr) {
-    AllocateNonParameterLocal(isolate, rest_parameter_);
+    AllocateNonParameterLocal(rest_parameter_);
   }
 
   Variable* new_target_var =
@@ -1464,13 +1461,13 @@ void Scope::AllocateNonParameterLocalsAndDeclaredGlobals(Isolate* isolate) {
 }
 
 
-void Scope::AllocateVariablesRecursively(Isolate* isolate) {
+void Scope::AllocateVariablesRecursively() {
   if (!already_resolved()) {
     num_stack_slots_ = 0;
   }
   // Allocate variables for inner scopes.
   for (int i = 0; i < inner_scopes_.length(); i++) {
-    inner_scopes_[i]->AllocateVariablesRecursively(isolate);
+    inner_scopes_[i]->AllocateVariablesRecursively();
   }
 
   // If scope is already resolved, we still need to allocate
@@ -1481,9 +1478,9 @@ void Scope::AllocateVariablesRecursively(Isolate* isolate) {
 
   // Allocate variables for this scope.
   // Parameters must be allocated first, if any.
-  if (is_function_scope()) AllocateParameterLocals(isolate);
+  if (is_function_scope()) AllocateParameterLocals();
   if (has_this_declaration()) AllocateReceiver();
-  AllocateNonParameterLocalsAndDeclaredGlobals(isolate);
+  AllocateNonParameterLocalsAndDeclaredGlobals();
 
   // Force allocation of a context for this scope if necessary. For a 'with'
   // scope and for a function scope that makes an 'eval' call we need a context,
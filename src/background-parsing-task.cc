@@ -57,6 +57,9 @@ void BackgroundParsingTask::Run() {
   // thread. Passing &parse_info is OK because Parser doesn't store it.
   source_->parser.Reset(new Parser(source_->info.get()));
   source_->parser->ParseOnBackground(source_->info.get());
+  if (FLAG_streaming_analysis && source_->info->literal() != NULL) {
+    source_->parser->AnalyzeOnBackground(source_->info.get());
+  }
 
   if (script_data != NULL) {
     source_->cached_data.Reset(new ScriptCompiler::CachedData(
@@ -13,6 +13,11 @@
 namespace v8 {
 namespace base {
 
+const size_t AccountingAllocator::kMinPooledSegmentSize;
+const size_t AccountingAllocator::kMaxPooledSegmentSize;
+
+AccountingAllocator::~AccountingAllocator() { ClearSegmentPool(); }
+
 void* AccountingAllocator::Allocate(size_t bytes) {
   void* memory = malloc(bytes);
   if (memory) NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
@@ -25,9 +30,82 @@ void AccountingAllocator::Free(void* memory, size_t bytes) {
                             -static_cast<AtomicWord>(bytes));
 }
 
+void* AccountingAllocator::AllocateSegment(size_t bytes) {
+  int index = PoolIndex(bytes);
+  if (index >= 0 && segment_pool_enabled()) {
+    LockGuard<Mutex> lock_guard(&pool_mutex_);
+    PooledSegment* segment = pool_[index];
+    if (segment != nullptr) {
+      pool_[index] = segment->next;
+      pool_size_ -= bytes;
+      NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
+      return segment;
+    }
+  }
+  return Allocate(bytes);
+}
+
+void AccountingAllocator::FreeSegment(void* memory, size_t bytes) {
+  int index = PoolIndex(bytes);
+  if (index >= 0 && segment_pool_enabled()) {
+    LockGuard<Mutex> lock_guard(&pool_mutex_);
+    if (pool_size_ + bytes <= max_pool_size_) {
+      PooledSegment* segment = reinterpret_cast<PooledSegment*>(memory);
+      segment->next = pool_[index];
+      pool_[index] = segment;
+      pool_size_ += bytes;
+      NoBarrier_AtomicIncrement(&current_memory_usage_,
+                                -static_cast<AtomicWord>(bytes));
+      return;
+    }
+  }
+  Free(memory, bytes);
+}
+
+void AccountingAllocator::ConfigureSegmentPool(size_t max_pool_size) {
+  ClearSegmentPool();
+  max_pool_size_ = max_pool_size;
+}
+
+// static
+size_t AccountingAllocator::RoundUpToPooledSize(size_t bytes) {
+  if (bytes > kMaxPooledSegmentSize) return bytes;
+  size_t size = kMinPooledSegmentSize;
+  while (size < bytes) size <<= 1;
+  return size;
+}
+
 size_t AccountingAllocator::GetCurrentMemoryUsage() const {
   return NoBarrier_Load(&current_memory_usage_);
 }
 
+size_t AccountingAllocator::GetCurrentPoolSize() {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  return pool_size_;
+}
+
+// static
+int AccountingAllocator::PoolIndex(size_t bytes) {
+  STATIC_ASSERT(kMaxPooledSegmentSize ==
+                kMinPooledSegmentSize << (kPooledSizeCount - 1));
+  size_t size = kMinPooledSegmentSize;
+  for (int i = 0; i < kPooledSizeCount; i++, size <<= 1) {
+    if (bytes == size) return i;
+  }
+  return -1;
+}
+
+void AccountingAllocator::ClearSegmentPool() {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  for (int i = 0; i < kPooledSizeCount; i++) {
+    while (pool_[i] != nullptr) {
+      PooledSegment* segment = pool_[i];
+      pool_[i] = segment->next;
+      free(segment);
+    }
+  }
+  pool_size_ = 0;
+}
+
 }  // namespace base
 }  // namespace v8
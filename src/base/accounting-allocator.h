@@ -7,6 +7,7 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 namespace base {
@@ -14,16 +15,57 @@ namespace base {
 class AccountingAllocator final {
  public:
   AccountingAllocator() = default;
-  ~AccountingAllocator() = default;
+  ~AccountingAllocator();
 
   // Returns nullptr on failed allocation.
   void* Allocate(size_t bytes);
   void Free(void* memory, size_t bytes);
 
+  // Like Allocate() and Free(), but freed zone segments of the pooled sizes
+  // are kept for reuse as long as the segment pool stays within its budget.
+  void* AllocateSegment(size_t bytes);
+  void FreeSegment(void* memory, size_t bytes);
+
+  // Sets the maximum number of bytes kept in the segment pool, 0 disables the
+  // pool. Must not be called while other threads use the allocator.
+  void ConfigureSegmentPool(size_t max_pool_size);
+  bool segment_pool_enabled() const { return max_pool_size_ > 0; }
+
+  // Returns the smallest pooled segment size that is at least |bytes|, or
+  // |bytes| if it is larger than all of them.
+  static size_t RoundUpToPooledSize(size_t bytes);
+
+  // The number of bytes handed out and not freed yet. Segments kept in the
+  // pool are not included.
   size_t GetCurrentMemoryUsage() const;
+  size_t GetCurrentPoolSize();
+
+  // Segments of the sizes from kMinPooledSegmentSize to kMaxPooledSegmentSize
+  // that are powers of two can be pooled.
+  static const size_t kMinPooledSegmentSize = 8 * 1024;
+  static const size_t kMaxPooledSegmentSize = 64 * 1024;
 
  private:
+  static const int kPooledSizeCount = 4;
+
+  // A free segment in the pool.
+  struct PooledSegment {
+    PooledSegment* next;
+  };
+
+  // Returns the index of the pool list for segments of |bytes|, or -1.
+  static int PoolIndex(size_t bytes);
+
+  void ClearSegmentPool();
+
   AtomicWord current_memory_usage_ = 0;
+  size_t max_pool_size_ = 0;
+
+  // Guards the pool, as zones of an isolate are also used by background
+  // threads.
+  Mutex pool_mutex_;
+  PooledSegment* pool_[kPooledSizeCount] = {};
+  size_t pool_size_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(AccountingAllocator);
 };
@@ -0,0 +1,134 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-compiler.h"
+
+#include "src/factory.h"
+#include "src/isolate.h"
+#include "src/ostreams.h"
+
+namespace v8 {
+namespace internal {
+
+using interpreter::Bytecode;
+using interpreter::BytecodeArrayIterator;
+using interpreter::Bytecodes;
+
+namespace {
+
+const int kInitialBufferSize = 4 * KB;
+
+}  // namespace
+
+BaselineCompiler::BaselineCompiler(Isolate* isolate, Zone* zone,
+                                   Handle<BytecodeArray> bytecode_array)
+    : isolate_(isolate),
+      zone_(zone),
+      bytecode_array_(bytecode_array),
+      masm_(isolate, nullptr, kInitialBufferSize, CodeObjectRequired::kYes),
+      iterator_(bytecode_array),
+      labels_(bytecode_array->length(), nullptr, zone) {}
+
+// static
+bool BaselineCompiler::IsSupportedBytecode(Bytecode bytecode) {
+  switch (bytecode) {
+#define CASE(Name) case Bytecode::k##Name:
+    BASELINE_BYTECODE_LIST(CASE)
+#undef CASE
+    return true;
+    default:
+      return false;
+  }
+}
+
+// static
+MaybeHandle<Code> BaselineCompiler::Compile(
+    Isolate* isolate, Handle<BytecodeArray> bytecode_array) {
+  if (!IsSupported()) return MaybeHandle<Code>();
+
+  // Check all bytecodes up front, so that no code is generated for bytecode
+  // arrays which have to stay interpreted anyway.
+  for (BytecodeArrayIterator it(bytecode_array); !it.done(); it.Advance()) {
+    if (!IsSupportedBytecode(it.current_bytecode())) {
+      if (FLAG_trace_ignition_baseline) {
+        PrintF("[baseline compilation bailed out on %s]\n",
+               Bytecodes::ToString(it.current_bytecode()));
+      }
+      return MaybeHandle<Code>();
+    }
+  }
+
+  Zone zone(isolate->allocator());
+  BaselineCompiler compiler(isolate, &zone, bytecode_array);
+  return compiler.GenerateCode();
+}
+
+Handle<Code> BaselineCompiler::GenerateCode() {
+  for (; !iterator_.done(); iterator_.Advance()) {
+    // Jumps target the first byte of a bytecode, including its prefix.
+    masm()->bind(LabelAt(iterator_.current_offset()));
+    VisitBytecode(iterator_.current_bytecode());
+  }
+
+  CodeDesc desc;
+  masm()->GetCode(&desc);
+  Handle<Code> code = isolate()->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::BASELINE_FUNCTION), masm()->CodeObject());
+  isolate()->counters()->total_compiled_code_size()->Increment(
+      code->instruction_size());
+  isolate()->heap()->IncrementCodeGeneratedBytes(false,
+                                                 code->instruction_size());
+
+  if (FLAG_trace_ignition_baseline) {
+    PrintF("[generated %d bytes of baseline code for %d bytes of bytecode]\n",
+           code->instruction_size(), bytecode_array()->length());
+  }
+#ifdef ENABLE_DISASSEMBLER
+  if (FLAG_print_code) {
+    OFStream os(stdout);
+    code->Disassemble("baseline", os);
+  }
+#endif  // ENABLE_DISASSEMBLER
+  return code;
+}
+
+Label* BaselineCompiler::LabelAt(int offset) {
+  // Labels cannot be copied on all platforms, so they are allocated on demand.
+  if (labels_[offset] == nullptr) {
+    labels_[offset] = new (zone_->New(sizeof(Label))) Label();
+  }
+  return labels_[offset];
+}
+
+void BaselineCompiler::VisitBytecode(Bytecode bytecode) {
+  switch (bytecode) {
+#define CASE(Name)       \
+  case Bytecode::k##Name: \
+    Visit##Name();        \
+    break;
+    BASELINE_BYTECODE_LIST(CASE)
+#undef CASE
+    default:
+      UNREACHABLE();
+  }
+}
+
+#if !V8_TARGET_ARCH_X64
+
+// Only x64 has a code generator so far. On all other platforms Compile()
+// returns before a BaselineCompiler is constructed, so none of the visitors
+// below can be reached and functions stay interpreted.
+
+// static
+bool BaselineCompiler::IsSupported() { return false; }
+
+#define UNREACHABLE_VISITOR(Name) \
+  void BaselineCompiler::Visit##Name() { UNREACHABLE(); }
+BASELINE_BYTECODE_LIST(UNREACHABLE_VISITOR)
+#undef UNREACHABLE_VISITOR
+
+#endif  // !V8_TARGET_ARCH_X64
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,201 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASELINE_BASELINE_COMPILER_H_
+#define V8_BASELINE_BASELINE_COMPILER_H_
+
+#include "src/code-factory.h"
+#include "src/handles.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/macro-assembler.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+// The bytecodes the baseline compiler generates code for. Bytecode arrays
+// containing any other bytecode keep being interpreted.
+#define BASELINE_BYTECODE_LIST(V) \
+  V(LdaZero)                      \
+  V(LdaSmi)                       \
+  V(LdaUndefined)                 \
+  V(LdaNull)                      \
+  V(LdaTheHole)                   \
+  V(LdaTrue)                      \
+  V(LdaFalse)                     \
+  V(LdaConstant)                  \
+  V(LdaGlobal)                    \
+  V(LdrGlobal)                    \
+  V(StaGlobalSloppy)              \
+  V(StaGlobalStrict)              \
+  V(PushContext)                  \
+  V(PopContext)                   \
+  V(LdaContextSlot)               \
+  V(LdrContextSlot)               \
+  V(StaContextSlot)               \
+  V(Ldar)                         \
+  V(Star)                         \
+  V(Mov)                          \
+  V(LdrUndefined)                 \
+  V(LoadIC)                       \
+  V(KeyedLoadIC)                  \
+  V(LdrNamedProperty)             \
+  V(LdrKeyedProperty)             \
+  V(StoreICSloppy)                \
+  V(StoreICStrict)                \
+  V(KeyedStoreICSloppy)           \
+  V(KeyedStoreICStrict)           \
+  V(Add)                          \
+  V(Sub)                          \
+  V(Mul)                          \
+  V(Div)                          \
+  V(Mod)                          \
+  V(BitwiseOr)                    \
+  V(BitwiseXor)                   \
+  V(BitwiseAnd)                   \
+  V(ShiftLeft)                    \
+  V(ShiftRight)                   \
+  V(ShiftRightLogical)            \
+  V(Inc)                          \
+  V(Dec)                          \
+  V(LogicalNot)                   \
+  V(TypeOf)                       \
+  V(ToName)                       \
+  V(ToNumber)                     \
+  V(ToObject)                     \
+  V(Call)                         \
+  V(CallRuntime)                  \
+  V(CallJSRuntime)                \
+  V(New)                          \
+  V(TestEqual)                    \
+  V(TestNotEqual)                 \
+  V(TestEqualStrict)              \
+  V(TestLessThan)                 \
+  V(TestGreaterThan)              \
+  V(TestLessThanOrEqual)          \
+  V(TestGreaterThanOrEqual)       \
+  V(TestInstanceOf)               \
+  V(TestIn)                       \
+  V(CreateRegExpLiteral)          \
+  V(CreateArrayLiteral)           \
+  V(CreateObjectLiteral)          \
+  V(CreateClosure)                \
+  V(Jump)                         \
+  V(JumpConstant)                 \
+  V(JumpIfTrue)                   \
+  V(JumpIfTrueConstant)           \
+  V(JumpIfFalse)                  \
+  V(JumpIfFalseConstant)          \
+  V(JumpIfToBooleanTrue)          \
+  V(JumpIfToBooleanTrueConstant)  \
+  V(JumpIfToBooleanFalse)         \
+  V(JumpIfToBooleanFalseConstant) \
+  V(JumpIfNull)                   \
+  V(JumpIfNullConstant)           \
+  V(JumpIfUndefined)              \
+  V(JumpIfUndefinedConstant)      \
+  V(JumpIfNotHole)                \
+  V(JumpIfNotHoleConstant)        \
+  V(StackCheck)                   \
+  V(ForInPrepare)                 \
+  V(ForInDone)                    \
+  V(ForInNext)                    \
+  V(ForInStep)                    \
+  V(OsrPoll)                      \
+  V(Throw)                        \
+  V(ReThrow)                      \
+  V(Return)
+
+// The baseline compiler translates bytecode into machine code in a single
+// pass, emitting a fixed instruction sequence for every bytecode. The code
+// runs on the interpreter's frame: interpreter registers stay in their frame
+// slots and the current bytecode offset is written to the frame before every
+// call, so the stack walker sees an interpreted frame, and the interpreter can
+// take over at any bytecode boundary, e.g. when an exception is caught or
+// optimized code deoptimizes. Feedback is collected in the same feedback
+// vector slots as the bytecode handlers use.
+class BaselineCompiler final {
+ public:
+  // Returns true if baseline code can be generated on the target platform.
+  static bool IsSupported();
+
+  // Generates baseline code for |bytecode_array|. Returns an empty handle if
+  // the bytecode array contains bytecodes that are not supported.
+  static MaybeHandle<Code> Compile(Isolate* isolate,
+                                   Handle<BytecodeArray> bytecode_array);
+
+ private:
+  BaselineCompiler(Isolate* isolate, Zone* zone,
+                   Handle<BytecodeArray> bytecode_array);
+
+  static bool IsSupportedBytecode(interpreter::Bytecode bytecode);
+
+  Handle<Code> GenerateCode();
+  void VisitBytecode(interpreter::Bytecode bytecode);
+
+  // Platform-specific code generation for each supported bytecode.
+#define DECLARE_VISITOR(Name) void Visit##Name();
+  BASELINE_BYTECODE_LIST(DECLARE_VISITOR)
+#undef DECLARE_VISITOR
+
+  // Platform-specific helpers shared by the bytecode visitors.
+  void PrepareForCall();
+  void LoadTypeFeedbackVector(Register dst);
+  void UpdateInterruptBudget(int weight);
+  void BuildLoadGlobal(Callable ic);
+  void BuildLoadIC(Callable ic);
+  void BuildKeyedLoadIC(Callable ic);
+  void BuildStoreGlobal(Callable ic);
+  void BuildStoreIC(Callable ic);
+  void BuildKeyedStoreIC(Callable ic);
+  void BuildLoadContextSlot(Register dst);
+  void BuildBinaryOp(Callable callable);
+  void BuildSmiBinaryOp(Callable callable);
+  void BuildCompareOp(Callable callable, Condition smi_condition);
+  void BuildUnaryOp(Callable callable);
+  void BuildCountOp(Callable callable, int delta);
+  void BuildCreateLiteral(Runtime::FunctionId function_id, int flags);
+  void BuildCall();
+  void BuildJump();
+  void BuildJumpIf(Condition condition);
+  void BuildJumpIfRoot(Heap::RootListIndex index, bool jump_if_equal);
+  void BuildJumpIfToBoolean(bool jump_if_true);
+
+  // The offset of the current bytecode, not including its prefix.
+  int CurrentBytecodeOffset() const {
+    return iterator_.current_offset() + iterator_.current_prefix_offset();
+  }
+
+  // The offset of the jump target of the current bytecode relative to the
+  // current bytecode, i.e. the interpreter's jump delta.
+  int CurrentJumpDelta() const {
+    return iterator_.GetJumpTargetOffset() - CurrentBytecodeOffset();
+  }
+
+  Label* GetJumpTarget() { return LabelAt(iterator_.GetJumpTargetOffset()); }
+
+  // Returns the label bound to the bytecode at |offset|.
+  Label* LabelAt(int offset);
+
+  Isolate* isolate() const { return isolate_; }
+  MacroAssembler* masm() { return &masm_; }
+  const interpreter::BytecodeArrayIterator& iterator() const {
+    return iterator_;
+  }
+  Handle<BytecodeArray> bytecode_array() const { return bytecode_array_; }
+
+  Isolate* isolate_;
+  Zone* zone_;
+  Handle<BytecodeArray> bytecode_array_;
+  MacroAssembler masm_;
+  interpreter::BytecodeArrayIterator iterator_;
+  ZoneVector<Label*> labels_;
+
+  DISALLOW_COPY_AND_ASSIGN(BaselineCompiler);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_BASELINE_BASELINE_COMPILER_H_
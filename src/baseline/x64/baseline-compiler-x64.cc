@@ -0,0 +1,853 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if V8_TARGET_ARCH_X64
+
+#include "src/baseline/baseline-compiler.h"
+
+#include "src/interpreter/interpreter.h"
+#include "src/x64/frames-x64.h"
+
+namespace v8 {
+namespace internal {
+
+using interpreter::Bytecode;
+using interpreter::Interpreter;
+
+#define __ ACCESS_MASM(masm())
+
+namespace {
+
+// Returns the frame slot holding the interpreter register |reg|.
+Operand RegisterOperand(interpreter::Register reg) {
+  return Operand(rbp, reg.ToOperand() * kPointerSize);
+}
+
+Operand CurrentContextOperand() {
+  return Operand(rbp, StandardFrameConstants::kContextOffset);
+}
+
+Operand BytecodeArrayOperand() {
+  return Operand(rbp, InterpreterFrameConstants::kBytecodeArrayFromFp);
+}
+
+Operand BytecodeOffsetOperand() {
+  return Operand(rbp, InterpreterFrameConstants::kBytecodeOffsetFromFp);
+}
+
+Operand FunctionOperand() {
+  return Operand(rbp, JavaScriptFrameConstants::kFunctionOffset);
+}
+
+}  // namespace
+
+// static
+bool BaselineCompiler::IsSupported() { return true; }
+
+void BaselineCompiler::PrepareForCall() {
+  // Record the offset of the current bytecode in the frame, like the bytecode
+  // handlers do before calls, and load the current context.
+  __ Move(BytecodeOffsetOperand(),
+          Smi::FromInt(BytecodeArray::kHeaderSize - kHeapObjectTag +
+                       CurrentBytecodeOffset()));
+  __ movp(rsi, CurrentContextOperand());
+}
+
+void BaselineCompiler::LoadTypeFeedbackVector(Register dst) {
+  __ movp(dst, FunctionOperand());
+  __ movp(dst, FieldOperand(dst, JSFunction::kSharedFunctionInfoOffset));
+  __ movp(dst, FieldOperand(dst, SharedFunctionInfo::kFeedbackVectorOffset));
+}
+
+void BaselineCompiler::UpdateInterruptBudget(int weight) {
+  DCHECK_LE(weight, 0);
+  Label ok;
+  __ movp(rbx, BytecodeArrayOperand());
+  __ addl(FieldOperand(rbx, BytecodeArray::kInterruptBudgetOffset),
+          Immediate(weight));
+  __ j(not_sign, &ok, Label::kNear);
+
+  // Perform the interrupt and reset the budget.
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ CallRuntime(Runtime::kInterrupt);
+  __ Pop(kInterpreterAccumulatorRegister);
+  __ movp(rbx, BytecodeArrayOperand());
+  __ movl(FieldOperand(rbx, BytecodeArray::kInterruptBudgetOffset),
+          Immediate(Interpreter::InterruptBudget()));
+  __ bind(&ok);
+}
+
+void BaselineCompiler::BuildLoadGlobal(Callable ic) {
+  PrepareForCall();
+  __ LoadNativeContextSlot(Context::EXTENSION_INDEX,
+                           LoadDescriptor::ReceiverRegister());
+  __ Move(LoadDescriptor::NameRegister(),
+          iterator().GetConstantForIndexOperand(0));
+  __ Move(LoadDescriptor::SlotRegister(),
+          Smi::FromInt(iterator().GetIndexOperand(1)));
+  LoadTypeFeedbackVector(LoadWithVectorDescriptor::VectorRegister());
+  __ Call(ic.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::BuildLoadIC(Callable ic) {
+  PrepareForCall();
+  __ movp(LoadDescriptor::ReceiverRegister(),
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ Move(LoadDescriptor::NameRegister(),
+          iterator().GetConstantForIndexOperand(1));
+  __ Move(LoadDescriptor::SlotRegister(),
+          Smi::FromInt(iterator().GetIndexOperand(2)));
+  LoadTypeFeedbackVector(LoadWithVectorDescriptor::VectorRegister());
+  __ Call(ic.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::BuildKeyedLoadIC(Callable ic) {
+  PrepareForCall();
+  // The key is in the accumulator, which doubles as the slot register.
+  __ movp(LoadDescriptor::NameRegister(), kInterpreterAccumulatorRegister);
+  __ movp(LoadDescriptor::ReceiverRegister(),
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ Move(LoadDescriptor::SlotRegister(),
+          Smi::FromInt(iterator().GetIndexOperand(1)));
+  LoadTypeFeedbackVector(LoadWithVectorDescriptor::VectorRegister());
+  __ Call(ic.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::BuildStoreGlobal(Callable ic) {
+  DCHECK(StoreDescriptor::ValueRegister().is(kInterpreterAccumulatorRegister));
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ LoadNativeContextSlot(Context::EXTENSION_INDEX,
+                           StoreDescriptor::ReceiverRegister());
+  __ Move(StoreDescriptor::NameRegister(),
+          iterator().GetConstantForIndexOperand(0));
+  __ Move(VectorStoreICDescriptor::SlotRegister(),
+          Smi::FromInt(iterator().GetIndexOperand(1)));
+  LoadTypeFeedbackVector(VectorStoreICDescriptor::VectorRegister());
+  __ Call(ic.code(), RelocInfo::CODE_TARGET);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::BuildStoreIC(Callable ic) {
+  DCHECK(StoreDescriptor::ValueRegister().is(kInterpreterAccumulatorRegister));
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ movp(StoreDescriptor::ReceiverRegister(),
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ Move(StoreDescriptor::NameRegister(),
+          iterator().GetConstantForIndexOperand(1));
+  __ Move(VectorStoreICDescriptor::SlotRegister(),
+          Smi::FromInt(iterator().GetIndexOperand(2)));
+  LoadTypeFeedbackVector(VectorStoreICDescriptor::VectorRegister());
+  __ Call(ic.code(), RelocInfo::CODE_TARGET);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::BuildKeyedStoreIC(Callable ic) {
+  DCHECK(StoreDescriptor::ValueRegister().is(kInterpreterAccumulatorRegister));
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ movp(StoreDescriptor::ReceiverRegister(),
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ movp(StoreDescriptor::NameRegister(),
+          RegisterOperand(iterator().GetRegisterOperand(1)));
+  __ Move(VectorStoreICDescriptor::SlotRegister(),
+          Smi::FromInt(iterator().GetIndexOperand(2)));
+  LoadTypeFeedbackVector(VectorStoreICDescriptor::VectorRegister());
+  __ Call(ic.code(), RelocInfo::CODE_TARGET);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::BuildLoadContextSlot(Register dst) {
+  __ movp(dst, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ movp(dst, ContextOperand(dst, iterator().GetIndexOperand(1)));
+}
+
+void BaselineCompiler::BuildBinaryOp(Callable callable) {
+  CallInterfaceDescriptor descriptor = callable.descriptor();
+  DCHECK(descriptor.GetRegisterParameter(1).is(
+      kInterpreterAccumulatorRegister));
+  PrepareForCall();
+  __ movp(descriptor.GetRegisterParameter(0),
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ Call(callable.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::BuildSmiBinaryOp(Callable callable) {
+  Label slow, done;
+  __ movp(rdx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ JumpIfNotBothSmi(rdx, kInterpreterAccumulatorRegister, &slow,
+                      Label::kNear);
+  switch (iterator().current_bytecode()) {
+    case Bytecode::kAdd:
+      __ SmiAdd(rdx, rdx, kInterpreterAccumulatorRegister, &slow,
+                Label::kNear);
+      break;
+    case Bytecode::kSub:
+      __ SmiSub(rdx, rdx, kInterpreterAccumulatorRegister, &slow,
+                Label::kNear);
+      break;
+    case Bytecode::kBitwiseOr:
+      __ SmiOr(rdx, rdx, kInterpreterAccumulatorRegister);
+      break;
+    case Bytecode::kBitwiseXor:
+      __ SmiXor(rdx, rdx, kInterpreterAccumulatorRegister);
+      break;
+    case Bytecode::kBitwiseAnd:
+      __ SmiAnd(rdx, rdx, kInterpreterAccumulatorRegister);
+      break;
+    default:
+      UNREACHABLE();
+  }
+  __ movp(kInterpreterAccumulatorRegister, rdx);
+  __ jmp(&done);
+  __ bind(&slow);
+  BuildBinaryOp(callable);
+  __ bind(&done);
+}
+
+void BaselineCompiler::BuildCompareOp(Callable callable,
+                                      Condition smi_condition) {
+  Label slow, done;
+  __ movp(rdx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ JumpIfNotBothSmi(rdx, kInterpreterAccumulatorRegister, &slow,
+                      Label::kNear);
+  __ SmiCompare(rdx, kInterpreterAccumulatorRegister);
+  // Loading a root does not affect the flags.
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex);
+  __ j(smi_condition, &done);
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kFalseValueRootIndex);
+  __ jmp(&done);
+  __ bind(&slow);
+  BuildBinaryOp(callable);
+  __ bind(&done);
+}
+
+void BaselineCompiler::BuildUnaryOp(Callable callable) {
+  Register argument = callable.descriptor().GetRegisterParameter(0);
+  PrepareForCall();
+  if (!argument.is(kInterpreterAccumulatorRegister)) {
+    __ movp(argument, kInterpreterAccumulatorRegister);
+  }
+  __ Call(callable.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::BuildCountOp(Callable callable, int delta) {
+  Label slow, done;
+  __ JumpIfNotSmi(kInterpreterAccumulatorRegister, &slow, Label::kNear);
+  SmiOperationConstraints constraints =
+      SmiOperationConstraint::kPreserveSourceRegister |
+      SmiOperationConstraint::kBailoutOnOverflow;
+  __ SmiAddConstant(kInterpreterAccumulatorRegister,
+                    kInterpreterAccumulatorRegister, Smi::FromInt(delta),
+                    constraints, &slow, Label::kNear);
+  __ jmp(&done);
+  __ bind(&slow);
+  BuildUnaryOp(callable);
+  __ bind(&done);
+}
+
+void BaselineCompiler::BuildCreateLiteral(Runtime::FunctionId function_id,
+                                          int flags) {
+  PrepareForCall();
+  __ Push(FunctionOperand());
+  __ Push(Smi::FromInt(iterator().GetIndexOperand(1)));
+  __ Push(iterator().GetConstantForIndexOperand(0));
+  __ Push(Smi::FromInt(flags));
+  __ CallRuntime(function_id);
+}
+
+void BaselineCompiler::BuildCall() {
+  // The target of the call is expected in rdi.
+  Callable callable = CodeFactory::InterpreterPushArgsAndCall(
+      isolate(), TailCallMode::kDisallow);
+  uint32_t receiver_args_count = iterator().GetRegisterCountOperand(2);
+  DCHECK_LE(1u, receiver_args_count);
+  __ Set(rax, receiver_args_count - 1);
+  __ leap(rbx, RegisterOperand(iterator().GetRegisterOperand(1)));
+  __ Call(callable.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::BuildJump() {
+  int delta = CurrentJumpDelta();
+  if (delta < 0) UpdateInterruptBudget(delta);
+  __ jmp(GetJumpTarget());
+}
+
+void BaselineCompiler::BuildJumpIf(Condition condition) {
+  if (CurrentJumpDelta() < 0) {
+    // Back edges need to update the interrupt budget before jumping.
+    Label skip;
+    __ j(NegateCondition(condition), &skip);
+    BuildJump();
+    __ bind(&skip);
+  } else {
+    __ j(condition, GetJumpTarget());
+  }
+}
+
+void BaselineCompiler::BuildJumpIfRoot(Heap::RootListIndex index,
+                                       bool jump_if_equal) {
+  __ CompareRoot(kInterpreterAccumulatorRegister, index);
+  BuildJumpIf(jump_if_equal ? equal : not_equal);
+}
+
+void BaselineCompiler::BuildJumpIfToBoolean(bool jump_if_true) {
+  // Booleans, e.g. the results of comparisons, do not need a conversion. The
+  // accumulator is only read, so it survives the call to ToBoolean.
+  Label is_boolean;
+  __ movp(rbx, kInterpreterAccumulatorRegister);
+  __ JumpIfRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex,
+                &is_boolean, Label::kNear);
+  __ JumpIfRoot(kInterpreterAccumulatorRegister, Heap::kFalseValueRootIndex,
+                &is_boolean, Label::kNear);
+  __ Push(kInterpreterAccumulatorRegister);
+  BuildUnaryOp(CodeFactory::ToBoolean(isolate()));
+  __ movp(rbx, kInterpreterAccumulatorRegister);
+  __ Pop(kInterpreterAccumulatorRegister);
+  __ bind(&is_boolean);
+  __ CompareRoot(rbx, Heap::kTrueValueRootIndex);
+  BuildJumpIf(jump_if_true ? equal : not_equal);
+}
+
+void BaselineCompiler::VisitLdaZero() {
+  __ Move(kInterpreterAccumulatorRegister, Smi::FromInt(0));
+}
+
+void BaselineCompiler::VisitLdaSmi() {
+  __ Move(kInterpreterAccumulatorRegister,
+          Smi::FromInt(iterator().GetImmediateOperand(0)));
+}
+
+void BaselineCompiler::VisitLdaUndefined() {
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kUndefinedValueRootIndex);
+}
+
+void BaselineCompiler::VisitLdaNull() {
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kNullValueRootIndex);
+}
+
+void BaselineCompiler::VisitLdaTheHole() {
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kTheHoleValueRootIndex);
+}
+
+void BaselineCompiler::VisitLdaTrue() {
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex);
+}
+
+void BaselineCompiler::VisitLdaFalse() {
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kFalseValueRootIndex);
+}
+
+void BaselineCompiler::VisitLdaConstant() {
+  __ Move(kInterpreterAccumulatorRegister,
+          iterator().GetConstantForIndexOperand(0));
+}
+
+void BaselineCompiler::VisitLdaGlobal() {
+  BuildLoadGlobal(CodeFactory::LoadICInOptimizedCode(
+      isolate(), NOT_INSIDE_TYPEOF, UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitLdrGlobal() {
+  __ Push(kInterpreterAccumulatorRegister);
+  BuildLoadGlobal(CodeFactory::LoadICInOptimizedCode(
+      isolate(), NOT_INSIDE_TYPEOF, UNINITIALIZED));
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(2)), rax);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitStaGlobalSloppy() {
+  BuildStoreGlobal(
+      CodeFactory::StoreICInOptimizedCode(isolate(), SLOPPY, UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitStaGlobalStrict() {
+  BuildStoreGlobal(
+      CodeFactory::StoreICInOptimizedCode(isolate(), STRICT, UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitPushContext() {
+  __ movp(rbx, CurrentContextOperand());
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(0)), rbx);
+  __ movp(CurrentContextOperand(), kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitPopContext() {
+  __ movp(rbx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ movp(CurrentContextOperand(), rbx);
+}
+
+void BaselineCompiler::VisitLdaContextSlot() {
+  BuildLoadContextSlot(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitLdrContextSlot() {
+  BuildLoadContextSlot(rbx);
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(2)), rbx);
+}
+
+void BaselineCompiler::VisitStaContextSlot() {
+  int offset = Context::SlotOffset(iterator().GetIndexOperand(1));
+  __ movp(rbx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ movp(Operand(rbx, offset), kInterpreterAccumulatorRegister);
+  // The write barrier clobbers its registers, so pass it copies.
+  __ movp(rdx, kInterpreterAccumulatorRegister);
+  __ RecordWriteContextSlot(rbx, offset, rdx, rcx, kDontSaveFPRegs);
+}
+
+void BaselineCompiler::VisitLdar() {
+  __ movp(kInterpreterAccumulatorRegister,
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+}
+
+void BaselineCompiler::VisitStar() {
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(0)),
+          kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitMov() {
+  __ movp(rbx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(1)), rbx);
+}
+
+void BaselineCompiler::VisitLdrUndefined() {
+  __ LoadRoot(rbx, Heap::kUndefinedValueRootIndex);
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(0)), rbx);
+}
+
+void BaselineCompiler::VisitLoadIC() {
+  BuildLoadIC(CodeFactory::LoadICInOptimizedCode(isolate(), NOT_INSIDE_TYPEOF,
+                                                 UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitKeyedLoadIC() {
+  BuildKeyedLoadIC(
+      CodeFactory::KeyedLoadICInOptimizedCode(isolate(), UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitLdrNamedProperty() {
+  __ Push(kInterpreterAccumulatorRegister);
+  BuildLoadIC(CodeFactory::LoadICInOptimizedCode(isolate(), NOT_INSIDE_TYPEOF,
+                                                 UNINITIALIZED));
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(3)), rax);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitLdrKeyedProperty() {
+  __ Push(kInterpreterAccumulatorRegister);
+  BuildKeyedLoadIC(
+      CodeFactory::KeyedLoadICInOptimizedCode(isolate(), UNINITIALIZED));
+  __ movp(RegisterOperand(iterator().GetRegisterOperand(2)), rax);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitStoreICSloppy() {
+  BuildStoreIC(
+      CodeFactory::StoreICInOptimizedCode(isolate(), SLOPPY, UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitStoreICStrict() {
+  BuildStoreIC(
+      CodeFactory::StoreICInOptimizedCode(isolate(), STRICT, UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitKeyedStoreICSloppy() {
+  BuildKeyedStoreIC(CodeFactory::KeyedStoreICInOptimizedCode(isolate(), SLOPPY,
+                                                             UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitKeyedStoreICStrict() {
+  BuildKeyedStoreIC(CodeFactory::KeyedStoreICInOptimizedCode(isolate(), STRICT,
+                                                             UNINITIALIZED));
+}
+
+void BaselineCompiler::VisitAdd() {
+  BuildSmiBinaryOp(CodeFactory::Add(isolate()));
+}
+
+void BaselineCompiler::VisitSub() {
+  BuildSmiBinaryOp(CodeFactory::Subtract(isolate()));
+}
+
+void BaselineCompiler::VisitMul() {
+  BuildBinaryOp(CodeFactory::Multiply(isolate()));
+}
+
+void BaselineCompiler::VisitDiv() {
+  BuildBinaryOp(CodeFactory::Divide(isolate()));
+}
+
+void BaselineCompiler::VisitMod() {
+  BuildBinaryOp(CodeFactory::Modulus(isolate()));
+}
+
+void BaselineCompiler::VisitBitwiseOr() {
+  BuildSmiBinaryOp(CodeFactory::BitwiseOr(isolate()));
+}
+
+void BaselineCompiler::VisitBitwiseXor() {
+  BuildSmiBinaryOp(CodeFactory::BitwiseXor(isolate()));
+}
+
+void BaselineCompiler::VisitBitwiseAnd() {
+  BuildSmiBinaryOp(CodeFactory::BitwiseAnd(isolate()));
+}
+
+void BaselineCompiler::VisitShiftLeft() {
+  BuildBinaryOp(CodeFactory::ShiftLeft(isolate()));
+}
+
+void BaselineCompiler::VisitShiftRight() {
+  BuildBinaryOp(CodeFactory::ShiftRight(isolate()));
+}
+
+void BaselineCompiler::VisitShiftRightLogical() {
+  BuildBinaryOp(CodeFactory::ShiftRightLogical(isolate()));
+}
+
+void BaselineCompiler::VisitInc() {
+  BuildCountOp(CodeFactory::Inc(isolate()), 1);
+}
+
+void BaselineCompiler::VisitDec() {
+  BuildCountOp(CodeFactory::Dec(isolate()), -1);
+}
+
+void BaselineCompiler::VisitLogicalNot() {
+  Label is_boolean, is_true, done;
+  __ JumpIfRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex,
+                &is_boolean, Label::kNear);
+  __ JumpIfRoot(kInterpreterAccumulatorRegister, Heap::kFalseValueRootIndex,
+                &is_boolean, Label::kNear);
+  BuildUnaryOp(CodeFactory::ToBoolean(isolate()));
+  __ bind(&is_boolean);
+  __ JumpIfRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex,
+                &is_true, Label::kNear);
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex);
+  __ jmp(&done, Label::kNear);
+  __ bind(&is_true);
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kFalseValueRootIndex);
+  __ bind(&done);
+}
+
+void BaselineCompiler::VisitTypeOf() {
+  BuildUnaryOp(CodeFactory::Typeof(isolate()));
+}
+
+void BaselineCompiler::VisitToName() {
+  BuildUnaryOp(CodeFactory::ToName(isolate()));
+}
+
+void BaselineCompiler::VisitToNumber() {
+  // Smis, e.g. the operands of postfix counts in loops, are numbers already.
+  Label done;
+  __ JumpIfSmi(kInterpreterAccumulatorRegister, &done, Label::kNear);
+  BuildUnaryOp(CodeFactory::ToNumber(isolate()));
+  __ bind(&done);
+}
+
+void BaselineCompiler::VisitToObject() {
+  BuildUnaryOp(CodeFactory::ToObject(isolate()));
+}
+
+void BaselineCompiler::VisitCall() {
+  PrepareForCall();
+  __ movp(rdi, RegisterOperand(iterator().GetRegisterOperand(0)));
+  BuildCall();
+}
+
+void BaselineCompiler::VisitCallRuntime() {
+  Runtime::FunctionId function_id =
+      static_cast<Runtime::FunctionId>(iterator().GetRuntimeIdOperand(0));
+  uint32_t args_count = iterator().GetRegisterCountOperand(2);
+  Callable callable = CodeFactory::InterpreterCEntry(isolate());
+  PrepareForCall();
+  __ Set(rax, args_count);
+  if (args_count > 0) {
+    __ leap(r15, RegisterOperand(iterator().GetRegisterOperand(1)));
+  }
+  __ LoadAddress(rbx, ExternalReference(function_id, isolate()));
+  __ Call(callable.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::VisitCallJSRuntime() {
+  PrepareForCall();
+  __ LoadNativeContextSlot(iterator().GetIndexOperand(0), rdi);
+  BuildCall();
+}
+
+void BaselineCompiler::VisitNew() {
+  uint32_t args_count = iterator().GetRegisterCountOperand(2);
+  Callable callable = CodeFactory::InterpreterPushArgsAndConstruct(isolate());
+  PrepareForCall();
+  // The new.target is in the accumulator.
+  __ movp(rdx, kInterpreterAccumulatorRegister);
+  __ movp(rdi, RegisterOperand(iterator().GetRegisterOperand(0)));
+  if (args_count > 0) {
+    __ leap(rbx, RegisterOperand(iterator().GetRegisterOperand(1)));
+  }
+  __ Set(rax, args_count);
+  __ Call(callable.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::VisitTestEqual() {
+  BuildCompareOp(CodeFactory::Equal(isolate()), equal);
+}
+
+void BaselineCompiler::VisitTestNotEqual() {
+  BuildCompareOp(CodeFactory::NotEqual(isolate()), not_equal);
+}
+
+void BaselineCompiler::VisitTestEqualStrict() {
+  BuildCompareOp(CodeFactory::StrictEqual(isolate()), equal);
+}
+
+void BaselineCompiler::VisitTestLessThan() {
+  BuildCompareOp(CodeFactory::LessThan(isolate()), less);
+}
+
+void BaselineCompiler::VisitTestGreaterThan() {
+  BuildCompareOp(CodeFactory::GreaterThan(isolate()), greater);
+}
+
+void BaselineCompiler::VisitTestLessThanOrEqual() {
+  BuildCompareOp(CodeFactory::LessThanOrEqual(isolate()), less_equal);
+}
+
+void BaselineCompiler::VisitTestGreaterThanOrEqual() {
+  BuildCompareOp(CodeFactory::GreaterThanOrEqual(isolate()), greater_equal);
+}
+
+void BaselineCompiler::VisitTestInstanceOf() {
+  PrepareForCall();
+  __ Push(RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ Push(kInterpreterAccumulatorRegister);
+  __ CallRuntime(Runtime::kInstanceOf);
+}
+
+void BaselineCompiler::VisitTestIn() {
+  BuildBinaryOp(CodeFactory::HasProperty(isolate()));
+}
+
+void BaselineCompiler::VisitCreateRegExpLiteral() {
+  Callable callable = CodeFactory::FastCloneRegExp(isolate());
+  CallInterfaceDescriptor descriptor = callable.descriptor();
+  PrepareForCall();
+  __ movp(descriptor.GetRegisterParameter(0), FunctionOperand());
+  __ Move(descriptor.GetRegisterParameter(1),
+          Smi::FromInt(iterator().GetIndexOperand(1)));
+  __ Move(descriptor.GetRegisterParameter(2),
+          iterator().GetConstantForIndexOperand(0));
+  __ Move(descriptor.GetRegisterParameter(3),
+          Smi::FromInt(iterator().GetFlagOperand(2)));
+  __ Call(callable.code(), RelocInfo::CODE_TARGET);
+}
+
+void BaselineCompiler::VisitCreateArrayLiteral() {
+  BuildCreateLiteral(Runtime::kCreateArrayLiteral,
+                     iterator().GetFlagOperand(2));
+}
+
+void BaselineCompiler::VisitCreateObjectLiteral() {
+  // Unlike the bytecode handler, always call the runtime instead of inlining
+  // the fast clone of FastCloneShallowObjectStub.
+  STATIC_ASSERT(interpreter::CreateObjectLiteralFlags::FlagsBits::kShift == 0);
+  int flags = iterator().GetFlagOperand(2) &
+              interpreter::CreateObjectLiteralFlags::FlagsBits::kMask;
+  BuildCreateLiteral(Runtime::kCreateObjectLiteral, flags);
+}
+
+void BaselineCompiler::VisitCreateClosure() {
+  PrepareForCall();
+  __ Push(iterator().GetConstantForIndexOperand(0));
+  __ Push(Smi::FromInt(iterator().GetFlagOperand(1)));
+  __ CallRuntime(Runtime::kInterpreterNewClosure);
+}
+
+void BaselineCompiler::VisitJump() { BuildJump(); }
+
+void BaselineCompiler::VisitJumpConstant() { BuildJump(); }
+
+void BaselineCompiler::VisitJumpIfTrue() {
+  BuildJumpIfRoot(Heap::kTrueValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfTrueConstant() {
+  BuildJumpIfRoot(Heap::kTrueValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfFalse() {
+  BuildJumpIfRoot(Heap::kFalseValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfFalseConstant() {
+  BuildJumpIfRoot(Heap::kFalseValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfToBooleanTrue() {
+  BuildJumpIfToBoolean(true);
+}
+
+void BaselineCompiler::VisitJumpIfToBooleanTrueConstant() {
+  BuildJumpIfToBoolean(true);
+}
+
+void BaselineCompiler::VisitJumpIfToBooleanFalse() {
+  BuildJumpIfToBoolean(false);
+}
+
+void BaselineCompiler::VisitJumpIfToBooleanFalseConstant() {
+  BuildJumpIfToBoolean(false);
+}
+
+void BaselineCompiler::VisitJumpIfNull() {
+  BuildJumpIfRoot(Heap::kNullValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfNullConstant() {
+  BuildJumpIfRoot(Heap::kNullValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfUndefined() {
+  BuildJumpIfRoot(Heap::kUndefinedValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfUndefinedConstant() {
+  BuildJumpIfRoot(Heap::kUndefinedValueRootIndex, true);
+}
+
+void BaselineCompiler::VisitJumpIfNotHole() {
+  BuildJumpIfRoot(Heap::kTheHoleValueRootIndex, false);
+}
+
+void BaselineCompiler::VisitJumpIfNotHoleConstant() {
+  BuildJumpIfRoot(Heap::kTheHoleValueRootIndex, false);
+}
+
+void BaselineCompiler::VisitStackCheck() {
+  Label ok;
+  __ CompareRoot(rsp, Heap::kStackLimitRootIndex);
+  __ j(above_equal, &ok, Label::kNear);
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ CallRuntime(Runtime::kStackGuard);
+  __ Pop(kInterpreterAccumulatorRegister);
+  __ bind(&ok);
+}
+
+void BaselineCompiler::VisitForInPrepare() {
+  // The runtime function returns cache_type, cache_array and cache_length in
+  // three registers. The accumulator is only read by this bytecode.
+  interpreter::Register output = iterator().GetRegisterOperand(0);
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ Push(kInterpreterAccumulatorRegister);
+  __ CallRuntime(Runtime::kForInPrepare);
+  __ movp(RegisterOperand(output), kReturnRegister0);
+  __ movp(RegisterOperand(interpreter::Register(output.index() + 1)),
+          kReturnRegister1);
+  __ movp(RegisterOperand(interpreter::Register(output.index() + 2)),
+          kReturnRegister2);
+  __ Pop(kInterpreterAccumulatorRegister);
+}
+
+void BaselineCompiler::VisitForInDone() {
+  Label done;
+  __ movp(rbx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ cmpp(rbx, RegisterOperand(iterator().GetRegisterOperand(1)));
+  // Loading a root does not affect the flags.
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kTrueValueRootIndex);
+  __ j(equal, &done, Label::kNear);
+  __ LoadRoot(kInterpreterAccumulatorRegister, Heap::kFalseValueRootIndex);
+  __ bind(&done);
+}
+
+void BaselineCompiler::VisitForInNext() {
+  interpreter::Register cache_type = iterator().GetRegisterOperand(2);
+  interpreter::Register cache_array(cache_type.index() + 1);
+  Label slow, done;
+
+  // Load the next key from the enumeration array.
+  __ movp(rbx, RegisterOperand(cache_array));
+  __ movp(rcx, RegisterOperand(iterator().GetRegisterOperand(1)));
+  SmiIndex index = masm()->SmiToIndex(rcx, rcx, kPointerSizeLog2);
+  __ movp(rcx,
+          FieldOperand(rbx, index.reg, index.scale, FixedArray::kHeaderSize));
+
+  // The key is definitely valid if the enum cache is in use for the receiver.
+  __ movp(rdx, RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ movp(rbx, RegisterOperand(cache_type));
+  __ cmpp(rbx, FieldOperand(rdx, HeapObject::kMapOffset));
+  __ j(not_equal, &slow, Label::kNear);
+  __ movp(kInterpreterAccumulatorRegister, rcx);
+  __ jmp(&done);
+
+  // Record the fact that we hit the for-in slow path, and filter the key.
+  __ bind(&slow);
+  LoadTypeFeedbackVector(rbx);
+  __ Move(FieldOperand(rbx, FixedArray::OffsetOfElementAt(
+                                iterator().GetIndexOperand(3))),
+          TypeFeedbackVector::MegamorphicSentinel(isolate()));
+  PrepareForCall();
+  __ Push(rdx);
+  __ Push(rcx);
+  __ CallRuntime(Runtime::kForInFilter);
+  __ bind(&done);
+}
+
+void BaselineCompiler::VisitForInStep() {
+  __ movp(kInterpreterAccumulatorRegister,
+          RegisterOperand(iterator().GetRegisterOperand(0)));
+  __ SmiAddConstant(kInterpreterAccumulatorRegister,
+                    kInterpreterAccumulatorRegister, Smi::FromInt(1));
+}
+
+void BaselineCompiler::VisitOsrPoll() {
+  // OSR points at the given loop depth are armed if the depth is below the
+  // nesting level in the header of the BytecodeArray. The accumulator is dead
+  // at loop headers, and the OSR builtin returns to the code after the call
+  // if no optimized code could be compiled.
+  Label ok;
+  __ movp(rbx, BytecodeArrayOperand());
+  __ cmpb(FieldOperand(rbx, BytecodeArray::kOSRNestingLevelOffset),
+          Immediate(iterator().GetImmediateOperand(0)));
+  __ j(less_equal, &ok, Label::kNear);
+  PrepareForCall();
+  __ Call(isolate()->builtins()->OnStackReplacement(),
+          RelocInfo::CODE_TARGET);
+  __ bind(&ok);
+}
+
+void BaselineCompiler::VisitThrow() {
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ CallRuntime(Runtime::kThrow);
+  // We shouldn't ever return from a throw.
+  if (FLAG_debug_code) __ Abort(kUnexpectedReturnFromThrow);
+}
+
+void BaselineCompiler::VisitReThrow() {
+  PrepareForCall();
+  __ Push(kInterpreterAccumulatorRegister);
+  __ CallRuntime(Runtime::kReThrow);
+  // We shouldn't ever return from a throw.
+  if (FLAG_debug_code) __ Abort(kUnexpectedReturnFromThrow);
+}
+
+void BaselineCompiler::VisitReturn() {
+  UpdateInterruptBudget(-CurrentBytecodeOffset());
+  // Leave the frame and drop the receiver and arguments, like the interpreter
+  // exit trampoline.
+  __ leave();
+  __ Ret(bytecode_array()->parameter_count() * kPointerSize, rcx);
+}
+
+#undef __
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_X64
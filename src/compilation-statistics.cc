@@ -44,6 +44,20 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
 }
 
 
+void CompilationStatistics::RecordMoveStats(const MoveStats& stats) {
+  move_stats_.Accumulate(stats);
+}
+
+
+void CompilationStatistics::MoveStats::Accumulate(const MoveStats& stats) {
+  spills_ += stats.spills_;
+  reloads_ += stats.reloads_;
+  register_moves_ += stats.register_moves_;
+  stack_moves_ += stats.stack_moves_;
+  constant_moves_ += stats.constant_moves_;
+}
+
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -96,6 +110,37 @@ static void WriteHeader(std::ostream& os) {
 }
 
 
+static void WriteMoveLine(std::ostream& os, const char* name, size_t count,
+                          size_t total) {
+  const size_t kBufferSize = 128;
+  char buffer[kBufferSize];
+
+  double percent =
+      static_cast<double>(count * 100) / static_cast<double>(total);
+  base::OS::SNPrintF(buffer, kBufferSize, "%28s %10" PRIuS " (%5.1f%%)", name,
+                     count, percent);
+  os << buffer << std::endl;
+}
+
+
+static void WriteMoveStats(std::ostream& os,
+                           const CompilationStatistics::MoveStats& stats) {
+  size_t total = stats.total();
+  if (total == 0) return;
+  os << std::endl;
+  WriteFullLine(os);
+  os << "         Register allocation            Moves\n";
+  WriteFullLine(os);
+  WriteMoveLine(os, "spills", stats.spills_, total);
+  WriteMoveLine(os, "reloads", stats.reloads_, total);
+  WriteMoveLine(os, "register moves", stats.register_moves_, total);
+  WriteMoveLine(os, "stack moves", stats.stack_moves_, total);
+  WriteMoveLine(os, "constant moves", stats.constant_moves_, total);
+  WriteFullLine(os);
+  WriteMoveLine(os, "totals", total, total);
+}
+
+
 static void WritePhaseKindBreak(std::ostream& os) {
   os << "                             ---------------------------"
         "--------------------------------------------------------\n";
@@ -137,6 +182,7 @@ std::ostream& operator<<(std::ostream& os, const CompilationStatistics& s) {
   }
   WriteFullLine(os);
   WriteLine(os, "totals", s.total_stats_, s.total_stats_);
+  WriteMoveStats(os, s.move_stats_);
 
   return os;
 }
@@ -36,6 +36,29 @@ class CompilationStatistics final : public Malloced {
     std::string function_name_;
   };
 
+  // Gap moves left in the code after register allocation, by kind.
+  class MoveStats {
+   public:
+    MoveStats()
+        : spills_(0),
+          reloads_(0),
+          register_moves_(0),
+          stack_moves_(0),
+          constant_moves_(0) {}
+
+    void Accumulate(const MoveStats& stats);
+    size_t total() const {
+      return spills_ + reloads_ + register_moves_ + stack_moves_ +
+             constant_moves_;
+    }
+
+    size_t spills_;
+    size_t reloads_;
+    size_t register_moves_;
+    size_t stack_moves_;
+    size_t constant_moves_;
+  };
+
   void RecordPhaseStats(const char* phase_kind_name, const char* phase_name,
                         const BasicStats& stats);
 
@@ -44,6 +67,8 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(size_t source_size, const BasicStats& stats);
 
+  void RecordMoveStats(const MoveStats& stats);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -74,6 +99,7 @@ class CompilationStatistics final : public Malloced {
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  MoveStats move_stats_;
 
   DISALLOW_COPY_AND_ASSIGN(CompilationStatistics);
 };
@@ -10,6 +10,7 @@
 #include "src/ast/prettyprinter.h"
 #include "src/ast/scopeinfo.h"
 #include "src/ast/scopes.h"
+#include "src/baseline/baseline-compiler.h"
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
@@ -30,6 +31,7 @@
 #include "src/profiler/cpu-profiler.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/snapshot/shared-code-cache.h"
 #include "src/vm-state-inl.h"
 
 namespace v8 {
@@ -450,7 +452,7 @@ int CodeAndMetadataSize(CompilationInfo* info) {
     size += bytecode_array->BytecodeArraySize();
     size += bytecode_array->constant_pool()->Size();
     size += bytecode_array->handler_table()->Size();
-    size += bytecode_array->source_position_table()->Size();
+    size += bytecode_array->SourcePositionTable()->Size();
   } else {
     Handle<Code> code = info->code();
     size += code->CodeSize();
@@ -765,6 +767,13 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     info->MarkAsOptimizeFromBytecode();
   }
 
+  // On-stack replacement from an interpreted frame requires the graph to be
+  // built from bytecode, so that the frame layouts match.
+  if (osr_frame != nullptr && osr_frame->is_interpreted() &&
+      !info->is_optimizing_from_bytecode()) {
+    return MaybeHandle<Code>();
+  }
+
   if (IsEvalToplevel(shared)) {
     parse_info->set_eval();
     if (function->context()->IsNativeContext()) parse_info->set_global();
@@ -850,6 +859,34 @@ MaybeHandle<Code> GetBaselineCode(Handle<JSFunction> function) {
     return MaybeHandle<Code>();
   }
 
+  // Compile the bytecode itself if possible. The resulting code runs on
+  // interpreter frames and keeps the bytecode as the source of truth, so
+  // neither existing activations nor the debugger get in the way. Functions
+  // keep the interpreter entry trampoline, which runs the baseline code.
+  if (FLAG_ignition_baseline && BaselineCompiler::IsSupported() &&
+      function->shared()->HasBytecodeArray()) {
+    Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+    Handle<BytecodeArray> bytecode_array(shared->bytecode_array(), isolate);
+    if (bytecode_array->HasBaselineCode()) {
+      return handle(shared->code(), isolate);
+    }
+    Handle<Code> baseline_code;
+    if (BaselineCompiler::Compile(isolate, bytecode_array)
+            .ToHandle(&baseline_code)) {
+      if (FLAG_trace_opt) {
+        OFStream os(stdout);
+        os << "[compiled bytecode of " << Brief(*function)
+           << " to baseline code]" << std::endl;
+      }
+      bytecode_array->set_baseline_code(*baseline_code);
+      PROFILE(isolate,
+              CodeCreateEvent(Logger::LAZY_COMPILE_TAG,
+                              AbstractCode::cast(*baseline_code), *shared,
+                              isolate->heap()->empty_string()));
+      return handle(shared->code(), isolate);
+    }
+  }
+
   // TODO(4280): For now we do not switch generators to baseline code because
   // there might be suspended activations stored in generator objects on the
   // heap. We could eventually go directly to TurboFan in this case.
@@ -1085,6 +1122,50 @@ Handle<SharedFunctionInfo> CompileToplevel(CompilationInfo* info) {
   return result;
 }
 
+bool NeedsSourcePositions(Handle<SharedFunctionInfo> shared) {
+  return FLAG_ignition_lazy_source_positions && shared->HasBytecodeArray() &&
+         !shared->bytecode_array()->HasSourcePositionTable();
+}
+
+bool CanCollectSourcePositions(Isolate* isolate) {
+  // Collecting re-parses the function. It must not replace an exception that
+  // is being propagated, and it must not start close to the stack limit,
+  // where it would only fail with another stack overflow.
+  if (isolate->has_pending_exception()) return false;
+  StackLimitCheck check(isolate);
+  return !check.JsHasOverflowed(4 * KB);
+}
+
+bool CollectSourcePositions(CompilationInfo* info) {
+  Isolate* isolate = info->isolate();
+  VMState<COMPILER> state(isolate);
+  PostponeInterruptsScope postpone(isolate);
+  Handle<SharedFunctionInfo> shared = info->shared_info();
+  DCHECK(!shared->is_toplevel());
+
+  // Regenerate the bytecode, this time recording source positions. Bytecode
+  // generation is deterministic, so only the table is taken over. The
+  // existing bytecode array is kept, as it might be executing.
+  info->MarkAsCollectingSourcePositions();
+  DCHECK(!isolate->has_pending_exception());
+  if (!Compiler::ParseAndAnalyze(info->parse_info()) ||
+      !interpreter::Interpreter::MakeBytecode(info)) {
+    // The only exception is the one thrown by the failed attempt.
+    isolate->clear_pending_exception();
+    return false;
+  }
+  Handle<BytecodeArray> bytecode_array(shared->bytecode_array(), isolate);
+  DCHECK_EQ(bytecode_array->length(), info->bytecode_array()->length());
+  ByteArray* table = info->bytecode_array()->SourcePositionTable();
+  bytecode_array->set_source_position_table(table);
+  if (shared->HasDebugInfo()) {
+    // The debug copy of the bytecode needs the table for break locations.
+    AbstractCode* debug_code = shared->GetDebugInfo()->abstract_code();
+    debug_code->GetBytecodeArray()->set_source_position_table(table);
+  }
+  return true;
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------------
@@ -1092,8 +1173,12 @@ Handle<SharedFunctionInfo> CompileToplevel(CompilationInfo* info) {
 
 bool Compiler::Analyze(ParseInfo* info) {
   DCHECK_NOT_NULL(info->literal());
-  if (!Rewriter::Rewrite(info)) return false;
-  if (!Scope::Analyze(info)) return false;
+  // The scopes of a streamed script may have been analyzed on the background
+  // thread already, see Parser::AnalyzeOnBackground.
+  if (info->scope() == NULL) {
+    if (!Rewriter::Rewrite(info)) return false;
+    if (!Scope::Analyze(info)) return false;
+  }
   if (!Renumber(info)) return false;
   DCHECK_NOT_NULL(info->scope());
   return true;
@@ -1238,6 +1323,36 @@ bool Compiler::CompileDebugCode(Handle<SharedFunctionInfo> shared) {
   return true;
 }
 
+bool Compiler::EnsureSourcePositions(Handle<JSFunction> function) {
+  Handle<SharedFunctionInfo> shared(function->shared());
+  if (!NeedsSourcePositions(shared)) return true;
+  Isolate* isolate = function->GetIsolate();
+  DCHECK(AllowCompilation::IsAllowed(isolate));
+  if (!CanCollectSourcePositions(isolate)) return false;
+
+  // Start a compilation.
+  Zone zone(isolate->allocator());
+  ParseInfo parse_info(&zone, function);
+  CompilationInfo info(&parse_info, Handle<JSFunction>::null());
+  return CollectSourcePositions(&info);
+}
+
+bool Compiler::EnsureSourcePositions(Handle<SharedFunctionInfo> shared) {
+  if (!NeedsSourcePositions(shared)) return true;
+  // Without a closure, variables can only be resolved the same way as in the
+  // original compilation if they don't depend on the context chain.
+  if (!shared->allows_lazy_compilation_without_context()) return false;
+  Isolate* isolate = shared->GetIsolate();
+  DCHECK(AllowCompilation::IsAllowed(isolate));
+  if (!CanCollectSourcePositions(isolate)) return false;
+
+  // Start a compilation.
+  Zone zone(isolate->allocator());
+  ParseInfo parse_info(&zone, shared);
+  CompilationInfo info(&parse_info, Handle<JSFunction>::null());
+  return CollectSourcePositions(&info);
+}
+
 bool Compiler::CompileForLiveEdit(Handle<Script> script) {
   Isolate* isolate = script->GetIsolate();
   DCHECK(AllowCompilation::IsAllowed(isolate));
@@ -1377,6 +1492,25 @@ MaybeHandle<JSFunction> Compiler::GetFunctionFromEval(
   return result;
 }
 
+namespace {
+
+void SetScriptOrigin(Handle<Script> script, Handle<Object> script_name,
+                     int line_offset, int column_offset,
+                     ScriptOriginOptions resource_options,
+                     Handle<Object> source_map_url) {
+  if (!script_name.is_null()) {
+    script->set_name(*script_name);
+    script->set_line_offset(line_offset);
+    script->set_column_offset(column_offset);
+  }
+  script->set_origin_options(resource_options);
+  if (!source_map_url.is_null()) {
+    script->set_source_mapping_url(*source_map_url);
+  }
+}
+
+}  // namespace
+
 Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     Handle<String> source, Handle<Object> script_name, int line_offset,
     int column_offset, ScriptOriginOptions resource_options,
@@ -1405,6 +1539,13 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
   CompilationCache* compilation_cache = isolate->compilation_cache();
 
+  // Scripts for which the embedder does not provide a cache may share their
+  // code with other isolates.
+  bool use_shared_code_cache =
+      extension == NULL && natives == NOT_NATIVES_CODE && !is_module &&
+      compile_options == ScriptCompiler::kNoCompileOptions &&
+      SharedCodeCache::IsEligible(isolate, source);
+
   // Do a lookup in the compilation cache but not for extensions.
   MaybeHandle<SharedFunctionInfo> maybe_result;
   Handle<SharedFunctionInfo> result;
@@ -1428,6 +1569,25 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       }
       // Deserializer failed. Fall through to compile.
     }
+    if (maybe_result.is_null() && use_shared_code_cache) {
+      // Then check the code compiled by other isolates.
+      HistogramTimerScope timer(isolate->counters()->compile_deserialize());
+      TRACE_EVENT0("v8", "V8.CompileDeserialize");
+      Handle<SharedFunctionInfo> result;
+      if (SharedCodeCache::Get()->Lookup(isolate, source).ToHandle(&result)) {
+        // Replace the origin the script was compiled with in the other
+        // isolate.
+        Handle<Script> script(Script::cast(result->script()), isolate);
+        script->set_name(isolate->heap()->undefined_value());
+        script->set_line_offset(0);
+        script->set_column_offset(0);
+        script->set_source_mapping_url(isolate->heap()->undefined_value());
+        SetScriptOrigin(script, script_name, line_offset, column_offset,
+                        resource_options, source_map_url);
+        compilation_cache->PutScript(source, context, language_mode, result);
+        return result;
+      }
+    }
   }
 
   base::ElapsedTimer timer;
@@ -1450,15 +1610,8 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       script->set_type(Script::TYPE_EXTENSION);
       script->set_hide_source(true);
     }
-    if (!script_name.is_null()) {
-      script->set_name(*script_name);
-      script->set_line_offset(line_offset);
-      script->set_column_offset(column_offset);
-    }
-    script->set_origin_options(resource_options);
-    if (!source_map_url.is_null()) {
-      script->set_source_mapping_url(*source_map_url);
-    }
+    SetScriptOrigin(script, script_name, line_offset, column_offset,
+                    resource_options, source_map_url);
 
     // Compile the function and add it to the cache.
     Zone zone(isolate->allocator());
@@ -1475,8 +1628,9 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     parse_info.set_compile_options(compile_options);
     parse_info.set_extension(extension);
     parse_info.set_context(context);
-    if (FLAG_serialize_toplevel &&
-        compile_options == ScriptCompiler::kProduceCodeCache) {
+    if ((FLAG_serialize_toplevel &&
+         compile_options == ScriptCompiler::kProduceCodeCache) ||
+        use_shared_code_cache) {
       info.PrepareForSerializing();
     }
 
@@ -1496,6 +1650,12 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
                  timer.Elapsed().InMillisecondsF());
         }
       }
+      if (use_shared_code_cache) {
+        HistogramTimerScope histogram_timer(
+            isolate->counters()->compile_serialize());
+        TRACE_EVENT0("v8", "V8.CompileSerialize");
+        SharedCodeCache::Get()->Put(isolate, source, result);
+      }
     }
 
     if (result.is_null()) {
@@ -50,6 +50,14 @@ class Compiler : public AllStatic {
   static bool CompileDebugCode(Handle<SharedFunctionInfo> shared);
   static bool CompileForLiveEdit(Handle<Script> script);
 
+  // Collects the source position table of interpreted functions whose table
+  // was omitted at compile time (see --ignition-lazy-source-positions), by
+  // regenerating their bytecode. Returns {false} if the table is unavailable.
+  // Nothing is collected while an exception is pending or close to the stack
+  // limit, so this must not be relied upon while throwing.
+  static bool EnsureSourcePositions(Handle<JSFunction> function);
+  static bool EnsureSourcePositions(Handle<SharedFunctionInfo> shared);
+
   // Generate and install code from previously queued compilation job.
   static void FinalizeCompilationJob(CompilationJob* job);
 
@@ -162,6 +170,7 @@ class CompilationInfo final {
     kSourcePositionsEnabled = 1 << 15,
     kBailoutOnUninitialized = 1 << 16,
     kOptimizeFromBytecode = 1 << 17,
+    kCollectSourcePositions = 1 << 18,
   };
 
   CompilationInfo(ParseInfo* parse_info, Handle<JSFunction> closure);
@@ -297,6 +306,12 @@ class CompilationInfo final {
     return GetFlag(kOptimizeFromBytecode);
   }
 
+  void MarkAsCollectingSourcePositions() { SetFlag(kCollectSourcePositions); }
+
+  bool is_collecting_source_positions() const {
+    return GetFlag(kCollectSourcePositions);
+  }
+
   bool GeneratePreagedPrologue() const {
     // Generate a pre-aged prologue if we are optimizing for size, which
     // will make code flushing more aggressive. Only apply to Code::FUNCTION,
@@ -0,0 +1,173 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/allocation-folding.h"
+
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+bool IsFoldableAllocate(Node* node) {
+  if (node->opcode() != IrOpcode::kAllocate) return false;
+  if (OpParameter<PretenureFlag>(node->op()) != NOT_TENURED) return false;
+  Int32Matcher m(node->InputAt(0));
+  return m.HasValue() && m.Value() > 0;
+}
+
+
+int32_t AllocateSizeOf(Node* node) {
+  DCHECK(IsFoldableAllocate(node));
+  return Int32Matcher(node->InputAt(0)).Value();
+}
+
+
+// Loads and stores cannot trigger a GC.
+bool IsLoadOrStore(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kLoadField:
+    case IrOpcode::kLoadElement:
+    case IrOpcode::kStoreField:
+    case IrOpcode::kStoreElement:
+    case IrOpcode::kLoad:
+    case IrOpcode::kStore:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Returns the only effect use of {node}, or nullptr.
+Node* SingleEffectUse(Node* node) {
+  Node* result = nullptr;
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsEffectEdge(edge)) continue;
+    if (result != nullptr) return nullptr;
+    result = edge.from();
+  }
+  return result;
+}
+
+
+bool IsMapStoreTo(Node* node, Node* object) {
+  return node->opcode() == IrOpcode::kStoreField &&
+         node->InputAt(0) == object &&
+         FieldAccessOf(node->op()).offset == HeapObject::kMapOffset;
+}
+
+}  // namespace
+
+
+AllocationFolding::AllocationFolding(JSGraph* jsgraph, Zone* zone)
+    : jsgraph_(jsgraph), zone_(zone), folded_count_(0) {}
+
+
+void AllocationFolding::Fold() {
+  AllNodes all(zone(), graph());
+  for (Node* node : all.live) {
+    if (node->IsDead()) continue;
+    if (IsFoldableAllocate(node)) VisitAllocate(node);
+  }
+}
+
+
+void AllocationFolding::VisitAllocate(Node* node) {
+  Node* dominator = FindDominatingAllocate(node);
+  if (dominator == nullptr) return;
+  if (!IsInitializedBeforeGC(node)) return;
+
+  // Fold in effect chain order, such that all inner pointers of a group are
+  // relative to its first allocation.
+  VisitAllocate(dominator);
+  dominator = FindDominatingAllocate(node);
+
+  int32_t const offset = AllocateSizeOf(dominator);
+  int32_t const size = AllocateSizeOf(node);
+  if (size > Page::kMaxRegularHeapObjectSize - offset) return;
+
+  // Reserve the space for {node} together with {dominator}, and turn {node}
+  // into an inner pointer. No GC can happen before the map of {node} is
+  // stored, so the heap never sees the reserved space uninitialized, and the
+  // inner pointer stays valid for the initializing stores that follow.
+  NodeProperties::ReplaceValueInput(
+      dominator, jsgraph()->Int32Constant(offset + size), 0);
+  Node* value = graph()->NewNode(
+      machine()->BitcastWordToTagged(),
+      graph()->NewNode(machine()->IntAdd(), dominator,
+                       jsgraph()->IntPtrConstant(offset)));
+  Node* effect = NodeProperties::GetEffectInput(node);
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) {
+      edge.UpdateTo(effect);
+    } else {
+      DCHECK(NodeProperties::IsValueEdge(edge));
+      edge.UpdateTo(value);
+    }
+  }
+  node->Kill();
+  folded_count_++;
+}
+
+
+Node* AllocationFolding::FindDominatingAllocate(Node* node) {
+  Node* const control = NodeProperties::GetControlInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  while (true) {
+    switch (effect->opcode()) {
+      case IrOpcode::kAllocate:
+        if (IsFoldableAllocate(effect) &&
+            NodeProperties::GetControlInput(effect) == control) {
+          return effect;
+        }
+        return nullptr;
+      default:
+        // Loads and stores cannot trigger a GC, but must be in the same
+        // basic block, otherwise the reserved space might stay uninitialized.
+        if (!IsLoadOrStore(effect)) return nullptr;
+        if (effect->op()->ControlInputCount() > 0 &&
+            NodeProperties::GetControlInput(effect) != control) {
+          return nullptr;
+        }
+        effect = NodeProperties::GetEffectInput(effect);
+        break;
+    }
+  }
+}
+
+
+bool AllocationFolding::IsInitializedBeforeGC(Node* node) {
+  Node* const control = NodeProperties::GetControlInput(node);
+  Node* effect = node;
+  while (true) {
+    effect = SingleEffectUse(effect);
+    if (effect == nullptr || !IsLoadOrStore(effect)) return false;
+    if (effect->op()->ControlInputCount() > 0 &&
+        NodeProperties::GetControlInput(effect) != control) {
+      return false;
+    }
+    if (IsMapStoreTo(effect, node)) return true;
+  }
+}
+
+
+Graph* AllocationFolding::graph() const { return jsgraph()->graph(); }
+
+
+MachineOperatorBuilder* AllocationFolding::machine() const {
+  return jsgraph()->machine();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,66 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_ALLOCATION_FOLDING_H_
+#define V8_COMPILER_ALLOCATION_FOLDING_H_
+
+#include "src/zone.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class Graph;
+class JSGraph;
+class MachineOperatorBuilder;
+class Node;
+
+// Folds young space allocations of constant size into a preceding one on the
+// same effect chain, if only loads and stores (which cannot trigger a GC) are
+// in between, and both are in the same basic block. The dominating allocation
+// reserves the space for both objects with a single bump of the allocation
+// top, and the folded allocation becomes an inner pointer into it. Until the
+// map of the folded allocation is stored, its part of the reserved space is
+// not a valid heap object, so nothing that could trigger a GC may come first.
+//
+// This relies on the effect and control chains being linearized already
+// (cf. EffectControlLinearizer) and must run before ChangeLowering lowers
+// the Allocate nodes.
+class AllocationFolding final {
+ public:
+  AllocationFolding(JSGraph* jsgraph, Zone* zone);
+
+  void Fold();
+
+  // The number of allocations folded by {Fold}.
+  int folded_count() const { return folded_count_; }
+
+ private:
+  void VisitAllocate(Node* node);
+
+  // Returns the allocation that {node} can be folded into, or nullptr.
+  Node* FindDominatingAllocate(Node* node);
+
+  // Returns true if the map of the allocation {node} is stored in the same
+  // basic block, with only loads and stores on the effect chain in between.
+  bool IsInitializedBeforeGC(Node* node);
+
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  MachineOperatorBuilder* machine() const;
+  Zone* zone() const { return zone_; }
+
+  JSGraph* const jsgraph_;
+  Zone* const zone_;
+  int folded_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(AllocationFolding);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_ALLOCATION_FOLDING_H_
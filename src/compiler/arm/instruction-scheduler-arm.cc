@@ -11,6 +11,11 @@ namespace compiler {
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 
+bool InstructionScheduler::SuperblockSchedulingSupported() {
+  return false;
+}
+
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   switch (instr->arch_opcode()) {
@@ -140,6 +145,9 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   return 1;
 }
 
+
+int InstructionScheduler::GetIssueWidth() { return 1; }
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,258 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+
+#include <cmath>
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/types.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Refines {range} with the knowledge that {condition} holds for {phi}.
+template <typename Range>
+void RefineRange(Node* condition, Node* phi, Range* range) {
+  bool const strict = condition->opcode() == IrOpcode::kNumberLessThan;
+  if (!strict && condition->opcode() != IrOpcode::kNumberLessThanOrEqual) {
+    return;
+  }
+  Node* const lhs = NodeProperties::GetValueInput(condition, 0);
+  Node* const rhs = NodeProperties::GetValueInput(condition, 1);
+  if (lhs == phi && NodeProperties::IsTyped(rhs)) {
+    // phi < rhs or phi <= rhs
+    Type* const rhs_type = NodeProperties::GetType(rhs);
+    if (!rhs_type->Is(Type::OrderedNumber())) return;
+    double const max = rhs_type->Max();
+    if (max < range->max) {
+      range->max = max;
+      range->max_is_exclusive = strict;
+    } else if (max == range->max) {
+      range->max_is_exclusive |= strict;
+    }
+  } else if (rhs == phi && NodeProperties::IsTyped(lhs)) {
+    // lhs < phi or lhs <= phi
+    Type* const lhs_type = NodeProperties::GetType(lhs);
+    if (!lhs_type->Is(Type::OrderedNumber())) return;
+    range->min = std::max(range->min, lhs_type->Min());
+  }
+}
+
+}  // namespace
+
+
+BoundsCheckElimination::BoundsCheckElimination(Editor* editor,
+                                               JSGraph* jsgraph)
+    : AdvancedReducer(editor), jsgraph_(jsgraph) {}
+
+
+BoundsCheckElimination::~BoundsCheckElimination() {}
+
+
+Reduction BoundsCheckElimination::Reduce(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kLoadBuffer:
+      return ReduceLoadBuffer(node);
+    case IrOpcode::kStoreBuffer:
+      return ReduceStoreBuffer(node);
+    default:
+      break;
+  }
+  return NoChange();
+}
+
+
+Reduction BoundsCheckElimination::ReduceLoadBuffer(Node* node) {
+  DCHECK_EQ(IrOpcode::kLoadBuffer, node->opcode());
+  Node* const index = GetProvablyInBoundsIndex(node);
+  if (index == nullptr) return NoChange();
+  BufferAccess const access = BufferAccessOf(node->op());
+  Node* const buffer = NodeProperties::GetValueInput(node, 0);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  Node* const load = graph()->NewNode(
+      simplified()->LoadElement(AccessBuilder::ForTypedArrayElement(
+          access.external_array_type(), true)),
+      buffer, index, effect, control);
+  ReplaceWithValue(node, load, load);
+  return Replace(load);
+}
+
+
+Reduction BoundsCheckElimination::ReduceStoreBuffer(Node* node) {
+  DCHECK_EQ(IrOpcode::kStoreBuffer, node->opcode());
+  Node* const index = GetProvablyInBoundsIndex(node);
+  if (index == nullptr) return NoChange();
+  BufferAccess const access = BufferAccessOf(node->op());
+  Node* const value = NodeProperties::GetValueInput(node, 3);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  node->ReplaceInput(1, index);
+  node->ReplaceInput(2, value);
+  node->ReplaceInput(3, effect);
+  node->ReplaceInput(4, control);
+  node->TrimInputCount(5);
+  NodeProperties::ChangeOp(
+      node, simplified()->StoreElement(AccessBuilder::ForTypedArrayElement(
+                access.external_array_type(), true)));
+  return Changed(node);
+}
+
+
+Node* BoundsCheckElimination::GetProvablyInBoundsIndex(Node* node) {
+  BufferAccess const access = BufferAccessOf(node->op());
+  int const k = ElementSizeLog2Of(access.machine_type().representation());
+  Node* const offset = NodeProperties::GetValueInput(node, 1);
+  Node* const length = NodeProperties::GetValueInput(node, 2);
+
+  // JSTypedLowering computes the byte offset as Word32Shl(index, k).
+  Node* index = offset;
+  if (k != 0) {
+    Int32BinopMatcher m(offset);
+    if (!m.IsWord32Shl() || !m.right().Is(k)) return nullptr;
+    index = m.left().node();
+  }
+
+  // The byte length of the buffer is a constant for all accesses
+  // produced by JSTypedLowering.
+  NumberMatcher mlength(length);
+  if (!mlength.HasValue()) return nullptr;
+  double const element_count = std::floor(mlength.Value() / (1 << k));
+
+  InductionRange range;
+  if (!ComputeIndexRange(index, NodeProperties::GetControlInput(node),
+                         &range)) {
+    return nullptr;
+  }
+  if (range.min < 0.0) return nullptr;
+  if (range.max_is_exclusive ? range.max > element_count
+                             : range.max >= element_count) {
+    return nullptr;
+  }
+  return index;
+}
+
+
+bool BoundsCheckElimination::ComputeIndexRange(Node* index, Node* control,
+                                               InductionRange* range) {
+  switch (index->opcode()) {
+    case IrOpcode::kPhi:
+      if (ComputeInductionRange(index, control, range)) return true;
+      break;
+    case IrOpcode::kNumberBitwiseOr: {
+      // The canonical int32 truncation x|0 of an induction variable {x}.
+      // Truncation towards zero is the identity on integral values in the
+      // int32 range, and maps values in ]-1,0[ to 0.
+      NumberBinopMatcher m(index);
+      if (m.right().Is(0.0) &&
+          ComputeIndexRange(m.left().node(), control, range) &&
+          range->min > -1.0 && range->max <= kMaxInt) {
+        range->min = std::max(0.0, std::floor(range->min));
+        return true;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  // Fall back to the static type of the {index}.
+  if (!NodeProperties::IsTyped(index)) return false;
+  Type* const type = NodeProperties::GetType(index);
+  if (!type->Is(Type::OrderedNumber())) return false;
+  range->min = type->Min();
+  range->max = type->Max();
+  range->max_is_exclusive = false;
+  return true;
+}
+
+
+bool BoundsCheckElimination::ComputeInductionRange(Node* phi, Node* control,
+                                                   InductionRange* range) {
+  DCHECK_EQ(IrOpcode::kPhi, phi->opcode());
+  Node* const loop = NodeProperties::GetControlInput(phi);
+  if (loop->opcode() != IrOpcode::kLoop) return false;
+
+  // Check that {phi} is either monotonically increasing or decreasing, i.e.
+  // all back edge values are of the form phi + c or phi - c for the same
+  // sign of the constant c.
+  int const input_count = phi->op()->ValueInputCount();
+  int direction = 0;
+  for (int i = 1; i < input_count; ++i) {
+    Node* const update = NodeProperties::GetValueInput(phi, i);
+    double step;
+    if (update->opcode() == IrOpcode::kNumberAdd) {
+      NumberBinopMatcher m(update);
+      if (m.left().node() != phi || !m.right().HasValue()) return false;
+      step = m.right().Value();
+    } else if (update->opcode() == IrOpcode::kNumberSubtract) {
+      NumberBinopMatcher m(update);
+      if (m.left().node() != phi || !m.right().HasValue()) return false;
+      step = -m.right().Value();
+    } else {
+      return false;
+    }
+    int const step_direction = step > 0.0 ? 1 : step < 0.0 ? -1 : 0;
+    if (step_direction == 0) return false;
+    if (direction != 0 && direction != step_direction) return false;
+    direction = step_direction;
+  }
+  if (direction == 0) return false;
+
+  // The initial value bounds the range on one side.
+  Node* const initial = NodeProperties::GetValueInput(phi, 0);
+  if (!NodeProperties::IsTyped(initial)) return false;
+  Type* const initial_type = NodeProperties::GetType(initial);
+  if (!initial_type->Is(Type::OrderedNumber())) return false;
+  range->min = -V8_INFINITY;
+  range->max = V8_INFINITY;
+  range->max_is_exclusive = false;
+  if (direction > 0) {
+    range->min = initial_type->Min();
+  } else {
+    range->max = initial_type->Max();
+  }
+
+  // Walk up the dominating control chain to the loop header and collect the
+  // conditions that are known to hold for {phi} at {control}. Inner loops are
+  // entered via their entry edge, as {phi} is invariant in inner loops. We
+  // conservatively stop at merges.
+  while (control != loop) {
+    switch (control->opcode()) {
+      case IrOpcode::kIfTrue: {
+        Node* const branch = NodeProperties::GetControlInput(control);
+        RefineRange(NodeProperties::GetValueInput(branch, 0), phi, range);
+        control = NodeProperties::GetControlInput(branch);
+        break;
+      }
+      case IrOpcode::kLoop:
+        control = NodeProperties::GetControlInput(control, 0);
+        break;
+      default:
+        if (control->op()->ControlInputCount() != 1) return true;
+        control = NodeProperties::GetControlInput(control);
+        break;
+    }
+  }
+  return true;
+}
+
+
+Graph* BoundsCheckElimination::graph() const { return jsgraph()->graph(); }
+
+
+SimplifiedOperatorBuilder* BoundsCheckElimination::simplified() const {
+  return jsgraph()->simplified();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,71 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+#define V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+
+#include "src/compiler/graph-reducer.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class Graph;
+class JSGraph;
+class SimplifiedOperatorBuilder;
+
+
+// Eliminates the implicit bounds checks of LoadBuffer and StoreBuffer nodes
+// whose index is (derived from) a monotonic loop induction variable that is
+// guarded by a dominating loop condition, i.e. the typical
+//
+//   for (var i = 0; i < n; ++i) a[i|0] = ...
+//
+// pattern. The typer widens the type of the induction variable {i}, so the
+// simple type based check in JSTypedLowering cannot prove that the access is
+// in bounds. Instead we derive a range for {i} from its initial value, the
+// direction of its increment and the conditions on the control path to the
+// access, and turn the access into an unchecked LoadElement or StoreElement
+// if that range fits into the buffer.
+class BoundsCheckElimination final : public AdvancedReducer {
+ public:
+  BoundsCheckElimination(Editor* editor, JSGraph* jsgraph);
+  ~BoundsCheckElimination() final;
+
+  Reduction Reduce(Node* node) final;
+
+ private:
+  // A (conservative) range for the value of an induction variable.
+  struct InductionRange {
+    double min;
+    double max;
+    // Whether {max} is an exclusive upper bound.
+    bool max_is_exclusive;
+  };
+
+  Reduction ReduceLoadBuffer(Node* node);
+  Reduction ReduceStoreBuffer(Node* node);
+
+  // Returns the element index if {node} is a LoadBuffer or StoreBuffer whose
+  // access is provably in bounds, or nullptr otherwise.
+  Node* GetProvablyInBoundsIndex(Node* node);
+
+  bool ComputeIndexRange(Node* index, Node* control, InductionRange* range);
+  bool ComputeInductionRange(Node* phi, Node* control, InductionRange* range);
+
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() const;
+
+  JSGraph* const jsgraph_;
+
+  DISALLOW_COPY_AND_ASSIGN(BoundsCheckElimination);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
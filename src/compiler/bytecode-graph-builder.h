@@ -112,10 +112,11 @@ class BytecodeGraphBuilder {
 
   void BuildCreateLiteral(const Operator* op);
   void BuildCreateArguments(CreateArgumentsType type);
-  void BuildLoadGlobal(TypeofMode typeof_mode);
+  Node* BuildLoadGlobal(TypeofMode typeof_mode);
   void BuildStoreGlobal(LanguageMode language_mode);
-  void BuildNamedLoad();
-  void BuildKeyedLoad();
+  Node* BuildLoadContextSlot();
+  Node* BuildNamedLoad();
+  Node* BuildKeyedLoad();
   void BuildNamedStore(LanguageMode language_mode);
   void BuildKeyedStore(LanguageMode language_mode);
   void BuildLdaLookupSlot(TypeofMode typeof_mode);
@@ -215,6 +216,8 @@ class BytecodeGraphBuilder {
   Handle<TypeFeedbackVector> feedback_vector_;
   const FrameStateFunctionInfo* frame_state_function_info_;
   const interpreter::BytecodeArrayIterator* bytecode_iterator_;
+  BailoutId osr_ast_id_;
+  bool osr_entry_found_;
   const BytecodeBranchAnalysis* branch_analysis_;
   Environment* environment_;
 
@@ -0,0 +1,248 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/coloring-allocator.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                             \
+  do {                                         \
+    if (FLAG_trace_alloc) PrintF(__VA_ARGS__); \
+  } while (false)
+
+
+namespace {
+
+// Building the interference graph is quadratic in the worst case, so very
+// large functions are left to the linear scan entirely.
+const size_t kMaxColoredRanges = 2048;
+
+// Uses inside of loops are this much more expensive to spill.
+const float kLoopUseWeight = 10.0f;
+
+}  // namespace
+
+
+ColoringAllocator::ColoringAllocator(RegisterAllocationData* data,
+                                     RegisterKind kind, Zone* local_zone)
+    : RegisterAllocator(data, kind),
+      local_zone_(local_zone),
+      nodes_(local_zone),
+      stack_(local_zone) {
+  STATIC_ASSERT(RegisterConfiguration::kMaxGeneralRegisters <=
+                sizeof(RegisterMask) * kBitsPerByte);
+  STATIC_ASSERT(RegisterConfiguration::kMaxFPRegisters <=
+                sizeof(RegisterMask) * kBitsPerByte);
+}
+
+
+void ColoringAllocator::AllocateRegisters() {
+  SplitAndSpillRangesDefinedByMemoryOperand(code()->VirtualRegisterCount() <=
+                                            num_allocatable_registers());
+
+  BuildNodes();
+  if (nodes_.size() <= kMaxColoredRanges) {
+    BuildInterferenceGraph();
+    Simplify();
+    Select();
+  }
+
+  LinearScanAllocator linear_scan(data(), mode(), local_zone());
+  linear_scan.AllocateRemainingRegisters();
+}
+
+
+void ColoringAllocator::BuildNodes() {
+  for (TopLevelLiveRange* range : data()->live_ranges()) {
+    if (!CanProcessRange(range)) continue;
+    for (LiveRange* child = range; child != nullptr; child = child->next()) {
+      if (child->spilled() || child->IsEmpty()) continue;
+      DCHECK(!child->HasRegisterAssigned());
+      nodes_.push_back({child, ComputeSpillCost(child), 0,
+                        ZoneVector<int>(local_zone()), 0, false});
+    }
+  }
+}
+
+
+void ColoringAllocator::BuildInterferenceGraph() {
+  const ZoneVector<TopLevelLiveRange*>& fixed_ranges = GetFixedRegisters();
+  for (Node& node : nodes_) {
+    for (TopLevelLiveRange* fixed : fixed_ranges) {
+      if (fixed == nullptr || fixed->IsEmpty()) continue;
+      if (fixed->End() <= node.range->Start()) continue;
+      if (node.range->End() <= fixed->Start()) continue;
+      if (node.range->FirstIntersection(fixed).IsValid()) {
+        node.blocked |= RegisterMask{1} << fixed->assigned_register();
+      }
+    }
+  }
+
+  // Sweep over the nodes in order of their start positions, such that only
+  // nodes whose lifetimes overlap need to be checked for interference.
+  ZoneVector<int> order(local_zone());
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    order.push_back(static_cast<int>(i));
+  }
+  std::sort(order.begin(), order.end(), [this](int a, int b) {
+    return nodes_[a].range->Start() < nodes_[b].range->Start();
+  });
+  ZoneVector<int> live(local_zone());
+  for (int index : order) {
+    Node& node = nodes_[index];
+    LifetimePosition start = node.range->Start();
+    live.erase(std::remove_if(live.begin(), live.end(),
+                              [this, start](int other) {
+                                return nodes_[other].range->End() <= start;
+                              }),
+               live.end());
+    for (int other : live) {
+      if (node.range->FirstIntersection(nodes_[other].range).IsValid()) {
+        node.neighbors.push_back(other);
+        nodes_[other].neighbors.push_back(index);
+      }
+    }
+    live.push_back(index);
+  }
+  for (Node& node : nodes_) {
+    node.degree = static_cast<int>(node.neighbors.size());
+  }
+}
+
+
+void ColoringAllocator::Simplify() {
+  RegisterMask allocatable = 0;
+  for (int i = 0; i < num_allocatable_registers(); ++i) {
+    allocatable |= RegisterMask{1} << allocatable_register_code(i);
+  }
+
+  // A node is trivially colorable if it has fewer neighbors than registers
+  // that are not blocked by fixed ranges.
+  auto colors = [allocatable](const Node& node) {
+    return static_cast<int>(
+        base::bits::CountPopulation64(allocatable & ~node.blocked));
+  };
+
+  ZoneVector<int> worklist(local_zone());
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    if (nodes_[i].degree < colors(nodes_[i])) {
+      worklist.push_back(static_cast<int>(i));
+    }
+  }
+
+  while (stack_.size() < nodes_.size()) {
+    int index = -1;
+    while (!worklist.empty()) {
+      int candidate = worklist.back();
+      worklist.pop_back();
+      if (!nodes_[candidate].removed) {
+        index = candidate;
+        break;
+      }
+    }
+    if (index < 0) {
+      // No node is trivially colorable anymore; optimistically push the
+      // cheapest one to spill, hoping that its neighbors share colors.
+      float min_cost = 0;
+      for (size_t i = 0; i < nodes_.size(); ++i) {
+        const Node& node = nodes_[i];
+        if (node.removed) continue;
+        float cost = node.spill_cost / (node.degree + 1);
+        if (index < 0 || cost < min_cost) {
+          index = static_cast<int>(i);
+          min_cost = cost;
+        }
+      }
+    }
+    DCHECK_LE(0, index);
+    Node& node = nodes_[index];
+    node.removed = true;
+    stack_.push_back(index);
+    for (int other : node.neighbors) {
+      Node& neighbor = nodes_[other];
+      if (neighbor.removed) continue;
+      if (--neighbor.degree == colors(neighbor) - 1) {
+        worklist.push_back(other);
+      }
+    }
+  }
+}
+
+
+void ColoringAllocator::Select() {
+  while (!stack_.empty()) {
+    const Node& node = nodes_[stack_.back()];
+    stack_.pop_back();
+    RegisterMask taken = 0;
+    for (int other : node.neighbors) {
+      LiveRange* neighbor = nodes_[other].range;
+      if (neighbor->HasRegisterAssigned()) {
+        taken |= RegisterMask{1} << neighbor->assigned_register();
+      }
+    }
+    int reg = ChooseColor(node, taken);
+    if (reg == kUnassignedRegister) {
+      TRACE("Leaving live range %d:%d uncolored\n",
+            node.range->TopLevel()->vreg(), node.range->relative_id());
+      continue;
+    }
+    AssignColor(node.range, reg);
+  }
+}
+
+
+float ColoringAllocator::ComputeSpillCost(LiveRange* range) const {
+  float cost = 0;
+  for (UsePosition* pos = range->first_pos(); pos != nullptr;
+       pos = pos->next()) {
+    if (!pos->RegisterIsBeneficial()) continue;
+    const InstructionBlock* block =
+        code()->GetInstructionBlock(pos->pos().ToInstructionIndex());
+    bool in_loop = block->IsLoopHeader() || block->loop_header().IsValid();
+    cost += in_loop ? kLoopUseWeight : 1.0f;
+  }
+  // Long ranges with few uses are cheap to spill, and spilling them frees a
+  // register for a long time.
+  return cost / std::max(1u, range->GetSize());
+}
+
+
+int ColoringAllocator::ChooseColor(const Node& node, RegisterMask taken) const {
+  RegisterMask unavailable = node.blocked | taken;
+  int hint_register;
+  if (node.range->FirstHintPosition(&hint_register) != nullptr &&
+      (unavailable & (RegisterMask{1} << hint_register)) == 0) {
+    for (int i = 0; i < num_allocatable_registers(); ++i) {
+      if (allocatable_register_code(i) == hint_register) return hint_register;
+    }
+  }
+  for (int i = 0; i < num_allocatable_registers(); ++i) {
+    int code = allocatable_register_code(i);
+    if ((unavailable & (RegisterMask{1} << code)) == 0) return code;
+  }
+  return kUnassignedRegister;
+}
+
+
+void ColoringAllocator::AssignColor(LiveRange* range, int reg) {
+  TRACE("Coloring live range %d:%d with %s\n", range->TopLevel()->vreg(),
+        range->relative_id(), RegisterName(reg));
+  data()->MarkAllocated(range->kind(), reg);
+  range->set_assigned_register(reg);
+  range->set_precolored(true);
+  range->SetUseHints(reg);
+  if (range->IsTopLevel() && range->TopLevel()->is_phi()) {
+    data()->GetPhiMapValueFor(range->TopLevel())->set_assigned_register(reg);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,75 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_COLORING_ALLOCATOR_H_
+#define V8_COMPILER_COLORING_ALLOCATOR_H_
+
+#include "src/compiler/register-allocator.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// A Chaitin-Briggs style graph coloring register allocator. Every live range
+// (after splitting off the parts defined by memory operands) is a node of an
+// interference graph, which is colored optimistically: nodes of insignificant
+// degree are removed first, otherwise the node with the lowest spill cost,
+// where uses inside of loops are weighted higher than uses outside of loops.
+// Registers that fixed ranges occupy during the lifetime of a node are
+// excluded from its colors, and the register hints of a node are preferred
+// over other free colors.
+//
+// Instead of rewriting the code with spill code and iterating, the ranges
+// that could not be colored are passed on to the LinearScanAllocator, which
+// splits and spills them around the colored ranges. This keeps the global
+// assignment of the coloring for the uncontended ranges, while the linear
+// scan guarantees that allocation always succeeds.
+class ColoringAllocator final : public RegisterAllocator {
+ public:
+  ColoringAllocator(RegisterAllocationData* data, RegisterKind kind,
+                    Zone* local_zone);
+
+  void AllocateRegisters();
+
+ private:
+  typedef uint64_t RegisterMask;
+
+  struct Node {
+    LiveRange* range;
+    float spill_cost;
+    // Registers occupied by fixed ranges that interfere with {range}.
+    RegisterMask blocked;
+    ZoneVector<int> neighbors;
+    int degree;
+    bool removed;
+  };
+
+  Zone* local_zone() const { return local_zone_; }
+
+  void BuildNodes();
+  void BuildInterferenceGraph();
+  void Simplify();
+  void Select();
+
+  float ComputeSpillCost(LiveRange* range) const;
+
+  // Returns the color for {node} given the registers {taken} by its colored
+  // neighbors, or kUnassignedRegister.
+  int ChooseColor(const Node& node, RegisterMask taken) const;
+
+  void AssignColor(LiveRange* range, int reg);
+
+  Zone* const local_zone_;
+  ZoneVector<Node> nodes_;
+  ZoneVector<int> stack_;
+
+  DISALLOW_COPY_AND_ASSIGN(ColoringAllocator);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_COLORING_ALLOCATOR_H_
@@ -190,12 +190,15 @@ void InstructionScheduler::ScheduleBlock() {
     }
   }
 
-  // Go through the ready list and schedule the instructions.
+  // Go through the ready list and schedule the instructions, issuing up to
+  // {issue_width} instructions per cycle.
+  int const issue_width = GetIssueWidth();
   int cycle = 0;
   while (!ready_list.IsEmpty()) {
-    ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
+    for (int slot = 0; slot < issue_width && !ready_list.IsEmpty(); ++slot) {
+      ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
+      if (candidate == nullptr) break;
 
-    if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
@@ -320,6 +323,48 @@ bool InstructionScheduler::HasOperandDependency(
 }
 
 
+namespace {
+
+// Fixed register constraints are used by instructions which may trap (e.g.
+// integer division) and would extend the live ranges of the fixed registers
+// into the other successors of the block.
+bool IsUnconstrainedOperand(const InstructionOperand* operand) {
+  if (operand->IsUnallocated()) {
+    return !UnallocatedOperand::cast(operand)->HasFixedPolicy();
+  }
+  return operand->IsConstant() || operand->IsImmediate();
+}
+
+}  // namespace
+
+
+bool InstructionScheduler::CanBeSpeculated(const Instruction* instr) const {
+  if (!SuperblockSchedulingSupported()) return false;
+
+  // Definitions of constants are pure.
+  if (instr->arch_opcode() == kArchNop) {
+    return instr->InputCount() == 0 && instr->TempCount() == 0 &&
+           instr->OutputCount() == 1 && instr->OutputAt(0)->IsConstant();
+  }
+
+  if ((GetInstructionFlags(instr) != kNoOpcodeFlags) || instr->IsCall() ||
+      instr->IsDeoptimizeCall() || IsBlockTerminator(instr)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < instr->OutputCount(); ++i) {
+    if (!IsUnconstrainedOperand(instr->OutputAt(i))) return false;
+  }
+  for (size_t i = 0; i < instr->InputCount(); ++i) {
+    if (!IsUnconstrainedOperand(instr->InputAt(i))) return false;
+  }
+  for (size_t i = 0; i < instr->TempCount(); ++i) {
+    if (!IsUnconstrainedOperand(instr->TempAt(i))) return false;
+  }
+  return true;
+}
+
+
 bool InstructionScheduler::IsBlockTerminator(const Instruction* instr) const {
   return ((GetInstructionFlags(instr) & kIsBlockTerminator) ||
           (instr->flags_mode() == kFlags_branch));
@@ -21,6 +21,8 @@ enum ArchOpcodeFlags {
   kHasSideEffect = 2,      // The instruction has some side effects (memory
                            // store, function call...)
   kIsLoadOperation = 4,    // The instruction is a memory load.
+  kMayTrap = 8,            // The instruction can raise a hardware exception,
+                           // e.g.: integer division.
 };
 
 
@@ -33,7 +35,17 @@ class InstructionScheduler final : public ZoneObject {
 
   void AddInstruction(Instruction* instr);
 
+  // Return true if {instr} can be moved from the fallthrough successor of a
+  // block into the block itself, where it is executed speculatively, i.e.
+  // whether it is free of side effects, cannot trap and doesn't constrain the
+  // register allocation.
+  bool CanBeSpeculated(const Instruction* instr) const;
+
   static bool SchedulerSupported();
+  // Whether instructions can be moved into the predecessor of their block
+  // (see CanBeSpeculated), which is only done on architectures that model
+  // instruction latencies.
+  static bool SuperblockSchedulingSupported();
 
  private:
   // A scheduling graph node.
@@ -189,6 +201,10 @@ class InstructionScheduler final : public ZoneObject {
 
   static int GetInstructionLatency(const Instruction* instr);
 
+  // Return the number of independent instructions which can be issued in the
+  // same cycle.
+  static int GetIssueWidth();
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   Isolate* isolate() { return sequence()->isolate(); }
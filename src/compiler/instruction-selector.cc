@@ -4,6 +4,7 @@
 
 #include "src/compiler/instruction-selector.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "src/base/adapters.h"
@@ -78,7 +79,16 @@ void InstructionSelector::SelectInstructions() {
     DCHECK_LE(end, start);
     StartBlock(RpoNumber::FromInt(block->rpo_number()));
     while (start-- > end) {
-      AddInstruction(instructions_[start]);
+      Instruction* instr = instructions_[start];
+      // Skip instructions that were hoisted into the predecessor.
+      if (instr == nullptr) continue;
+      if (start == end && scheduler_ != nullptr &&
+          FLAG_turbo_superblock_scheduling) {
+        // Let the scheduler interleave the beginning of the fallthrough
+        // successor with this block, before the block terminator.
+        HoistFromFallthrough(instruction_block);
+      }
+      AddInstruction(instr);
     }
     EndBlock(RpoNumber::FromInt(block->rpo_number()));
   }
@@ -87,6 +97,64 @@ void InstructionSelector::SelectInstructions() {
 #endif
 }
 
+void InstructionSelector::HoistFromFallthrough(const InstructionBlock* block) {
+  // Limit the number of speculatively executed instructions to keep the
+  // register pressure in check.
+  static const int kMaxHoistedInstructions = 4;
+
+  const InstructionBlock* fallthrough = nullptr;
+  for (RpoNumber const successor : block->successors()) {
+    const InstructionBlock* candidate =
+        sequence()->InstructionBlockAt(successor);
+    if (block->ao_number().IsNext(candidate->ao_number())) {
+      fallthrough = candidate;
+    }
+  }
+  // Instructions can only be moved if {block} dominates the fallthrough block
+  // and the move doesn't pull deferred code into the hot path.
+  if (fallthrough == nullptr || fallthrough->PredecessorCount() != 1 ||
+      fallthrough->IsDeferred() != block->IsDeferred()) {
+    return;
+  }
+  DCHECK_EQ(block->rpo_number(), fallthrough->predecessors()[0]);
+
+  // Virtual registers defined by the instructions that stay in the
+  // fallthrough block.
+  ZoneVector<int> pinned(zone());
+  int hoisted = 0;
+  size_t end = fallthrough->code_end();
+  size_t start = fallthrough->code_start();
+  while (start-- > end && hoisted < kMaxHoistedInstructions) {
+    Instruction* instr = instructions_[start];
+    bool can_hoist = scheduler_->CanBeSpeculated(instr);
+    for (size_t i = 0; can_hoist && i < instr->InputCount(); ++i) {
+      InstructionOperand* input = instr->InputAt(i);
+      if (input->IsUnallocated()) {
+        int vreg = UnallocatedOperand::cast(input)->virtual_register();
+        can_hoist = std::find(pinned.begin(), pinned.end(), vreg) ==
+                    pinned.end();
+      }
+    }
+    if (can_hoist) {
+      AddInstruction(instr);
+      instructions_[start] = nullptr;
+      hoisted++;
+    } else {
+      for (size_t i = 0; i < instr->OutputCount(); ++i) {
+        InstructionOperand* output = instr->OutputAt(i);
+        if (output->IsUnallocated()) {
+          int vreg = UnallocatedOperand::cast(output)->virtual_register();
+          pinned.push_back(vreg);
+        } else if (output->IsConstant()) {
+          int vreg = ConstantOperand::cast(output)->virtual_register();
+          pinned.push_back(vreg);
+        }
+      }
+    }
+  }
+}
+
+
 void InstructionSelector::StartBlock(RpoNumber rpo) {
   if (FLAG_turbo_instruction_scheduling &&
       InstructionScheduler::SchedulerSupported()) {
@@ -707,6 +775,7 @@ void InstructionSelector::VisitBlock(BasicBlock* block) {
   for (Node* const node : *block) {
     if (node->opcode() == IrOpcode::kStore ||
         node->opcode() == IrOpcode::kCheckedStore ||
+        node->opcode() == IrOpcode::kArrayBinop ||
         node->opcode() == IrOpcode::kCall) {
       ++effect_level;
     }
@@ -1159,6 +1228,8 @@ void InstructionSelector::VisitNode(Node* node) {
     }
     case IrOpcode::kCheckedStore:
       return VisitCheckedStore(node);
+    case IrOpcode::kArrayBinop:
+      return VisitArrayBinop(node);
     case IrOpcode::kInt32PairAdd:
       MarkAsWord32(NodeProperties::FindProjection(node, 0));
       MarkAsWord32(NodeProperties::FindProjection(node, 1));
@@ -1433,6 +1504,11 @@ void InstructionSelector::VisitWord32PairShr(Node* node) { UNIMPLEMENTED(); }
 void InstructionSelector::VisitWord32PairSar(Node* node) { UNIMPLEMENTED(); }
 #endif  // V8_TARGET_ARCH_64_BIT
 
+// Only x64 provides the vectorized array operations.
+#if !V8_TARGET_ARCH_X64
+void InstructionSelector::VisitArrayBinop(Node* node) { UNIMPLEMENTED(); }
+#endif  // !V8_TARGET_ARCH_X64
+
 void InstructionSelector::VisitFinishRegion(Node* node) {
   OperandGenerator g(this);
   Node* value = node->InputAt(0);
@@ -171,6 +171,11 @@ class InstructionSelector final {
  private:
   friend class OperandGenerator;
 
+  // Moves side effect free instructions from the beginning of the fallthrough
+  // successor of {block} into {block}, which is currently being scheduled, so
+  // that the instruction scheduler can operate on superblocks.
+  void HoistFromFallthrough(const InstructionBlock* block);
+
   void EmitTableSwitch(const SwitchInfo& sw, InstructionOperand& index_operand);
   void EmitLookupSwitch(const SwitchInfo& sw,
                         InstructionOperand& value_operand);
@@ -0,0 +1,153 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/node-properties.h"
+#include "src/compiler/opcodes.h"
+#include "src/compiler/operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                   \
+  do {                                               \
+    if (FLAG_trace_turbo_licm) PrintF(__VA_ARGS__); \
+  } while (false)
+
+
+LoopInvariantCodeMotion::LoopInvariantCodeMotion(LoopTree* loop_tree,
+                                                 Zone* zone)
+    : loop_tree_(loop_tree), hoisted_(zone), hoisted_count_(0) {}
+
+
+void LoopInvariantCodeMotion::Optimize() {
+  for (LoopTree::Loop* loop : loop_tree()->outer_loops()) VisitLoop(loop);
+}
+
+
+void LoopInvariantCodeMotion::VisitLoop(LoopTree::Loop* loop) {
+  // Process inner loops first.
+  for (LoopTree::Loop* child : loop->children()) VisitLoop(child);
+
+  // Find the (unique) EffectPhi of the {loop}.
+  Node* const loop_node = loop_tree()->GetLoopControl(loop);
+  Node* effect_phi = nullptr;
+  for (Node* node : loop_tree()->HeaderNodes(loop)) {
+    if (node->opcode() == IrOpcode::kEffectPhi &&
+        NodeProperties::GetControlInput(node) == loop_node) {
+      if (effect_phi != nullptr) return;
+      effect_phi = node;
+    }
+  }
+  if (effect_phi == nullptr) return;
+
+  // Determine the kinds of stores in the {loop}, including nested loops.
+  bool may_write_fields = false;
+  bool may_write_elements = false;
+  for (Node* node : loop_tree()->LoopNodes(loop)) {
+    if (node->op()->EffectOutputCount() == 0) continue;
+    if (node->op()->HasProperty(Operator::kNoWrite)) continue;
+    switch (node->opcode()) {
+      case IrOpcode::kJSStackCheck:
+        // Like Crankshaft we don't consider stack checks to change the
+        // contents of the heap.
+        break;
+      case IrOpcode::kStoreBuffer:
+      case IrOpcode::kStoreElement:
+        // These can never interfere with field loads.
+        may_write_elements = true;
+        break;
+      default:
+        may_write_fields = true;
+        may_write_elements = true;
+        break;
+    }
+    if (may_write_fields) return;
+  }
+
+  // Repeatedly hoist loads directly following the {effect_phi}, which
+  // allows us to hoist chains of dependent loads.
+  bool changed;
+  do {
+    changed = false;
+    for (Edge edge : effect_phi->use_edges()) {
+      Node* const use = edge.from();
+      if (!NodeProperties::IsEffectEdge(edge)) continue;
+      if (CanHoist(loop, use, may_write_fields, may_write_elements)) {
+        Hoist(loop, use, effect_phi);
+        changed = true;
+        break;
+      }
+    }
+  } while (changed);
+}
+
+
+bool LoopInvariantCodeMotion::CanHoist(LoopTree::Loop* loop, Node* node,
+                                       bool may_write_fields,
+                                       bool may_write_elements) {
+  switch (node->opcode()) {
+    case IrOpcode::kLoadField:
+      if (may_write_fields) return false;
+      break;
+    case IrOpcode::kLoadBuffer:
+    case IrOpcode::kLoadElement:
+      if (may_write_elements) return false;
+      break;
+    default:
+      return false;
+  }
+  // The {node} must be executed on every iteration of the {loop}.
+  if (!IsInLoop(loop, node) ||
+      NodeProperties::GetControlInput(node) !=
+      loop_tree()->GetLoopControl(loop)) {
+    return false;
+  }
+  for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+    if (IsInLoop(loop, NodeProperties::GetValueInput(node, i))) return false;
+  }
+  return true;
+}
+
+
+void LoopInvariantCodeMotion::Hoist(LoopTree::Loop* loop, Node* node,
+                                    Node* effect_phi) {
+  TRACE("Hoisting #%d:%s out of loop #%d\n", node->id(),
+        node->op()->mnemonic(), loop_tree()->GetLoopControl(loop)->id());
+  DCHECK_EQ(effect_phi, NodeProperties::GetEffectInput(node));
+  Node* const loop_node = loop_tree()->GetLoopControl(loop);
+  Node* const entry_effect =
+      NodeProperties::GetEffectInput(effect_phi, kAssumedLoopEntryIndex);
+  Node* const entry_control =
+      NodeProperties::GetControlInput(loop_node, kAssumedLoopEntryIndex);
+
+  // Remove the {node} from the effect chain inside the {loop}...
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect_phi);
+  }
+  // ...and insert it right before the {loop} instead.
+  NodeProperties::ReplaceEffectInput(node, entry_effect);
+  NodeProperties::ReplaceControlInput(node, entry_control);
+  NodeProperties::ReplaceEffectInput(effect_phi, node, kAssumedLoopEntryIndex);
+
+  hoisted_[node] = loop->parent();
+  hoisted_count_++;
+}
+
+
+bool LoopInvariantCodeMotion::IsInLoop(LoopTree::Loop* loop, Node* node) {
+  auto it = hoisted_.find(node);
+  LoopTree::Loop* containing =
+      it == hoisted_.end() ? loop_tree()->ContainingLoop(node) : it->second;
+  for (; containing != nullptr; containing = containing->parent()) {
+    if (containing == loop) return true;
+  }
+  return false;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,63 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Hoists loop invariant loads out of loops. Pure nodes are not bound to
+// control and are hoisted by the Scheduler already, so this deals with the
+// effect-free loads that are wired into the effect chain of the loop:
+//
+//  - a LoadField is hoisted if the loop contains no stores that can alias
+//    it (stores to elements and buffers never interfere with field loads,
+//    cf. LoadElimination), and
+//  - a LoadElement or LoadBuffer is hoisted if the loop contains no stores
+//    at all,
+//
+// provided the load is executed on every iteration (i.e. its control is the
+// loop header), reads the memory state at loop entry (i.e. its effect input
+// is the loop's EffectPhi) and all its value inputs are defined outside the
+// loop. Inner loops are processed before outer loops, so loads can move out
+// of a loop nest step by step.
+class LoopInvariantCodeMotion final {
+ public:
+  LoopInvariantCodeMotion(LoopTree* loop_tree, Zone* zone);
+
+  void Optimize();
+
+  // The number of loads hoisted by {Optimize}.
+  int hoisted_count() const { return hoisted_count_; }
+
+ private:
+  void VisitLoop(LoopTree::Loop* loop);
+  bool CanHoist(LoopTree::Loop* loop, Node* node, bool may_write_fields,
+                bool may_write_elements);
+  void Hoist(LoopTree::Loop* loop, Node* node, Node* effect_phi);
+
+  // Returns true if {node} is defined inside {loop}, taking into account the
+  // nodes that were already hoisted.
+  bool IsInLoop(LoopTree::Loop* loop, Node* node);
+
+  LoopTree* loop_tree() const { return loop_tree_; }
+
+  LoopTree* const loop_tree_;
+  // Maps hoisted nodes to their new innermost containing loop (or nullptr).
+  ZoneMap<Node*, LoopTree::Loop*> hoisted_;
+  int hoisted_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(LoopInvariantCodeMotion);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
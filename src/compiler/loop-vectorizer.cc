@@ -0,0 +1,407 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "src/compiler/js-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/types.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// The widest vector (in bytes) processed per iteration by any backend.
+const intptr_t kMaxVectorSize = 32;
+
+// The number of elements processed by one ArrayBinop between two stack
+// checks of the vectorized loop.
+const int kElementsPerStackCheck = 4096;
+
+
+bool IsStateNode(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kFrameState:
+    case IrOpcode::kStateValues:
+    case IrOpcode::kTypedStateValues:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+bool IsIndexOf(Node* index, Node* phi) {
+  if (index == phi) return true;
+  // The canonical int32 truncation phi|0 is the identity here, since the
+  // induction variable is an integer in the int32 range.
+  if (index->opcode() == IrOpcode::kNumberBitwiseOr) {
+    NumberBinopMatcher m(index);
+    return m.left().node() == phi && m.right().Is(0.0);
+  }
+  return false;
+}
+
+
+bool MatchArrayBinopKind(Node* node, ArrayBinopKind* kind) {
+  switch (node->opcode()) {
+    case IrOpcode::kNumberAdd:
+      *kind = ArrayBinopKind::kAdd;
+      return true;
+    case IrOpcode::kNumberSubtract:
+      *kind = ArrayBinopKind::kSub;
+      return true;
+    case IrOpcode::kNumberMultiply:
+      *kind = ArrayBinopKind::kMul;
+      return true;
+    case IrOpcode::kNumberDivide:
+      *kind = ArrayBinopKind::kDiv;
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Returns the representation in which the element-wise operation on arrays
+// with the given {access} can be performed without changing the result, or
+// kNone if there is no such representation.
+MachineRepresentation ArrayBinopRepresentationFor(ElementAccess const& access,
+                                                  ArrayBinopKind kind) {
+  if (access.base_is_tagged != kUntaggedBase || access.header_size != 0) {
+    return MachineRepresentation::kNone;
+  }
+  MachineRepresentation const rep = access.machine_type.representation();
+  switch (rep) {
+    case MachineRepresentation::kFloat32:
+      // Double rounding of float32 +, -, * and / via float64 is innocuous.
+    case MachineRepresentation::kFloat64:
+      return rep;
+    case MachineRepresentation::kWord32:
+      // Integer addition and subtraction are exact in float64, so storing
+      // the result truncated to 32 bits is equivalent to a wrapping operation
+      // on the (signed or unsigned) machine words.
+      if (kind == ArrayBinopKind::kAdd || kind == ArrayBinopKind::kSub) {
+        return rep;
+      }
+      break;
+    default:
+      break;
+  }
+  return MachineRepresentation::kNone;
+}
+
+
+// Returns true if the (untagged) arrays at {dst} and {src} do not overlap in
+// a way that makes a vectorized loop observably different from the scalar
+// loop, i.e. an element of {src} must not be written through {dst} in an
+// earlier iteration of the same vector.
+bool MayVectorizeWithoutAliasing(Node* dst, Node* src) {
+  IntPtrMatcher mdst(dst);
+  IntPtrMatcher msrc(src);
+  if (!mdst.HasValue() || !msrc.HasValue()) return false;
+  intptr_t const distance = mdst.Value() - msrc.Value();
+  return distance <= 0 || distance >= kMaxVectorSize;
+}
+
+}  // namespace
+
+
+LoopVectorizer::LoopVectorizer(JSGraph* jsgraph, LoopTree* loop_tree)
+    : jsgraph_(jsgraph), loop_tree_(loop_tree), vectorized_count_(0) {}
+
+
+void LoopVectorizer::Optimize() {
+  for (LoopTree::Loop* loop : loop_tree()->outer_loops()) VisitLoop(loop);
+}
+
+
+void LoopVectorizer::VisitLoop(LoopTree::Loop* loop) {
+  if (loop->children().empty()) {
+    if (TryVectorize(loop)) vectorized_count_++;
+  } else {
+    for (LoopTree::Loop* child : loop->children()) VisitLoop(child);
+  }
+}
+
+
+bool LoopVectorizer::TryVectorize(LoopTree::Loop* loop) {
+  Node* const loop_node = loop_tree()->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return false;
+
+  // The loop header must consist of the induction variable {phi} and the
+  // {effect_phi} only.
+  Node* phi = nullptr;
+  Node* effect_phi = nullptr;
+  for (Node* node : loop_tree()->HeaderNodes(loop)) {
+    if (node == loop_node) continue;
+    if (node->opcode() == IrOpcode::kPhi && phi == nullptr) {
+      phi = node;
+    } else if (node->opcode() == IrOpcode::kEffectPhi &&
+               effect_phi == nullptr) {
+      effect_phi = node;
+    } else {
+      return false;
+    }
+  }
+  if (phi == nullptr || effect_phi == nullptr) return false;
+
+  // Match phi = Phi(start, phi + 1) with an integral constant {start}.
+  Node* const start = phi->InputAt(kAssumedLoopEntryIndex);
+  NumberMatcher mstart(start);
+  if (!mstart.HasValue() || mstart.Value() < 0.0 ||
+      mstart.Value() > kMaxInt ||
+      std::floor(mstart.Value()) != mstart.Value()) {
+    return false;
+  }
+  Node* const update = phi->InputAt(1);
+  if (update->opcode() != IrOpcode::kNumberAdd) return false;
+  NumberBinopMatcher mupdate(update);
+  if (mupdate.left().node() != phi || !mupdate.right().Is(1.0)) return false;
+  if (update->UseCount() != 1) return false;
+
+  // Collect the nodes in the loop body, which may contain only the loop
+  // condition, a stack check and the element accesses of the pattern.
+  Node* branch = nullptr;
+  Node* if_true = nullptr;
+  Node* stack_check = nullptr;
+  Node* store = nullptr;
+  Node* loads[2] = {nullptr, nullptr};
+  size_t load_count = 0;
+  for (Node* node : loop_tree()->BodyNodes(loop)) {
+    switch (node->opcode()) {
+      case IrOpcode::kBranch:
+        if (branch != nullptr) return false;
+        branch = node;
+        break;
+      case IrOpcode::kIfTrue:
+        if (if_true != nullptr) return false;
+        if_true = node;
+        break;
+      case IrOpcode::kJSStackCheck:
+        if (stack_check != nullptr) return false;
+        stack_check = node;
+        break;
+      case IrOpcode::kLoadElement:
+        if (load_count == arraysize(loads)) return false;
+        loads[load_count++] = node;
+        break;
+      case IrOpcode::kStoreElement:
+        if (store != nullptr) return false;
+        store = node;
+        break;
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kNumberAdd:
+      case IrOpcode::kNumberSubtract:
+      case IrOpcode::kNumberMultiply:
+      case IrOpcode::kNumberDivide:
+      case IrOpcode::kNumberBitwiseOr:
+      case IrOpcode::kFrameState:
+      case IrOpcode::kStateValues:
+      case IrOpcode::kTypedStateValues:
+        // Pure nodes, checked by the pattern below if relevant.
+        break;
+      default:
+        return false;
+    }
+  }
+  if (branch == nullptr || if_true == nullptr || store == nullptr) {
+    return false;
+  }
+
+  // Match the control structure: the condition is checked at the loop
+  // header, and the body is executed unconditionally.
+  if (NodeProperties::GetControlInput(branch) != loop_node ||
+      NodeProperties::GetControlInput(if_true) != branch) {
+    return false;
+  }
+  Node* const body = stack_check != nullptr ? stack_check : if_true;
+  if (stack_check != nullptr &&
+      NodeProperties::GetControlInput(stack_check) != if_true) {
+    return false;
+  }
+  if (loop_node->InputAt(1) != body) return false;
+  // The stack check is kept on the back edge of the vectorized loop, so it
+  // may not depend on the element accesses.
+  if (stack_check != nullptr &&
+      (IsInLoop(loop, NodeProperties::GetContextInput(stack_check)) ||
+       !IsStateOf(loop, NodeProperties::GetFrameStateInput(stack_check, 0),
+                  phi))) {
+    return false;
+  }
+
+  // Match the condition phi < end with an int32 {end} defined outside the
+  // loop.
+  Node* const condition = NodeProperties::GetValueInput(branch, 0);
+  if (condition->opcode() != IrOpcode::kNumberLessThan ||
+      NodeProperties::GetValueInput(condition, 0) != phi) {
+    return false;
+  }
+  Node* const end = NodeProperties::GetValueInput(condition, 1);
+  if (IsInLoop(loop, end) || !NodeProperties::IsTyped(end)) return false;
+  Type* const end_type = NodeProperties::GetType(end);
+  if (!end_type->Is(Type::Signed32())) return false;
+
+  // Match the store dst[i] = lhs[i] op rhs[i].
+  ArrayBinopKind kind;
+  Node* const value = NodeProperties::GetValueInput(store, 2);
+  if (!MatchArrayBinopKind(value, &kind) || value->UseCount() != 1) {
+    return false;
+  }
+  Node* const lhs = NodeProperties::GetValueInput(value, 0);
+  Node* const rhs = NodeProperties::GetValueInput(value, 1);
+  ElementAccess const& access = ElementAccessOf(store->op());
+  MachineRepresentation const rep = ArrayBinopRepresentationFor(access, kind);
+  if (rep == MachineRepresentation::kNone) return false;
+  Node* const dst = NodeProperties::GetValueInput(store, 0);
+  if (!IsIndexOf(NodeProperties::GetValueInput(store, 1), phi)) return false;
+  bool lhs_is_load = false;
+  bool rhs_is_load = false;
+  for (size_t i = 0; i < load_count; ++i) {
+    Node* const load = loads[i];
+    if (load != lhs && load != rhs) return false;
+    lhs_is_load |= load == lhs;
+    rhs_is_load |= load == rhs;
+    if (ArrayBinopRepresentationFor(ElementAccessOf(load->op()), kind) !=
+        rep) {
+      return false;
+    }
+    if (!IsIndexOf(NodeProperties::GetValueInput(load, 1), phi)) return false;
+    Node* const control = NodeProperties::GetControlInput(load);
+    if (control != if_true && control != body) return false;
+    if (!MayVectorizeWithoutAliasing(dst,
+                                     NodeProperties::GetValueInput(load, 0))) {
+      return false;
+    }
+  }
+  if (!lhs_is_load || !rhs_is_load) return false;
+  Node* const control = NodeProperties::GetControlInput(store);
+  if (control != if_true && control != body) return false;
+
+  // The effect chain must consist of the accesses and the stack check only.
+  size_t effect_count = 0;
+  for (Node* effect = NodeProperties::GetEffectInput(effect_phi, 1);
+       effect != effect_phi; effect = NodeProperties::GetEffectInput(effect)) {
+    if (effect != store && effect != stack_check && effect != lhs &&
+        effect != rhs) {
+      return false;
+    }
+    if (++effect_count > load_count + 2) return false;
+  }
+  if (effect_count != load_count + (stack_check != nullptr ? 2 : 1)) {
+    return false;
+  }
+
+  // Check the uses outside the loop. The loop must be left via the false
+  // branch of the loop condition, and the only value observable after the
+  // loop is the final value of {phi}.
+  Node* exit = nullptr;
+  for (Node* node : loop_tree()->LoopNodes(loop)) {
+    for (Edge edge : node->use_edges()) {
+      Node* const use = edge.from();
+      if (IsInLoop(loop, use)) continue;
+      if (use->opcode() == IrOpcode::kTerminate) continue;
+      if (node == branch && use->opcode() == IrOpcode::kIfFalse &&
+          exit == nullptr) {
+        exit = use;
+      } else if (node == effect_phi && NodeProperties::IsEffectEdge(edge)) {
+        continue;
+      } else if (node == phi ||
+                 (IsStateNode(node) && IsStateOf(loop, node, phi))) {
+        // State nodes can be shared with frame states after the loop.
+        continue;
+      } else {
+        return false;
+      }
+    }
+  }
+  if (exit == nullptr) return false;
+
+  const OptionalOperator op =
+      machine()->ArrayBinop(ArrayBinopParameters(rep, kind));
+  if (!op.IsSupported()) return false;
+
+  // Strip-mine the {loop}: each iteration now processes the elements from
+  // {phi} up to {next} = min(phi + kElementsPerStackCheck, end) with an
+  // ArrayBinop, so that the stack check on the back edge still polls for
+  // interrupts in long loops. {phi} takes the same values at the loop exit
+  // and at the stack check as in the scalar loop, so the frame states that
+  // refer to it stay valid.
+  Zone* const zone = graph()->zone();
+  double const max = std::max(mstart.Value(), end_type->Max());
+  Type* const index_type = Type::Range(mstart.Value(), max, zone);
+  NodeProperties::SetType(phi, index_type);
+  Node* const upper = graph()->NewNode(
+      simplified()->NumberAdd(), phi,
+      jsgraph()->Constant(kElementsPerStackCheck));
+  NodeProperties::SetType(
+      upper, Type::Range(mstart.Value() + kElementsPerStackCheck,
+                         max + kElementsPerStackCheck, zone));
+  Node* const in_range =
+      graph()->NewNode(simplified()->NumberLessThan(), upper, end);
+  NodeProperties::SetType(in_range, Type::Boolean());
+  Node* const next =
+      graph()->NewNode(common()->Select(MachineRepresentation::kTagged),
+                       in_range, upper, end);
+  NodeProperties::SetType(next, index_type);
+  phi->ReplaceInput(1, next);
+
+  Node* effect = effect_phi;
+  if (stack_check != nullptr) {
+    NodeProperties::ReplaceEffectInput(stack_check, effect);
+    effect = stack_check;
+  }
+  Node* const array_binop = graph()->NewNode(
+      op.op(), dst, NodeProperties::GetValueInput(lhs, 0),
+      NodeProperties::GetValueInput(rhs, 0), phi, next, effect, body);
+  effect_phi->ReplaceInput(1, array_binop);
+
+  // Disconnect the scalar loop body.
+  for (Node* node : {store, value, update, lhs, rhs}) node->NullAllInputs();
+  return true;
+}
+
+
+bool LoopVectorizer::IsInLoop(LoopTree::Loop* loop, Node* node) {
+  return loop_tree()->Contains(loop, node);
+}
+
+
+bool LoopVectorizer::IsStateOf(LoopTree::Loop* loop, Node* node, Node* phi) {
+  for (Node* input : node->inputs()) {
+    if (input == phi || !IsInLoop(loop, input)) continue;
+    if (!IsStateNode(input) || !IsStateOf(loop, input, phi)) return false;
+  }
+  return true;
+}
+
+
+Graph* LoopVectorizer::graph() const { return jsgraph()->graph(); }
+
+
+CommonOperatorBuilder* LoopVectorizer::common() const {
+  return jsgraph()->common();
+}
+
+
+MachineOperatorBuilder* LoopVectorizer::machine() const {
+  return jsgraph()->machine();
+}
+
+
+SimplifiedOperatorBuilder* LoopVectorizer::simplified() const {
+  return jsgraph()->simplified();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
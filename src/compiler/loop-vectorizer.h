@@ -0,0 +1,75 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZER_H_
+#define V8_COMPILER_LOOP_VECTORIZER_H_
+
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class CommonOperatorBuilder;
+class JSGraph;
+class MachineOperatorBuilder;
+class SimplifiedOperatorBuilder;
+
+// Replaces simple counted loops over typed arrays of the form
+//
+//   for (i = start; i < end; i++) dst[i] = lhs[i] op rhs[i];
+//
+// with a loop that processes a strip of elements per iteration with an
+// ArrayBinop machine operation, which the backend implements with SIMD
+// instructions. The stack check of the scalar loop is kept on the back edge
+// of the strip-mined loop, so that long loops still poll for interrupts.
+// This only applies to innermost loops whose typed array accesses are known
+// to be in bounds (cf. BoundsCheckElimination), where the element type is
+// float32 or float64 (op is one of +, -, * and /) or a 32-bit integer (op is
+// + or -), such that computing on the machine representation yields the
+// same results as the JavaScript semantics.
+//
+// The base addresses of the typed arrays must be constants, which allows us
+// to statically rule out overlaps between {dst} and the inputs that would
+// make the vectorized loop observably different from the scalar loop.
+class LoopVectorizer final {
+ public:
+  LoopVectorizer(JSGraph* jsgraph, LoopTree* loop_tree);
+
+  void Optimize();
+
+  // The number of loops vectorized by {Optimize}.
+  int vectorized_count() const { return vectorized_count_; }
+
+ private:
+  void VisitLoop(LoopTree::Loop* loop);
+  bool TryVectorize(LoopTree::Loop* loop);
+
+  // Returns true if {node} is defined inside {loop}.
+  bool IsInLoop(LoopTree::Loop* loop, Node* node);
+
+  // Returns true if the frame state {node} depends on no other value defined
+  // inside {loop} than {phi}.
+  bool IsStateOf(LoopTree::Loop* loop, Node* node, Node* phi);
+
+  Graph* graph() const;
+  CommonOperatorBuilder* common() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  LoopTree* loop_tree() const { return loop_tree_; }
+  MachineOperatorBuilder* machine() const;
+  SimplifiedOperatorBuilder* simplified() const;
+
+  JSGraph* const jsgraph_;
+  LoopTree* const loop_tree_;
+  int vectorized_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(LoopVectorizer);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZER_H_
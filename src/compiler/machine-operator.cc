@@ -68,6 +68,52 @@ MachineRepresentation AtomicStoreRepresentationOf(Operator const* op) {
   return OpParameter<MachineRepresentation>(op);
 }
 
+size_t hash_value(ArrayBinopKind kind) { return static_cast<size_t>(kind); }
+
+
+std::ostream& operator<<(std::ostream& os, ArrayBinopKind kind) {
+  switch (kind) {
+    case ArrayBinopKind::kAdd:
+      return os << "Add";
+    case ArrayBinopKind::kSub:
+      return os << "Sub";
+    case ArrayBinopKind::kMul:
+      return os << "Mul";
+    case ArrayBinopKind::kDiv:
+      return os << "Div";
+  }
+  UNREACHABLE();
+  return os;
+}
+
+
+bool operator==(ArrayBinopParameters lhs, ArrayBinopParameters rhs) {
+  return lhs.representation() == rhs.representation() &&
+         lhs.kind() == rhs.kind();
+}
+
+
+bool operator!=(ArrayBinopParameters lhs, ArrayBinopParameters rhs) {
+  return !(lhs == rhs);
+}
+
+
+size_t hash_value(ArrayBinopParameters params) {
+  return base::hash_combine(params.representation(), params.kind());
+}
+
+
+std::ostream& operator<<(std::ostream& os, ArrayBinopParameters params) {
+  return os << "(" << params.representation() << " : " << params.kind()
+            << ")";
+}
+
+
+ArrayBinopParameters const& ArrayBinopParametersOf(Operator const* op) {
+  DCHECK_EQ(IrOpcode::kArrayBinop, op->opcode());
+  return OpParameter<ArrayBinopParameters>(op);
+}
+
 #define PURE_OP_LIST(V)                                                       \
   V(Word32And, Operator::kAssociative | Operator::kCommutative, 2, 0, 1)      \
   V(Word32Or, Operator::kAssociative | Operator::kCommutative, 2, 0, 1)       \
@@ -410,6 +456,18 @@ MachineRepresentation AtomicStoreRepresentationOf(Operator const* op) {
   V(kWord16)                          \
   V(kWord32)
 
+#define ARRAY_BINOP_LIST(V) \
+  V(Float32, Add)             \
+  V(Float32, Sub)             \
+  V(Float32, Mul)             \
+  V(Float32, Div)             \
+  V(Float64, Add)             \
+  V(Float64, Sub)             \
+  V(Float64, Mul)             \
+  V(Float64, Div)             \
+  V(Word32, Add)              \
+  V(Word32, Sub)
+
 struct MachineOperatorGlobalCache {
 #define PURE(Name, properties, value_input_count, control_input_count,         \
              output_count)                                                     \
@@ -524,6 +582,20 @@ struct MachineOperatorGlobalCache {
   AtomicStore##Type##Operator kAtomicStore##Type;
   ATOMIC_REPRESENTATION_LIST(ATOMIC_STORE)
 #undef STORE
+
+#define ARRAY_BINOP(Rep, Kind)                                             \
+  struct ArrayBinop##Rep##Kind##Operator final                             \
+      : public Operator1<ArrayBinopParameters> {                           \
+    ArrayBinop##Rep##Kind##Operator()                                      \
+        : Operator1<ArrayBinopParameters>(                                 \
+              IrOpcode::kArrayBinop, Operator::kNoThrow, "ArrayBinop", 5,  \
+              1, 1, 0, 1, 0,                                               \
+              ArrayBinopParameters(MachineRepresentation::k##Rep,          \
+                                   ArrayBinopKind::k##Kind)) {}            \
+  };                                                                       \
+  ArrayBinop##Rep##Kind##Operator kArrayBinop##Rep##Kind;
+  ARRAY_BINOP_LIST(ARRAY_BINOP)
+#undef ARRAY_BINOP
 };
 
 
@@ -632,6 +704,20 @@ const Operator* MachineOperatorBuilder::CheckedStore(
   return nullptr;
 }
 
+const OptionalOperator MachineOperatorBuilder::ArrayBinop(
+    ArrayBinopParameters params) {
+  if (flags_ & kArrayBinop) {
+#define ARRAY_BINOP(Rep, Kind)                                       \
+  if (params.representation() == MachineRepresentation::k##Rep &&   \
+      params.kind() == ArrayBinopKind::k##Kind) {                    \
+    return OptionalOperator(&cache_.kArrayBinop##Rep##Kind);         \
+  }
+    ARRAY_BINOP_LIST(ARRAY_BINOP)
+#undef ARRAY_BINOP
+  }
+  return OptionalOperator(nullptr);
+}
+
 // On 32 bit platforms we need to get a reference to optional operators of
 // 64-bit instructions for later Int64Lowering, even though 32 bit platforms
 // don't support the original 64-bit instruction.
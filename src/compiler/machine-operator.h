@@ -80,6 +80,38 @@ MachineRepresentation StackSlotRepresentationOf(Operator const* op);
 
 MachineRepresentation AtomicStoreRepresentationOf(Operator const* op);
 
+// An ArrayBinop applies a binary operation element-wise to two arrays, i.e.
+// dst[i] = lhs[i] op rhs[i] for start <= i < end, where dst, lhs and rhs are
+// untagged base addresses.
+enum class ArrayBinopKind : uint8_t { kAdd, kSub, kMul, kDiv };
+
+size_t hash_value(ArrayBinopKind);
+
+std::ostream& operator<<(std::ostream&, ArrayBinopKind);
+
+class ArrayBinopParameters final {
+ public:
+  ArrayBinopParameters(MachineRepresentation representation,
+                       ArrayBinopKind kind)
+      : representation_(representation), kind_(kind) {}
+
+  MachineRepresentation representation() const { return representation_; }
+  ArrayBinopKind kind() const { return kind_; }
+
+ private:
+  MachineRepresentation representation_;
+  ArrayBinopKind kind_;
+};
+
+bool operator==(ArrayBinopParameters, ArrayBinopParameters);
+bool operator!=(ArrayBinopParameters, ArrayBinopParameters);
+
+size_t hash_value(ArrayBinopParameters);
+
+std::ostream& operator<<(std::ostream&, ArrayBinopParameters);
+
+ArrayBinopParameters const& ArrayBinopParametersOf(Operator const*);
+
 // Interface for building machine-level operators. These operators are
 // machine-level but machine-independent and thus define a language suitable
 // for generating code to run on architectures such as ia32, x64, arm, etc.
@@ -113,13 +145,14 @@ class MachineOperatorBuilder final : public ZoneObject {
     kWord64Popcnt = 1u << 19,
     kWord32ReverseBits = 1u << 20,
     kWord64ReverseBits = 1u << 21,
+    kArrayBinop = 1u << 22,
     kAllOptionalOps = kFloat32Max | kFloat32Min | kFloat64Max | kFloat64Min |
                       kFloat32RoundDown | kFloat64RoundDown | kFloat32RoundUp |
                       kFloat64RoundUp | kFloat32RoundTruncate |
                       kFloat64RoundTruncate | kFloat64RoundTiesAway |
                       kFloat32RoundTiesEven | kFloat64RoundTiesEven |
                       kWord32Ctz | kWord64Ctz | kWord32Popcnt | kWord64Popcnt |
-                      kWord32ReverseBits | kWord64ReverseBits
+                      kWord32ReverseBits | kWord64ReverseBits | kArrayBinop
   };
   typedef base::Flags<Flag, unsigned> Flags;
 
@@ -501,6 +534,10 @@ class MachineOperatorBuilder final : public ZoneObject {
   // checked-store heap, index, length, value
   const Operator* CheckedStore(CheckedStoreRepresentation);
 
+  // array-binop dst, lhs, rhs, start, end
+  // Only Add and Sub are available for kWord32.
+  const OptionalOperator ArrayBinop(ArrayBinopParameters);
+
   // atomic-load [base + index]
   const Operator* AtomicLoad(LoadRepresentation rep);
   // atomic-store [base + index], value
@@ -11,6 +11,11 @@ namespace compiler {
 bool InstructionScheduler::SchedulerSupported() { return false; }
 
 
+bool InstructionScheduler::SuperblockSchedulingSupported() {
+  return false;
+}
+
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   UNIMPLEMENTED();
@@ -21,6 +26,9 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   UNIMPLEMENTED();
 }
 
+
+int InstructionScheduler::GetIssueWidth() { UNIMPLEMENTED(); }
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -350,6 +350,7 @@
   V(LoadParentFramePointer)     \
   V(CheckedLoad)                \
   V(CheckedStore)               \
+  V(ArrayBinop)                 \
   V(Int32PairAdd)               \
   V(Int32PairSub)               \
   V(Int32PairMul)               \
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/compiler.h"
+#include "src/compiler/instruction.h"
 #include "src/compiler/pipeline-statistics.h"
 #include "src/compiler/zone-pool.h"
 
@@ -84,6 +85,38 @@ void PipelineStatistics::EndPhaseKind() {
 }
 
 
+void PipelineStatistics::RecordMoveStats(const InstructionSequence* code) {
+  CompilationStatistics::MoveStats stats;
+  for (const Instruction* instr : code->instructions()) {
+    for (int i = Instruction::FIRST_GAP_POSITION;
+         i <= Instruction::LAST_GAP_POSITION; ++i) {
+      const ParallelMove* moves =
+          instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+      if (moves == nullptr) continue;
+      for (const MoveOperands* move : *moves) {
+        if (move->IsEliminated() || move->IsRedundant()) continue;
+        const InstructionOperand& source = move->source();
+        bool to_register = move->destination().IsAnyRegister();
+        if (source.IsConstant() || source.IsImmediate()) {
+          stats.constant_moves_++;
+        } else if (source.IsAnyRegister()) {
+          if (to_register) {
+            stats.register_moves_++;
+          } else {
+            stats.spills_++;
+          }
+        } else if (to_register) {
+          stats.reloads_++;
+        } else {
+          stats.stack_moves_++;
+        }
+      }
+    }
+  }
+  compilation_stats_->RecordMoveStats(stats);
+}
+
+
 void PipelineStatistics::BeginPhase(const char* name) {
   DCHECK(InPhaseKind());
   phase_name_ = name;
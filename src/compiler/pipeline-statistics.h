@@ -16,6 +16,7 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+class InstructionSequence;
 class PhaseScope;
 
 class PipelineStatistics : public Malloced {
@@ -26,6 +27,10 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Records the gap moves in {code} after register allocation, classified
+  // into spills, reloads, register moves, stack moves and constant moves.
+  void RecordMoveStats(const InstructionSequence* code);
+
  private:
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
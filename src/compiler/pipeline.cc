@@ -11,11 +11,14 @@
 #include "src/base/platform/elapsed-timer.h"
 #include "src/compiler/ast-graph-builder.h"
 #include "src/compiler/ast-loop-assignment-analyzer.h"
+#include "src/compiler/allocation-folding.h"
 #include "src/compiler/basic-block-instrumentor.h"
+#include "src/compiler/bounds-check-elimination.h"
 #include "src/compiler/branch-elimination.h"
 #include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/change-lowering.h"
 #include "src/compiler/code-generator.h"
+#include "src/compiler/coloring-allocator.h"
 #include "src/compiler/common-operator-reducer.h"
 #include "src/compiler/control-flow-optimizer.h"
 #include "src/compiler/dead-code-elimination.h"
@@ -44,7 +47,9 @@
 #include "src/compiler/live-range-separator.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
+#include "src/compiler/loop-vectorizer.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/move-optimizer.h"
 #include "src/compiler/osr.h"
@@ -549,6 +554,13 @@ PipelineStatistics* CreatePipelineStatistics(CompilationInfo* info,
   return pipeline_statistics;
 }
 
+
+bool UseColoringAllocator(CompilationInfo* info) {
+  if (!FLAG_turbo_coloring_regalloc) return false;
+  if (!info->has_shared_info()) return true;
+  return info->shared_info()->PassesFilter(FLAG_turbo_coloring_regalloc_filter);
+}
+
 }  // namespace
 
 class PipelineCompilationJob final : public CompilationJob {
@@ -911,6 +923,41 @@ struct TypedLoweringPhase {
 };
 
 
+struct BoundsCheckEliminationPhase {
+  static const char* phase_name() { return "bounds check elimination"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    JSGraphReducer graph_reducer(data->jsgraph(), temp_zone);
+    BoundsCheckElimination bounds_check_elimination(&graph_reducer,
+                                                    data->jsgraph());
+    AddReducer(data, &graph_reducer, &bounds_check_elimination);
+    graph_reducer.ReduceGraph();
+  }
+};
+
+
+struct LoopInvariantCodeMotionPhase {
+  static const char* phase_name() { return "loop invariant code motion"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(data->graph(), temp_zone);
+    LoopInvariantCodeMotion licm(loop_tree, temp_zone);
+    licm.Optimize();
+  }
+};
+
+
+struct LoopVectorizationPhase {
+  static const char* phase_name() { return "loop vectorization"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(data->graph(), temp_zone);
+    LoopVectorizer vectorizer(data->jsgraph(), loop_tree);
+    vectorizer.Optimize();
+  }
+};
+
+
 struct BranchEliminationPhase {
   static const char* phase_name() { return "branch condition elimination"; }
 
@@ -1019,6 +1066,15 @@ struct EffectControlLinearizationPhase {
   }
 };
 
+struct AllocationFoldingPhase {
+  static const char* phase_name() { return "allocation folding"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    AllocationFolding allocation_folding(data->jsgraph(), temp_zone);
+    allocation_folding.Fold();
+  }
+};
+
 struct LateOptimizationPhase {
   static const char* phase_name() { return "late optimization"; }
 
@@ -1400,12 +1456,27 @@ bool PipelineImpl::CreateGraph() {
     Run<TypedLoweringPhase>();
     RunPrintAndVerify("Lowered typed");
 
+    if (FLAG_turbo_bce) {
+      Run<BoundsCheckEliminationPhase>();
+      RunPrintAndVerify("Bounds checks eliminated");
+    }
+
+    if (FLAG_turbo_licm) {
+      Run<LoopInvariantCodeMotionPhase>();
+      RunPrintAndVerify("Loop invariants hoisted");
+    }
+
+    if (FLAG_turbo_loop_vectorization) {
+      Run<LoopVectorizationPhase>();
+      RunPrintAndVerify("Loops vectorized");
+    }
+
     if (FLAG_turbo_stress_loop_peeling) {
       Run<StressLoopPeelingPhase>();
       RunPrintAndVerify("Loop peeled");
     }
 
-    if (FLAG_experimental_turbo_escape) {
+    if (FLAG_turbo_escape) {
       Run<EscapeAnalysisPhase>();
       RunPrintAndVerify("Escape Analysed");
     }
@@ -1458,6 +1529,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify("Control flow optimized", true);
   }
 
+  if (FLAG_turbo_allocation_folding) {
+    Run<AllocationFoldingPhase>();
+    RunPrintAndVerify("Allocations folded", true);
+  }
+
   // Lower changes that have been inserted before.
   Run<LateOptimizationPhase>();
   // TODO(jarin, rossberg): Remove UNTYPED once machine typing works.
@@ -1757,6 +1833,9 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   if (FLAG_turbo_greedy_regalloc) {
     Run<AllocateGeneralRegistersPhase<GreedyAllocator>>();
     Run<AllocateFPRegistersPhase<GreedyAllocator>>();
+  } else if (UseColoringAllocator(info())) {
+    Run<AllocateGeneralRegistersPhase<ColoringAllocator>>();
+    Run<AllocateFPRegistersPhase<ColoringAllocator>>();
   } else {
     Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
@@ -1778,6 +1857,10 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
 
   Run<LocateSpillSlotsPhase>();
 
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->RecordMoveStats(data->sequence());
+  }
+
   if (FLAG_trace_turbo_graph) {
     OFStream os(stdout);
     PrintableInstructionSequence printable = {config, data->sequence()};
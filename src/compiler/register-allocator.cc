@@ -2618,12 +2618,26 @@ void LinearScanAllocator::AllocateRegisters() {
 
   SplitAndSpillRangesDefinedByMemoryOperand(code()->VirtualRegisterCount() <=
                                             num_allocatable_registers());
+  AllocateRemainingRegisters();
+}
+
+
+void LinearScanAllocator::AllocateRemainingRegisters() {
+  DCHECK(unhandled_live_ranges().empty());
+  DCHECK(active_live_ranges().empty());
+  DCHECK(inactive_live_ranges().empty());
 
   for (TopLevelLiveRange* range : data()->live_ranges()) {
     if (!CanProcessRange(range)) continue;
     for (LiveRange* to_add = range; to_add != nullptr;
          to_add = to_add->next()) {
-      if (!to_add->spilled()) {
+      if (to_add->spilled()) continue;
+      if (to_add->is_precolored()) {
+        // Precolored ranges may start after the current position, just like
+        // fixed ranges, and are only ever processed as inactive or active.
+        DCHECK(to_add->HasRegisterAssigned());
+        AddToInactive(to_add);
+      } else {
         AddToUnhandledUnsorted(to_add);
       }
     }
@@ -3004,7 +3018,13 @@ void LinearScanAllocator::SplitAndSpillIntersecting(LiveRange* current) {
       LifetimePosition next_intersection = range->FirstIntersection(current);
       if (next_intersection.IsValid()) {
         UsePosition* next_pos = range->NextRegisterPosition(current->Start());
-        if (next_pos == nullptr) {
+        if (range->Start() > current->Start()) {
+          // Only precolored ranges are inactive before they start. Splitting
+          // them here would put parts with a register into unhandled, so let
+          // the whole range compete for a register again instead.
+          UncolorRange(range);
+          AddToUnhandledSorted(range);
+        } else if (next_pos == nullptr) {
           SpillAfter(range, split_pos);
         } else {
           next_intersection = Min(next_intersection, next_pos->pos());
@@ -3018,6 +3038,19 @@ void LinearScanAllocator::SplitAndSpillIntersecting(LiveRange* current) {
 }
 
 
+void LinearScanAllocator::UncolorRange(LiveRange* range) {
+  DCHECK(range->is_precolored());
+  TRACE("Uncoloring live range %d:%d\n", range->TopLevel()->vreg(),
+        range->relative_id());
+  range->set_precolored(false);
+  range->UnsetAssignedRegister();
+  range->UnsetUseHints();
+  if (range->IsTopLevel() && range->TopLevel()->is_phi()) {
+    data()->GetPhiMapValueFor(range->TopLevel())->UnsetAssignedRegister();
+  }
+}
+
+
 bool LinearScanAllocator::TryReuseSpillForPhi(TopLevelLiveRange* range) {
   if (!range->is_phi()) return false;
 
@@ -335,6 +335,14 @@ class LiveRange : public ZoneObject {
   bool spilled() const { return SpilledField::decode(bits_); }
   void Spill();
 
+  // A precolored range had its register chosen by an earlier allocation pass
+  // (cf. ColoringAllocator) and is handed to the LinearScanAllocator as if it
+  // had been allocated by it already.
+  bool is_precolored() const { return PrecoloredField::decode(bits_); }
+  void set_precolored(bool value) {
+    bits_ = PrecoloredField::update(bits_, value);
+  }
+
   RegisterKind kind() const;
 
   // Returns use position in this live range that follows both start
@@ -444,6 +452,7 @@ class LiveRange : public ZoneObject {
   typedef BitField<bool, 0, 1> SpilledField;
   typedef BitField<int32_t, 6, 6> AssignedRegisterField;
   typedef BitField<MachineRepresentation, 12, 8> RepresentationField;
+  typedef BitField<bool, 20, 1> PrecoloredField;
 
   // Unique among children and splinters of the same virtual register.
   int relative_id_;
@@ -1043,6 +1052,12 @@ class LinearScanAllocator final : public RegisterAllocator {
   // Phase 4: compute register assignments.
   void AllocateRegisters();
 
+  // Assigns registers to the ranges left over by an earlier allocation pass,
+  // whose precolored ranges start out as inactive. Unlike {AllocateRegisters}
+  // this expects ranges defined by memory operands to be split and spilled
+  // already.
+  void AllocateRemainingRegisters();
+
  private:
   ZoneVector<LiveRange*>& unhandled_live_ranges() {
     return unhandled_live_ranges_;
@@ -1085,6 +1100,9 @@ class LinearScanAllocator final : public RegisterAllocator {
 
   void SplitAndSpillIntersecting(LiveRange* range);
 
+  // Drops the register of a precolored range that has not started yet.
+  void UncolorRange(LiveRange* range);
+
   ZoneVector<LiveRange*> unhandled_live_ranges_;
   ZoneVector<LiveRange*> active_live_ranges_;
   ZoneVector<LiveRange*> inactive_live_ranges_;
@@ -1326,6 +1326,16 @@ class RepresentationSelector {
         SetOutput(node, MachineRepresentation::kNone);
         break;
       }
+      case IrOpcode::kArrayBinop: {
+        ProcessInput(node, 0, UseInfo::PointerInt());        // dst
+        ProcessInput(node, 1, UseInfo::PointerInt());        // lhs
+        ProcessInput(node, 2, UseInfo::PointerInt());        // rhs
+        ProcessInput(node, 3, UseInfo::TruncatingWord32());  // start
+        ProcessInput(node, 4, UseInfo::TruncatingWord32());  // end
+        ProcessRemainingInputs(node, 5);
+        SetOutput(node, MachineRepresentation::kNone);
+        break;
+      }
       case IrOpcode::kWord32Shr:
         // We output unsigned int32 for shift right because JavaScript.
         return VisitBinop(node, UseInfo::TruncatingWord32(),
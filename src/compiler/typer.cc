@@ -2543,6 +2543,11 @@ Type* Typer::Visitor::TypeCheckedStore(Node* node) {
   return nullptr;
 }
 
+Type* Typer::Visitor::TypeArrayBinop(Node* node) {
+  UNREACHABLE();
+  return nullptr;
+}
+
 Type* Typer::Visitor::TypeAtomicLoad(Node* node) { return Type::Any(); }
 
 Type* Typer::Visitor::TypeAtomicStore(Node* node) {
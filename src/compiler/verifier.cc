@@ -1025,6 +1025,7 @@ void Verifier::Visitor::Check(Node* node) {
     case IrOpcode::kLoadParentFramePointer:
     case IrOpcode::kCheckedLoad:
     case IrOpcode::kCheckedStore:
+    case IrOpcode::kArrayBinop:
     case IrOpcode::kAtomicLoad:
     case IrOpcode::kAtomicStore:
 
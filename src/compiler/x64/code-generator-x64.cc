@@ -7,6 +7,7 @@
 #include "src/ast/scopes.h"
 #include "src/compiler/code-generator-impl.h"
 #include "src/compiler/gap-resolver.h"
+#include "src/compiler/machine-operator.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/osr.h"
 #include "src/x64/assembler-x64.h"
@@ -601,6 +602,194 @@ class OutOfLineRecordWrite final : public OutOfLineCode {
     }                                                            \
   } while (false)
 
+namespace {
+
+// Assembles dst[i] = lhs[i] op rhs[i] for start <= i < end. The bulk of the
+// elements is processed by a vector loop (256-bit wide if AVX is available
+// and the elements are floating point, 128-bit wide otherwise), the
+// remaining elements are processed one at a time.
+void AssembleArrayBinop(MacroAssembler* masm, ArchOpcode opcode,
+                        ArrayBinopKind kind, Register dst, Register lhs,
+                        Register rhs, Register start, Register end,
+                        Register index, XMMRegister temp) {
+  ScaleFactor const scale =
+      opcode == kX64Float64ArrayBinop ? times_8 : times_4;
+  bool const use_avx =
+      opcode != kX64Int32ArrayBinop && CpuFeatures::IsSupported(AVX);
+  int const lanes = (use_avx ? 32 : 16) >> scale;
+  Operand const dst_operand(dst, index, scale, 0);
+  Operand const lhs_operand(lhs, index, scale, 0);
+  Operand const rhs_operand(rhs, index, scale, 0);
+  Label vector_loop, scalar, scalar_loop, done;
+
+  // Compare index against end - lanes in 64 bits. Neither this nor advancing
+  // the index can overflow, unlike computing index + lanes in 32 bits.
+  masm->movsxlq(index, start);
+  masm->movsxlq(kScratchRegister, end);
+  masm->subq(kScratchRegister, Immediate(lanes));
+  masm->cmpq(index, kScratchRegister);
+  masm->j(greater, &scalar);
+  masm->bind(&vector_loop);
+  if (use_avx) {
+    CpuFeatureScope avx_scope(masm, AVX);
+    Assembler::VectorLength const l = Assembler::kL256;
+    masm->vmovups(kScratchDoubleReg, lhs_operand, l);
+    if (opcode == kX64Float64ArrayBinop) {
+      switch (kind) {
+        case ArrayBinopKind::kAdd:
+          masm->vaddpd(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+        case ArrayBinopKind::kSub:
+          masm->vsubpd(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+        case ArrayBinopKind::kMul:
+          masm->vmulpd(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+        case ArrayBinopKind::kDiv:
+          masm->vdivpd(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+      }
+    } else {
+      switch (kind) {
+        case ArrayBinopKind::kAdd:
+          masm->vaddps(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+        case ArrayBinopKind::kSub:
+          masm->vsubps(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+        case ArrayBinopKind::kMul:
+          masm->vmulps(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+        case ArrayBinopKind::kDiv:
+          masm->vdivps(kScratchDoubleReg, kScratchDoubleReg, rhs_operand, l);
+          break;
+      }
+    }
+    masm->vmovups(dst_operand, kScratchDoubleReg, l);
+  } else {
+    // Legacy SSE instructions require aligned memory operands, so both
+    // operands are loaded into registers first.
+    masm->movups(kScratchDoubleReg, lhs_operand);
+    masm->movups(temp, rhs_operand);
+    switch (opcode) {
+      case kX64Float32ArrayBinop:
+        switch (kind) {
+          case ArrayBinopKind::kAdd:
+            masm->addps(kScratchDoubleReg, temp);
+            break;
+          case ArrayBinopKind::kSub:
+            masm->subps(kScratchDoubleReg, temp);
+            break;
+          case ArrayBinopKind::kMul:
+            masm->mulps(kScratchDoubleReg, temp);
+            break;
+          case ArrayBinopKind::kDiv:
+            masm->divps(kScratchDoubleReg, temp);
+            break;
+        }
+        break;
+      case kX64Float64ArrayBinop:
+        switch (kind) {
+          case ArrayBinopKind::kAdd:
+            masm->addpd(kScratchDoubleReg, temp);
+            break;
+          case ArrayBinopKind::kSub:
+            masm->subpd(kScratchDoubleReg, temp);
+            break;
+          case ArrayBinopKind::kMul:
+            masm->mulpd(kScratchDoubleReg, temp);
+            break;
+          case ArrayBinopKind::kDiv:
+            masm->divpd(kScratchDoubleReg, temp);
+            break;
+        }
+        break;
+      case kX64Int32ArrayBinop:
+        if (kind == ArrayBinopKind::kAdd) {
+          masm->paddd(kScratchDoubleReg, temp);
+        } else {
+          DCHECK_EQ(ArrayBinopKind::kSub, kind);
+          masm->psubd(kScratchDoubleReg, temp);
+        }
+        break;
+      default:
+        UNREACHABLE();
+        break;
+    }
+    masm->movups(dst_operand, kScratchDoubleReg);
+  }
+  masm->addq(index, Immediate(lanes));
+  masm->cmpq(index, kScratchRegister);
+  masm->j(less_equal, &vector_loop);
+  if (use_avx) {
+    // Avoid the AVX to SSE transition penalty in the scalar loop below.
+    CpuFeatureScope avx_scope(masm, AVX);
+    masm->vzeroupper();
+  }
+
+  masm->bind(&scalar);
+  masm->cmpl(index, end);
+  masm->j(greater_equal, &done);
+  masm->bind(&scalar_loop);
+  switch (opcode) {
+    case kX64Float32ArrayBinop:
+      masm->movss(kScratchDoubleReg, lhs_operand);
+      switch (kind) {
+        case ArrayBinopKind::kAdd:
+          masm->addss(kScratchDoubleReg, rhs_operand);
+          break;
+        case ArrayBinopKind::kSub:
+          masm->subss(kScratchDoubleReg, rhs_operand);
+          break;
+        case ArrayBinopKind::kMul:
+          masm->mulss(kScratchDoubleReg, rhs_operand);
+          break;
+        case ArrayBinopKind::kDiv:
+          masm->divss(kScratchDoubleReg, rhs_operand);
+          break;
+      }
+      masm->movss(dst_operand, kScratchDoubleReg);
+      break;
+    case kX64Float64ArrayBinop:
+      masm->movsd(kScratchDoubleReg, lhs_operand);
+      switch (kind) {
+        case ArrayBinopKind::kAdd:
+          masm->addsd(kScratchDoubleReg, rhs_operand);
+          break;
+        case ArrayBinopKind::kSub:
+          masm->subsd(kScratchDoubleReg, rhs_operand);
+          break;
+        case ArrayBinopKind::kMul:
+          masm->mulsd(kScratchDoubleReg, rhs_operand);
+          break;
+        case ArrayBinopKind::kDiv:
+          masm->divsd(kScratchDoubleReg, rhs_operand);
+          break;
+      }
+      masm->movsd(dst_operand, kScratchDoubleReg);
+      break;
+    case kX64Int32ArrayBinop:
+      masm->movl(kScratchRegister, lhs_operand);
+      if (kind == ArrayBinopKind::kAdd) {
+        masm->addl(kScratchRegister, rhs_operand);
+      } else {
+        DCHECK_EQ(ArrayBinopKind::kSub, kind);
+        masm->subl(kScratchRegister, rhs_operand);
+      }
+      masm->movl(dst_operand, kScratchRegister);
+      break;
+    default:
+      UNREACHABLE();
+      break;
+  }
+  masm->incl(index);
+  masm->cmpl(index, end);
+  masm->j(less, &scalar_loop);
+  masm->bind(&done);
+}
+
+}  // namespace
+
 void CodeGenerator::AssembleDeconstructFrame() {
   __ movq(rsp, rbp);
   __ popq(rbp);
@@ -1785,6 +1974,16 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
     case kX64StackCheck:
       __ CompareRoot(rsp, Heap::kStackLimitRootIndex);
       break;
+    case kX64Float32ArrayBinop:
+    case kX64Float64ArrayBinop:
+    case kX64Int32ArrayBinop:
+      AssembleArrayBinop(
+          masm(), arch_opcode,
+          static_cast<ArrayBinopKind>(MiscField::decode(instr->opcode())),
+          i.InputRegister(0), i.InputRegister(1), i.InputRegister(2),
+          i.InputRegister(3), i.InputRegister(4), i.TempRegister(0),
+          i.ToDoubleRegister(instr->TempAt(1)));
+      break;
     case kAtomicLoadInt8:
     case kAtomicLoadUint8:
     case kAtomicLoadInt16:
@@ -142,6 +142,9 @@ namespace compiler {
   V(X64Push)                       \
   V(X64Poke)                       \
   V(X64StackCheck)                 \
+  V(X64Float32ArrayBinop)          \
+  V(X64Float64ArrayBinop)          \
+  V(X64Int32ArrayBinop)            \
   V(X64Xchgb)                      \
   V(X64Xchgw)                      \
   V(X64Xchgl)
@@ -4,13 +4,91 @@
 
 #include "src/compiler/instruction-scheduler.h"
 
+#include "src/base/cpu.h"
+#include "src/base/lazy-instance.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Classes of instructions with distinct latencies.
+enum LatencyClass {
+  kIntegerAlu,
+  kIntegerMultiply,
+  kIntegerDivide,
+  kMemoryLoad,
+  kFloatAdd,
+  kFloatMultiply,
+  kFloatDivide,
+  kFloatSqrt,
+  kFloatConvert,
+  kFloatMove,
+  kLatencyClassCount
+};
+
+
+// Latencies (in cycles) and issue width of an x64 microarchitecture. The
+// numbers are rough approximations for the register forms of the
+// instructions, based on the vendors' optimization manuals.
+struct MicroArchitecture {
+  const char* name;
+  int issue_width;
+  int latencies[kLatencyClassCount];
+};
+
+
+const MicroArchitecture kMicroArchitectures[] = {
+    // name       width  alu mul div load fadd fmul fdiv sqrt cvt move
+    {"generic",   1,    {1,  3,  26, 4,   3,   5,   14,  18,  4,  1}},
+    {"core",      4,    {1,  3,  26, 5,   3,   5,   14,  18,  4,  1}},
+    {"atom",      2,    {1,  4,  30, 3,   3,   5,   27,  40,  5,  1}},
+    {"bulldozer", 2,    {1,  4,  40, 4,   5,   5,   20,  25,  6,  2}},
+    {"jaguar",    2,    {1,  3,  25, 3,   3,   4,   19,  27,  4,  1}}};
+
+
+// Selects the latency table for the CPU given by --mcpu, or the host CPU if
+// --mcpu=auto.
+const MicroArchitecture* SelectMicroArchitecture() {
+  const char* name = FLAG_mcpu;
+  if (strcmp(name, "auto") == 0) {
+    name = "generic";
+    base::CPU cpu;
+    if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 0x6) {
+      name = cpu.is_atom() ? "atom" : "core";
+    } else if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+               cpu.family() == 0xf) {
+      // AMD reports the families 15h and 16h as 0fh plus an extended family.
+      if (cpu.ext_family() == 0x6) name = "bulldozer";
+      if (cpu.ext_family() == 0x7) name = "jaguar";
+    }
+  }
+  for (const MicroArchitecture& arch : kMicroArchitectures) {
+    if (strcmp(arch.name, name) == 0) return &arch;
+  }
+  return &kMicroArchitectures[0];
+}
+
+
+struct MicroArchitectureModel {
+  MicroArchitectureModel() : arch(SelectMicroArchitecture()) {}
+  const MicroArchitecture* const arch;
+};
+
+
+base::LazyInstance<MicroArchitectureModel>::type kModel =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 
+bool InstructionScheduler::SuperblockSchedulingSupported() { return true; }
+
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
   switch (instr->arch_opcode()) {
@@ -36,10 +114,6 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
-    case kX64Idiv:
-    case kX64Idiv32:
-    case kX64Udiv:
-    case kX64Udiv32:
     case kX64Not:
     case kX64Not32:
     case kX64Neg:
@@ -134,6 +208,13 @@ int InstructionScheduler::GetTargetInstructionFlags(
           ? kNoOpcodeFlags
           : kIsLoadOperation | kHasSideEffect;
 
+    case kX64Idiv:
+    case kX64Idiv32:
+    case kX64Udiv:
+    case kX64Udiv32:
+      // Dividing by zero, or the minimum integer by -1, traps.
+      return kMayTrap;
+
     case kX64Movsxbl:
     case kX64Movzxbl:
     case kX64Movsxwl:
@@ -164,6 +245,11 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64StackCheck:
       return kIsLoadOperation;
 
+    case kX64Float32ArrayBinop:
+    case kX64Float64ArrayBinop:
+    case kX64Int32ArrayBinop:
+      return kIsLoadOperation | kHasSideEffect;
+
     case kX64Push:
     case kX64Poke:
       return kHasSideEffect;
@@ -186,8 +272,153 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // TODO(all): Add instruction cost modeling.
-  return 1;
+  const int* const latencies = kModel.Get().arch->latencies;
+  bool const has_memory_operand = instr->addressing_mode() != kMode_None;
+  LatencyClass latency_class = kIntegerAlu;
+  switch (instr->arch_opcode()) {
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxlq:
+    case kX64Movb:
+    case kX64Movw:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+      // Only loads have a latency, stores just occupy an issue slot.
+      return (has_memory_operand && instr->HasOutput())
+                 ? latencies[kMemoryLoad]
+                 : latencies[kIntegerAlu];
+
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+    case kCheckedLoadWord64:
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+      return latencies[kMemoryLoad];
+
+    case kX64Lea32:
+    case kX64Lea:
+      // The memory operand only describes the address computation.
+      return latencies[kIntegerAlu];
+
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+      latency_class = kIntegerMultiply;
+      break;
+
+    case kX64Idiv:
+    case kX64Idiv32:
+    case kX64Udiv:
+    case kX64Udiv32:
+      latency_class = kIntegerDivide;
+      break;
+
+    case kSSEFloat32Cmp:
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Round:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Round:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Max:
+    case kAVXFloat32Min:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Max:
+    case kAVXFloat64Min:
+      latency_class = kFloatAdd;
+      break;
+
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+      latency_class = kFloatMultiply;
+      break;
+
+    case kSSEFloat32Div:
+    case kSSEFloat64Div:
+    case kSSEFloat64Mod:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
+      latency_class = kFloatDivide;
+      break;
+
+    case kSSEFloat32Sqrt:
+    case kSSEFloat64Sqrt:
+      latency_class = kFloatSqrt;
+      break;
+
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToUint64:
+    case kSSEFloat32ToUint64:
+    case kSSEInt32ToFloat64:
+    case kSSEInt32ToFloat32:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+    case kSSEUint32ToFloat64:
+    case kSSEUint32ToFloat32:
+    case kArchTruncateDoubleToI:
+      latency_class = kFloatConvert;
+      break;
+
+    case kSSEFloat32Abs:
+    case kSSEFloat32Neg:
+    case kSSEFloat64Abs:
+    case kSSEFloat64Neg:
+    case kAVXFloat32Abs:
+    case kAVXFloat32Neg:
+    case kAVXFloat64Abs:
+    case kAVXFloat64Neg:
+    case kSSEFloat64ExtractLowWord32:
+    case kSSEFloat64ExtractHighWord32:
+    case kSSEFloat64InsertLowWord32:
+    case kSSEFloat64InsertHighWord32:
+    case kSSEFloat64LoadLowWord32:
+    case kX64BitcastFI:
+    case kX64BitcastDL:
+    case kX64BitcastIF:
+    case kX64BitcastLD:
+      latency_class = kFloatMove;
+      break;
+
+    default:
+      break;
+  }
+  // Instructions with a memory operand have to load it first.
+  return latencies[latency_class] +
+         (has_memory_operand ? latencies[kMemoryLoad] : 0);
+}
+
+
+int InstructionScheduler::GetIssueWidth() {
+  return kModel.Get().arch->issue_width;
 }
 
 }  // namespace compiler
@@ -374,6 +374,39 @@ void InstructionSelector::VisitCheckedStore(Node* node) {
 }
 
 
+void InstructionSelector::VisitArrayBinop(Node* node) {
+  ArrayBinopParameters const params = ArrayBinopParametersOf(node->op());
+  X64OperandGenerator g(this);
+  ArchOpcode opcode = kArchNop;
+  switch (params.representation()) {
+    case MachineRepresentation::kFloat32:
+      opcode = kX64Float32ArrayBinop;
+      break;
+    case MachineRepresentation::kFloat64:
+      opcode = kX64Float64ArrayBinop;
+      break;
+    case MachineRepresentation::kWord32:
+      opcode = kX64Int32ArrayBinop;
+      break;
+    default:
+      UNREACHABLE();
+      return;
+  }
+  // The inputs must stay live (and unclobbered by the temps) throughout the
+  // loops emitted for the instruction.
+  InstructionOperand inputs[] = {
+      g.UseUniqueRegister(node->InputAt(0)),
+      g.UseUniqueRegister(node->InputAt(1)),
+      g.UseUniqueRegister(node->InputAt(2)),
+      g.UseUniqueRegister(node->InputAt(3)),
+      g.UseUniqueRegister(node->InputAt(4))};
+  InstructionOperand temps[] = {g.TempRegister(), g.TempDoubleRegister()};
+  InstructionCode code =
+      opcode | MiscField::encode(static_cast<int>(params.kind()));
+  Emit(code, 0, nullptr, arraysize(inputs), inputs, arraysize(temps), temps);
+}
+
+
 // Shared routine for multiple binary operations.
 static void VisitBinop(InstructionSelector* selector, Node* node,
                        InstructionCode opcode, FlagsContinuation* cont) {
@@ -2076,7 +2109,8 @@ InstructionSelector::SupportedMachineOperatorFlags() {
       MachineOperatorBuilder::kFloat64Max |
       MachineOperatorBuilder::kFloat64Min |
       MachineOperatorBuilder::kWord32ShiftIsSafe |
-      MachineOperatorBuilder::kWord32Ctz | MachineOperatorBuilder::kWord64Ctz;
+      MachineOperatorBuilder::kWord32Ctz | MachineOperatorBuilder::kWord64Ctz |
+      MachineOperatorBuilder::kArrayBinop;
   if (CpuFeatures::IsSupported(POPCNT)) {
     flags |= MachineOperatorBuilder::kWord32Popcnt |
              MachineOperatorBuilder::kWord64Popcnt;
@@ -613,6 +613,9 @@ class RuntimeCallTimerScope {
   HT(parse, V8.ParseMicroSeconds, 1000000, MICROSECOND)                       \
   HT(parse_lazy, V8.ParseLazyMicroSeconds, 1000000, MICROSECOND)              \
   HT(pre_parse, V8.PreParseMicroSeconds, 1000000, MICROSECOND)                \
+  /* Main thread time saved by --streaming-analysis. */                       \
+  HT(streaming_analysis, V8.StreamingAnalysisMicroSeconds, 1000000,           \
+     MICROSECOND)                                                             \
   /* Compilation times. */                                                    \
   HT(compile, V8.CompileMicroSeconds, 1000000, MICROSECOND)                   \
   HT(compile_eval, V8.CompileEvalMicroSeconds, 1000000, MICROSECOND)          \
@@ -698,6 +701,7 @@ class RuntimeCallTimerScope {
   SC(script_wrappers, V8.ScriptWrappers)                              \
   SC(inlined_copied_elements, V8.InlinedCopiedElements)               \
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
+  SC(interpreter_direct_calls, V8.InterpreterDirectCalls)             \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
   /* Amount of evaled source code. */                                 \
@@ -809,7 +813,11 @@ class RuntimeCallTimerScope {
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
-  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
+  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)               \
+  /* Total count of functions whose bytecode was flushed. */                   \
+  SC(total_flushed_bytecode_count, V8.TotalFlushedBytecodeCount)               \
+  /* Total size (including metadata) of flushed bytecode. */                   \
+  SC(total_flushed_bytecode_size, V8.TotalFlushedBytecodeSize)
 
 // This file contains all the v8 counters that are in use.
 class Counters {
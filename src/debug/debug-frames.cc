@@ -4,6 +4,7 @@
 
 #include "src/debug/debug-frames.h"
 
+#include "src/compiler.h"
 #include "src/frames-inl.h"
 
 namespace v8 {
@@ -72,7 +73,13 @@ int FrameInspector::GetSourcePosition() {
     return deoptimized_frame_->GetSourcePosition();
   } else if (is_interpreted_) {
     InterpretedFrame* frame = reinterpret_cast<InterpretedFrame*>(frame_);
+    Handle<JSFunction> function(frame->function(), isolate_);
+    Compiler::EnsureSourcePositions(function);
     BytecodeArray* bytecode_array = frame->GetBytecodeArray();
+    if (!bytecode_array->HasSourcePositionTable()) {
+      // The table could not be collected, e.g. close to the stack limit.
+      return function->shared()->start_position();
+    }
     return bytecode_array->SourcePosition(frame->GetBytecodeOffset());
   } else {
     Code* code = frame_->LookupCode();
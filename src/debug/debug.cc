@@ -16,6 +16,7 @@
 #include "src/frames-inl.h"
 #include "src/full-codegen/full-codegen.h"
 #include "src/global-handles.h"
+#include "src/heap/incremental-marking.h"
 #include "src/interpreter/interpreter.h"
 #include "src/isolate-inl.h"
 #include "src/list.h"
@@ -184,7 +185,7 @@ BreakLocation::BytecodeArrayIterator::BytecodeArrayIterator(
     : Iterator(debug_info),
       source_position_iterator_(debug_info->abstract_code()
                                     ->GetBytecodeArray()
-                                    ->source_position_table()),
+                                    ->SourcePositionTable()),
       break_locator_type_(type),
       start_position_(debug_info->shared()->start_position()) {
   // There is at least one break location.
@@ -1533,6 +1534,12 @@ bool Debug::EnsureDebugInfo(Handle<SharedFunctionInfo> shared,
   }
 
   if (shared->HasBytecodeArray()) {
+    // Break locations are found through the source position table, which
+    // the debug copy of the bytecode shares with the original.
+    bool has_source_positions =
+        function.is_null() ? Compiler::EnsureSourcePositions(shared)
+                           : Compiler::EnsureSourcePositions(function);
+    if (!has_source_positions) return false;
     // To prepare bytecode for debugging, we already need to have the debug
     // info (containing the debug copy) upfront, but since we do not recompile,
     // preparing for break points cannot fail.
@@ -1551,6 +1558,12 @@ void Debug::CreateDebugInfo(Handle<SharedFunctionInfo> shared) {
   DCHECK(shared->HasDebugCode());
   Handle<DebugInfo> debug_info = isolate_->factory()->NewDebugInfo(shared);
 
+  // The original bytecode array must survive, so make sure a pending decision
+  // to flush it is revisited.
+  if (shared->HasBytecodeArray()) {
+    isolate_->heap()->incremental_marking()->IterateBlackObject(*shared);
+  }
+
   // Add debug info to the list.
   DebugInfoListNode* node = new DebugInfoListNode(*debug_info);
   node->set_next(debug_info_list_);
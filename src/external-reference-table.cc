@@ -61,6 +61,11 @@ ExternalReferenceTable::ExternalReferenceTable(Isolate* isolate) {
       "Interpreter::dispatch_table_address");
   Add(ExternalReference::interpreter_dispatch_counters(isolate).address(),
       "Interpreter::interpreter_dispatch_counters");
+  Add(ExternalReference::interpreter_handler_statistics(isolate).address(),
+      "Interpreter::handler_statistics");
+  Add(ExternalReference::interpreter_sample_bytecode_handler_function(isolate)
+          .address(),
+      "Interpreter::SampleBytecodeHandler");
   Add(ExternalReference::address_of_negative_infinity().address(),
       "LDoubleConstant::negative_infinity");
   Add(ExternalReference::power_double_double_function(isolate).address(),
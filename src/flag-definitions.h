@@ -290,6 +290,28 @@ DEFINE_BOOL(ignition_eager, true, "eagerly compile and parse with ignition")
 DEFINE_BOOL(ignition_generators, false,
             "enable experimental ignition support for generators")
 DEFINE_STRING(ignition_filter, "*", "filter for ignition interpreter")
+DEFINE_BOOL(ignition_peephole, true, "use ignition peephole optimizer")
+DEFINE_BOOL(ignition_reo, false, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse loads and register stores into single ignition bytecodes")
+DEFINE_BOOL(ignition_inline_ics, true,
+            "call monomorphic IC handlers directly from ignition bytecode "
+            "handlers")
+DEFINE_BOOL(ignition_osr, false, "enable support for OSR from ignition code")
+DEFINE_BOOL(ignition_lazy_source_positions, false,
+            "omit source position tables from ignition bytecode and collect "
+            "them when they are first needed")
+DEFINE_BOOL(ignition_threaded_dispatch, false,
+            "dispatch the bytecode of hot functions through threaded code "
+            "that maps bytecode offsets directly to handlers")
+DEFINE_INT(ignition_threaded_dispatch_ticks, 1,
+           "number of profiler ticks before the bytecode of a function is "
+           "threaded")
+DEFINE_BOOL(ignition_baseline, false,
+            "compile the bytecode of hot functions to baseline code instead "
+            "of recompiling them with full-codegen")
+DEFINE_BOOL(trace_ignition_baseline, false,
+            "trace baseline compilation of bytecode")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(trace_ignition, false,
@@ -302,6 +324,11 @@ DEFINE_BOOL(trace_ignition_dispatches, false,
 DEFINE_STRING(trace_ignition_dispatches_output_file, nullptr,
               "the file to which the bytecode handler dispatch table is "
               "written (by default, the table is not written to a file)")
+DEFINE_BOOL(ignition_handler_statistics, false,
+            "instrument bytecode handlers to count executions and sample "
+            "cycles while the embedder collects handler statistics")
+DEFINE_INT(ignition_handler_sample_interval, 1000,
+           "number of bytecode handler executions between cycle samples")
 
 // Flags for Crankshaft.
 DEFINE_BOOL(crankshaft, true, "use crankshaft")
@@ -410,6 +437,11 @@ DEFINE_IMPLICATION(turbo, turbo_asm_deoptimization)
 DEFINE_BOOL(turbo_shipping, true, "enable TurboFan compiler on subset")
 DEFINE_BOOL(turbo_from_bytecode, false, "enable building graphs from bytecode")
 DEFINE_BOOL(turbo_greedy_regalloc, false, "use the greedy register allocator")
+DEFINE_BOOL(turbo_coloring_regalloc, false,
+            "use the graph coloring register allocator")
+DEFINE_STRING(turbo_coloring_regalloc_filter, "*",
+              "filter for functions using the graph coloring register "
+              "allocator")
 DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
@@ -451,14 +483,25 @@ DEFINE_BOOL(turbo_osr, true, "enable OSR in TurboFan")
 DEFINE_BOOL(turbo_stress_loop_peeling, false,
             "stress loop peeling optimization")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
+DEFINE_BOOL(turbo_bce, true,
+            "eliminate bounds checks of typed array accesses in loops")
+DEFINE_BOOL(turbo_licm, true, "hoist loop invariant loads in TurboFan")
+DEFINE_BOOL(trace_turbo_licm, false,
+            "trace TurboFan's loop invariant code motion")
+DEFINE_BOOL(turbo_loop_vectorization, true,
+            "vectorize simple loops over typed arrays in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_cache_shared_code, true, "cache context-independent code")
 DEFINE_BOOL(turbo_preserve_shared_code, false, "keep context-independent code")
-DEFINE_BOOL(experimental_turbo_escape, false, "enable escape analysis")
+DEFINE_BOOL(turbo_escape, false, "enable escape analysis")
+DEFINE_BOOL(turbo_allocation_folding, false,
+            "fold adjacent young space allocations in TurboFan")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
+DEFINE_BOOL(turbo_superblock_scheduling, true,
+            "schedule instructions across fallthrough blocks")
 
 // Flags for native WebAssembly.
 DEFINE_BOOL(expose_wasm, false, "expose WASM interface to JavaScript")
@@ -589,6 +632,12 @@ DEFINE_BOOL(trace_stub_failures, false,
 DEFINE_BOOL(serialize_toplevel, true, "enable caching of toplevel scripts")
 DEFINE_BOOL(serialize_eager, false, "compile eagerly when caching scripts")
 DEFINE_BOOL(serialize_age_code, false, "pre age code in the code cache")
+DEFINE_BOOL(shared_code_cache, false,
+            "share the code of toplevel scripts between isolates")
+DEFINE_INT(shared_code_cache_min_source_size, 1 * KB,
+           "minimum source length of scripts in the shared code cache")
+DEFINE_INT(shared_code_cache_max_size, 32,
+           "maximum size of the shared code cache (in Mbytes)")
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
 
 // compiler.cc
@@ -685,6 +734,9 @@ DEFINE_BOOL(weak_embedded_maps_in_optimized_code, true,
 DEFINE_BOOL(weak_embedded_objects_in_optimized_code, true,
             "make objects embedded in optimized code weak")
 DEFINE_BOOL(flush_code, true, "flush code that we expect not to use again")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush bytecode that we expect not to use again (requires code "
+            "flushing)")
 DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
@@ -786,6 +838,16 @@ DEFINE_BOOL(trace_maps, false, "trace map creation")
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
 DEFINE_BOOL(trace_parse, false, "trace parsing and preparsing")
+DEFINE_BOOL(streaming_analysis, false,
+            "rewrite streamed scripts and analyze their scopes on the "
+            "background thread that parses them (AST numbering and code "
+            "generation stay on the main thread)")
+DEFINE_BOOL(parallel_preparse, false,
+            "preparse lazy functions of large scripts on background threads")
+DEFINE_INT(parallel_preparse_min_source_size, 64 * KB,
+           "minimum script length for preparsing in parallel")
+DEFINE_INT(parallel_preparse_tasks, 4,
+           "maximum number of background tasks preparsing a script")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_BOOL(trace_sim, false, "Trace simulator execution")
@@ -825,6 +887,9 @@ DEFINE_BOOL(randomize_hashes, true,
 DEFINE_INT(hash_seed, 0,
            "Fixed seed to use to hash property keys (0 means random)"
            "(with snapshots this option cannot override the baked-in seed)")
+DEFINE_INT(zone_segment_pool_size, 0,
+           "maximum size of the freed zone segments an isolate keeps for "
+           "reuse (in kBytes)")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
@@ -867,6 +932,7 @@ DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sweeping)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compaction)
+DEFINE_NEG_IMPLICATION(predictable, parallel_preparse)
 DEFINE_NEG_IMPLICATION(predictable, memory_reducer)
 
 // mark-compact.cc
@@ -460,6 +460,9 @@ StackFrame::Type StackFrame::ComputeType(const StackFrameIteratorBase* iterator,
           return JAVA_SCRIPT;
         case Code::OPTIMIZED_FUNCTION:
           return OPTIMIZED;
+        case Code::BASELINE_FUNCTION:
+          // Baseline code compiled from bytecode runs in interpreter frames.
+          return INTERPRETED;
         case Code::WASM_FUNCTION:
           return WASM;
         case Code::WASM_TO_JS_FUNCTION:
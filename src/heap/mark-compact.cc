@@ -1038,6 +1038,49 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
 }
 
 
+void CodeFlusher::ProcessBytecodeCandidates() {
+  Code* lazy_compile = isolate_->builtins()->builtin(Builtins::kCompileLazy);
+  Counters* counters = isolate_->counters();
+
+  for (int i = 0; i < bytecode_candidates_.length(); i++) {
+    SharedFunctionInfo* candidate = bytecode_candidates_[i];
+    // Skip duplicate entries for bytecode that was flushed already.
+    if (!candidate->HasBytecodeArray()) continue;
+
+    BytecodeArray* bytecode = candidate->bytecode_array();
+    MarkBit bytecode_mark = Marking::MarkBitFrom(bytecode);
+    if (Marking::IsWhite(bytecode_mark)) {
+      if (FLAG_trace_code_flushing) {
+        PrintF("[bytecode-flushing clears: ");
+        candidate->ShortPrint();
+        PrintF(" - age: %d]\n", bytecode->bytecode_age());
+      }
+      DCHECK(!candidate->HasDebugInfo());
+      counters->total_flushed_bytecode_count()->Increment();
+      counters->total_flushed_bytecode_size()->Increment(
+          bytecode->BytecodeArraySize() + bytecode->constant_pool()->Size());
+      // Always flush the optimized code map if there is one.
+      if (!candidate->OptimizedCodeMapIsCleared()) {
+        candidate->ClearOptimizedCodeMap();
+      }
+      candidate->ClearBytecodeArray();
+      candidate->set_code(lazy_compile);
+    }
+
+    Object** data_slot = HeapObject::RawField(
+        candidate, SharedFunctionInfo::kFunctionDataOffset);
+    isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, data_slot,
+                                                           *data_slot);
+    Object** code_slot =
+        HeapObject::RawField(candidate, SharedFunctionInfo::kCodeOffset);
+    isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, code_slot,
+                                                           *code_slot);
+  }
+
+  bytecode_candidates_.Rewind(0);
+}
+
+
 void CodeFlusher::EvictCandidate(SharedFunctionInfo* shared_info) {
   // Make sure previous flushing decisions are revisited.
   isolate_->heap()->incremental_marking()->IterateBlackObject(shared_info);
@@ -1332,6 +1375,10 @@ class SharedFunctionInfoMarkingVisitor : public ObjectVisitor {
       MarkBit shared_mark = Marking::MarkBitFrom(shared);
       MarkBit code_mark = Marking::MarkBitFrom(shared->code());
       collector_->MarkObject(shared->code(), code_mark);
+      if (shared->HasBytecodeArray()) {
+        BytecodeArray* bytecode = shared->bytecode_array();
+        collector_->MarkObject(bytecode, Marking::MarkBitFrom(bytecode));
+      }
       collector_->MarkObject(shared, shared_mark);
     }
   }
@@ -1357,6 +1404,13 @@ void MarkCompactCollector::PrepareThreadForCodeFlushing(Isolate* isolate,
       MarkBit optimized_code_mark = Marking::MarkBitFrom(optimized_code);
       MarkObject(optimized_code, optimized_code_mark);
     }
+    if (frame->is_interpreted()) {
+      InterpretedFrame* interpreted_frame =
+          reinterpret_cast<InterpretedFrame*>(frame);
+      BytecodeArray* bytecode = interpreted_frame->GetBytecodeArray();
+      MarkBit bytecode_mark = Marking::MarkBitFrom(bytecode);
+      MarkObject(bytecode, bytecode_mark);
+    }
   }
 }
 
@@ -268,6 +268,8 @@ class MarkingDeque {
 // be unreachable. Code objects can be referenced in two ways:
 //    - SharedFunctionInfo references unoptimized code.
 //    - JSFunction references either unoptimized or optimized code.
+// SharedFunctionInfo also references bytecode, which is flushed the same way
+// and is retained by optimized code that can deoptimize to it.
 // We are not allowed to flush unoptimized code for functions that got
 // optimized or inlined into optimized code, because we might bailout
 // into the unoptimized code again during deoptimization.
@@ -280,6 +282,7 @@ class CodeFlusher {
 
   inline void AddCandidate(SharedFunctionInfo* shared_info);
   inline void AddCandidate(JSFunction* function);
+  inline void AddBytecodeCandidate(SharedFunctionInfo* shared_info);
 
   void EvictCandidate(SharedFunctionInfo* shared_info);
   void EvictCandidate(JSFunction* function);
@@ -287,6 +290,7 @@ class CodeFlusher {
   void ProcessCandidates() {
     ProcessSharedFunctionInfoCandidates();
     ProcessJSFunctionCandidates();
+    ProcessBytecodeCandidates();
   }
 
   void IteratePointersToFromSpace(ObjectVisitor* v);
@@ -294,6 +298,7 @@ class CodeFlusher {
  private:
   void ProcessJSFunctionCandidates();
   void ProcessSharedFunctionInfoCandidates();
+  void ProcessBytecodeCandidates();
 
   static inline JSFunction** GetNextCandidateSlot(JSFunction* candidate);
   static inline JSFunction* GetNextCandidate(JSFunction* candidate);
@@ -311,6 +316,10 @@ class CodeFlusher {
   Isolate* isolate_;
   JSFunction* jsfunction_candidates_head_;
   SharedFunctionInfo* shared_function_info_candidates_head_;
+  // Bytecode candidates cannot be linked through their code object, which is
+  // the interpreter entry trampoline. A candidate might be added more than
+  // once if its flushing decision is revisited.
+  List<SharedFunctionInfo*> bytecode_candidates_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeFlusher);
 };
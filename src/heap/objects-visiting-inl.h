@@ -447,6 +447,10 @@ void StaticMarkingVisitor<StaticVisitor>::VisitCode(Map* map,
   if (FLAG_age_code && !heap->isolate()->serializer_enabled()) {
     code->MakeOlder(heap->mark_compact_collector()->marking_parity());
   }
+  if (code->kind() == Code::OPTIMIZED_FUNCTION && FLAG_flush_bytecode &&
+      heap->mark_compact_collector()->is_code_flushing_enabled()) {
+    MarkDeoptimizationBytecode(heap, code);
+  }
   CodeBodyVisitor::Visit(map, object);
 }
 
@@ -482,6 +486,15 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
       VisitSharedFunctionInfoWeakCode(heap, object);
       return;
     }
+    if (IsFlushableBytecode(heap, shared)) {
+      // Closures of this function share the interpreter entry trampoline,
+      // which heals them once the bytecode is gone, so the decision only
+      // depends on whether anything else retains the bytecode.
+      collector->code_flusher()->AddBytecodeCandidate(shared);
+      // Treat the reference to the bytecode array weakly.
+      VisitSharedFunctionInfoWeakBytecode(heap, object);
+      return;
+    }
   }
   VisitSharedFunctionInfoStrongCode(heap, object);
 }
@@ -541,6 +554,10 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSArrayBuffer(
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitBytecodeArray(
     Map* map, HeapObject* object) {
+  Heap* heap = map->GetHeap();
+  if (FLAG_age_code && !heap->isolate()->serializer_enabled()) {
+    BytecodeArray::cast(object)->MakeOlder();
+  }
   StaticVisitor::VisitPointers(
       map->GetHeap(), object,
       HeapObject::RawField(object, BytecodeArray::kConstantPoolOffset),
@@ -683,6 +700,76 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
 }
 
 
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsFlushableBytecode(
+    Heap* heap, SharedFunctionInfo* shared_info) {
+  if (!FLAG_flush_bytecode || !shared_info->HasBytecodeArray()) {
+    return false;
+  }
+
+  // Bytecode is either on stack, in compilation cache or referenced by
+  // optimized code which deoptimizes to it.
+  BytecodeArray* bytecode = shared_info->bytecode_array();
+  MarkBit bytecode_mark = Marking::MarkBitFrom(bytecode);
+  if (Marking::IsBlackOrGrey(bytecode_mark)) {
+    return false;
+  }
+
+  // The source code must be available to be able to recompile the function
+  // in case we need it again.
+  if (!HasSourceCode(heap, shared_info)) {
+    return false;
+  }
+
+  // Closures only heal themselves if they run the interpreter entry
+  // trampoline.
+  if (shared_info->code() !=
+      heap->isolate()->builtins()->builtin(
+          Builtins::kInterpreterEntryTrampoline)) {
+    return false;
+  }
+
+  // The same restrictions as for flushing unoptimized code apply.
+  if (!shared_info->allows_lazy_compilation() || shared_info->is_generator() ||
+      shared_info->is_toplevel() || shared_info->IsBuiltin() ||
+      shared_info->dont_flush()) {
+    return false;
+  }
+
+  // The debugger holds on to the original bytecode array.
+  if (shared_info->HasDebugInfo()) {
+    return false;
+  }
+
+  // Check age of bytecode. If code aging is disabled we never flush.
+  if (!FLAG_age_code || !bytecode->IsOld()) {
+    return false;
+  }
+
+  return true;
+}
+
+
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::MarkDeoptimizationBytecode(
+    Heap* heap, Code* code) {
+  DCHECK_EQ(Code::OPTIMIZED_FUNCTION, code->kind());
+  FixedArray* raw_data = FixedArray::cast(code->deoptimization_data());
+  if (raw_data->length() == 0) return;
+  DeoptimizationInputData* data = DeoptimizationInputData::cast(raw_data);
+  FixedArray* literals = data->LiteralArray();
+  int inlined_count = data->InlinedFunctionCount()->value();
+  for (int i = -1; i < inlined_count; ++i) {
+    Object* shared = i < 0 ? data->SharedFunctionInfo() : literals->get(i);
+    if (!shared->IsSharedFunctionInfo()) continue;
+    SharedFunctionInfo* shared_info = SharedFunctionInfo::cast(shared);
+    if (shared_info->HasBytecodeArray()) {
+      StaticVisitor::MarkObject(heap, shared_info->bytecode_array());
+    }
+  }
+}
+
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoStrongCode(
     Heap* heap, HeapObject* object) {
@@ -715,6 +802,22 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakCode(
 }
 
 
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakBytecode(
+    Heap* heap, HeapObject* object) {
+  Object** start_slot = HeapObject::RawField(
+      object, SharedFunctionInfo::BodyDescriptor::kStartOffset);
+  Object** data_slot =
+      HeapObject::RawField(object, SharedFunctionInfo::kFunctionDataOffset);
+  Object** end_slot = HeapObject::RawField(
+      object, SharedFunctionInfo::BodyDescriptor::kEndOffset);
+
+  // Skip visiting kFunctionDataOffset as it is treated weakly here.
+  StaticVisitor::VisitPointers(heap, object, start_slot, data_slot);
+  StaticVisitor::VisitPointers(heap, object, data_slot + 1, end_slot);
+}
+
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitJSFunctionStrongCode(
     Map* map, HeapObject* object) {
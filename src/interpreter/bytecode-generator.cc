@@ -7,11 +7,14 @@
 #include "src/ast/scopes.h"
 #include "src/code-stubs.h"
 #include "src/compiler.h"
+#include "src/debug/debug.h"
 #include "src/interpreter/bytecode-register-allocator.h"
 #include "src/interpreter/control-flow-builders.h"
+#include "src/log.h"
 #include "src/objects.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/token.h"
+#include "src/profiler/cpu-profiler.h"
 
 namespace v8 {
 namespace internal {
@@ -555,13 +558,34 @@ class BytecodeGenerator::RegisterResultScope final
   Register result_register_;
 };
 
+namespace {
+
+SourcePositionTableBuilder::RecordingMode SourcePositionRecordingMode(
+    CompilationInfo* info) {
+  // Top-level and eval code is not regenerated, and the table is needed
+  // straight away whenever the debugger or a code event listener is active.
+  Isolate* isolate = info->isolate();
+  if (!FLAG_ignition_lazy_source_positions ||
+      info->is_collecting_source_positions() ||
+      info->parse_info()->is_toplevel() || info->parse_info()->is_eval() ||
+      isolate->debug()->is_active() ||
+      isolate->logger()->is_logging_code_events() ||
+      isolate->cpu_profiler()->is_profiling()) {
+    return SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
+  }
+  return SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS;
+}
+
+}  // namespace
+
 BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
     : isolate_(info->isolate()),
       zone_(info->zone()),
       builder_(new (zone()) BytecodeArrayBuilder(
           info->isolate(), info->zone(), info->num_parameters_including_this(),
           info->scope()->MaxNestedContextChainLength(),
-          info->scope()->num_stack_slots(), info->literal())),
+          info->scope()->num_stack_slots(), info->literal(),
+          SourcePositionRecordingMode(info))),
       info_(info),
       scope_(info->scope()),
       globals_(0, info->zone()),
@@ -572,7 +596,8 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
       generator_resume_points_(info->literal()->yield_count(), info->zone()),
       generator_state_(),
       try_catch_nesting_level_(0),
-      try_finally_nesting_level_(0) {
+      try_finally_nesting_level_(0),
+      loop_depth_(0) {
   InitializeAstVisitor(isolate());
 }
 
@@ -677,6 +702,15 @@ void BytecodeGenerator::VisitIterationHeader(IterationStatement* stmt,
 
   loop_builder->LoopHeader(&resume_points_in_loop);
 
+  // Insert an explicit {OsrPoll} right after the loop header, to trigger
+  // on-stack replacement when armed for the given loop nesting depth. It is
+  // a separate bytecode, so that the generated bytecode only changes with
+  // --ignition-osr.
+  if (FLAG_ignition_osr && !IsGeneratorFunction(info()->literal()->kind())) {
+    int level = Min(loop_depth_, Code::kMaxLoopNestingMarker);
+    builder()->OsrPoll(level);
+  }
+
   if (stmt->yield_count() > 0) {
     // If we are not resuming, fall through to loop body.
     // If we are resuming, perform state dispatch.
@@ -1035,7 +1069,9 @@ void BytecodeGenerator::VisitIterationBody(IterationStatement* stmt,
                                            LoopBuilder* loop_builder) {
   ControlScopeForIteration execution_control(this, stmt, loop_builder);
   builder()->StackCheck(stmt->position());
+  loop_depth_++;
   Visit(stmt->body());
+  loop_depth_--;
   loop_builder->SetContinueTarget();
 }
 
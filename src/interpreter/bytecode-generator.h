@@ -212,6 +212,7 @@ class BytecodeGenerator final : public AstVisitor {
   Register generator_state_;
   int try_catch_nesting_level_;
   int try_finally_nesting_level_;
+  int loop_depth_;
 };
 
 }  // namespace interpreter
@@ -0,0 +1,232 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/interpreter/bytecode-peephole-optimizer.h"
+
+#include "src/flags.h"
+#include "src/interpreter/constant-array-builder.h"
+#include "src/objects-inl.h"
+#include "src/objects.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+namespace {
+
+// Returns the bytecode which loads the same value as |bytecode| into a
+// register operand instead of the accumulator, or Bytecode::kIllegal if
+// there is none.
+Bytecode GetRegisterLoadForm(Bytecode bytecode) {
+  switch (bytecode) {
+    case Bytecode::kLdaUndefined:
+      return Bytecode::kLdrUndefined;
+    case Bytecode::kLdaGlobal:
+      return Bytecode::kLdrGlobal;
+    case Bytecode::kLdaContextSlot:
+      return Bytecode::kLdrContextSlot;
+    case Bytecode::kLoadIC:
+      return Bytecode::kLdrNamedProperty;
+    case Bytecode::kKeyedLoadIC:
+      return Bytecode::kLdrKeyedProperty;
+    default:
+      return Bytecode::kIllegal;
+  }
+}
+
+}  // namespace
+
+BytecodePeepholeOptimizer::BytecodePeepholeOptimizer(
+    ConstantArrayBuilder* constant_array_builder,
+    BytecodePipelineStage* next_stage)
+    : constant_array_builder_(constant_array_builder),
+      next_stage_(next_stage),
+      last_(Bytecode::kIllegal),
+      last_is_deferred_(false) {}
+
+// override
+void BytecodePeepholeOptimizer::Write(BytecodeNode* node) {
+  if (LastIsValid() && CanElideCurrent(node)) {
+    ElideCurrent(node);
+    return;
+  }
+  UpdateCurrentBytecode(node);
+  if (last_is_deferred_) {
+    if (CanFuseWithLast(node)) {
+      FuseWithLast(node);
+      return;
+    }
+    if (CanElideLast(node)) {
+      elided_source_info_.Update(last_.source_info());
+      last_is_deferred_ = false;
+    } else {
+      WriteLast();
+    }
+  }
+  if (elided_source_info_.is_valid()) {
+    BytecodeSourceInfo source_info = elided_source_info_;
+    source_info.Update(node->source_info());
+    node->source_info() = source_info;
+    elided_source_info_.set_invalid();
+  }
+  if (CanDeferCurrent(node)) {
+    last_ = *node;
+    last_is_deferred_ = true;
+    return;
+  }
+  WriteToNextStage(node);
+}
+
+// override
+size_t BytecodePeepholeOptimizer::FlushForOffset() {
+  // The last bytecode stays in the same basic block, so it can still be
+  // considered for the next bytecode once it has been written.
+  WriteLast();
+  return next_stage_->FlushForOffset();
+}
+
+// override
+void BytecodePeepholeOptimizer::FlushBasicBlock() {
+  WriteLast();
+  InvalidateLast();
+  next_stage_->FlushBasicBlock();
+}
+
+bool BytecodePeepholeOptimizer::LastIsValid() const {
+  return last_.bytecode() != Bytecode::kIllegal;
+}
+
+void BytecodePeepholeOptimizer::InvalidateLast() {
+  DCHECK(!last_is_deferred_);
+  last_ = BytecodeNode(Bytecode::kIllegal);
+}
+
+void BytecodePeepholeOptimizer::WriteLast() {
+  if (!last_is_deferred_) return;
+  last_is_deferred_ = false;
+  next_stage_->Write(&last_);
+}
+
+void BytecodePeepholeOptimizer::WriteToNextStage(BytecodeNode* const node) {
+  DCHECK(!last_is_deferred_);
+  next_stage_->Write(node);
+  last_ = *node;
+}
+
+bool BytecodePeepholeOptimizer::CanDeferCurrent(
+    const BytecodeNode* const current) const {
+  return FLAG_ignition_superinstructions &&
+         GetRegisterLoadForm(current->bytecode()) != Bytecode::kIllegal;
+}
+
+bool BytecodePeepholeOptimizer::CanFuseWithLast(
+    const BytecodeNode* const current) const {
+  // A Star with a source position of its own must stay a separate bytecode
+  // for the debugger to break on it.
+  return current->bytecode() == Bytecode::kStar &&
+         !current->source_info().is_valid() &&
+         GetRegisterLoadForm(last_.bytecode()) != Bytecode::kIllegal;
+}
+
+void BytecodePeepholeOptimizer::FuseWithLast(
+    const BytecodeNode* const current) {
+  DCHECK(last_is_deferred_);
+  uint32_t reg_operand = current->operand(0);
+  last_.set_bytecode(GetRegisterLoadForm(last_.bytecode()), reg_operand,
+                     current->operand_scale());
+  next_stage_->Write(&last_);
+
+  // The value is expected in the accumulator too, unless the next bytecode
+  // turns out to overwrite it.
+  last_ = BytecodeNode(Bytecode::kLdar, reg_operand, current->operand_scale());
+}
+
+bool BytecodePeepholeOptimizer::CanElideLast(
+    const BytecodeNode* const current) const {
+  DCHECK(last_is_deferred_);
+  // Only the deferred Ldar is free of side effects. It is dead if |current|
+  // overwrites the accumulator without reading it.
+  return last_.bytecode() == Bytecode::kLdar &&
+         !Bytecodes::ReadsAccumulator(current->bytecode()) &&
+         Bytecodes::WritesAccumulator(current->bytecode());
+}
+
+bool BytecodePeepholeOptimizer::LastBytecodePutsBooleanInAccumulator() const {
+  switch (last_.bytecode()) {
+    case Bytecode::kLdaTrue:
+    case Bytecode::kLdaFalse:
+    case Bytecode::kLogicalNot:
+    case Bytecode::kTestEqual:
+    case Bytecode::kTestNotEqual:
+    case Bytecode::kTestEqualStrict:
+    case Bytecode::kTestLessThan:
+    case Bytecode::kTestLessThanOrEqual:
+    case Bytecode::kTestGreaterThan:
+    case Bytecode::kTestGreaterThanOrEqual:
+    case Bytecode::kTestInstanceOf:
+    case Bytecode::kTestIn:
+    case Bytecode::kForInDone:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool BytecodePeepholeOptimizer::LastBytecodePutsNameInAccumulator() const {
+  switch (last_.bytecode()) {
+    case Bytecode::kToName:
+    case Bytecode::kTypeOf:
+      return true;
+    case Bytecode::kLdaConstant: {
+      Handle<Object> object = constant_array_builder_->At(last_.operand(0));
+      return object->IsName();
+    }
+    default:
+      return false;
+  }
+}
+
+bool BytecodePeepholeOptimizer::CanElideCurrent(
+    const BytecodeNode* const current) const {
+  switch (current->bytecode()) {
+    case Bytecode::kLdar:
+    case Bytecode::kStar:
+      // The accumulator and the register already hold the same value if
+      // the last bytecode transferred it between the same two locations.
+      return (last_.bytecode() == Bytecode::kLdar ||
+              last_.bytecode() == Bytecode::kStar) &&
+             last_.operand(0) == current->operand(0);
+    case Bytecode::kToName:
+      return LastBytecodePutsNameInAccumulator();
+    default:
+      return false;
+  }
+}
+
+void BytecodePeepholeOptimizer::ElideCurrent(BytecodeNode* const current) {
+  // The position of an elided bytecode is attributed to the next one, which
+  // starts at the same offset.
+  elided_source_info_.Update(current->source_info());
+}
+
+void BytecodePeepholeOptimizer::UpdateCurrentBytecode(
+    BytecodeNode* const current) {
+  // Conditional jumps with ToBoolean conversion can use the plain form if
+  // the value in the accumulator is a boolean already.
+  if (!LastIsValid() || !LastBytecodePutsBooleanInAccumulator()) return;
+  switch (current->bytecode()) {
+    case Bytecode::kJumpIfToBooleanTrue:
+      current->set_bytecode(Bytecode::kJumpIfTrue);
+      break;
+    case Bytecode::kJumpIfToBooleanFalse:
+      current->set_bytecode(Bytecode::kJumpIfFalse);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
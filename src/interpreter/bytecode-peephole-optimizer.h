@@ -0,0 +1,76 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INTERPRETER_BYTECODE_PEEPHOLE_OPTIMIZER_H_
+#define V8_INTERPRETER_BYTECODE_PEEPHOLE_OPTIMIZER_H_
+
+#include "src/interpreter/bytecode-pipeline.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+class ConstantArrayBuilder;
+
+// An optimization stage for performing peephole optimizations on
+// generated bytecode. The optimizer considers the last bytecode written
+// in the current basic block together with the bytecode being written,
+// and elides the latter if it has no effect, e.g. a Ldar of the register
+// that was just stored from the accumulator, or selects a cheaper form
+// of it, e.g. a JumpIfTrue instead of a JumpIfToBooleanTrue when the
+// accumulator is known to hold a boolean.
+//
+// With --ignition-superinstructions, loads that are commonly followed by a
+// Star are deferred, and a load followed by a Star is replaced with the
+// corresponding register load (e.g. LdaGlobal, Star r0 becomes
+// LdrGlobal r0). The accumulator is then reloaded with a deferred Ldar,
+// which is dropped if the next bytecode overwrites the accumulator without
+// reading it.
+class BytecodePeepholeOptimizer final : public BytecodePipelineStage,
+                                        public ZoneObject {
+ public:
+  BytecodePeepholeOptimizer(ConstantArrayBuilder* constant_array_builder,
+                            BytecodePipelineStage* next_stage);
+
+  // BytecodePipelineStage interface.
+  void Write(BytecodeNode* node) override;
+  size_t FlushForOffset() override;
+  void FlushBasicBlock() override;
+
+ private:
+  bool LastIsValid() const;
+  void InvalidateLast();
+
+  // Writes the deferred last bytecode, if any, to the next stage.
+  void WriteLast();
+  void WriteToNextStage(BytecodeNode* const node);
+
+  bool CanDeferCurrent(const BytecodeNode* const current) const;
+  bool CanFuseWithLast(const BytecodeNode* const current) const;
+  void FuseWithLast(const BytecodeNode* const current);
+  bool CanElideLast(const BytecodeNode* const current) const;
+
+  bool LastBytecodePutsBooleanInAccumulator() const;
+  bool LastBytecodePutsNameInAccumulator() const;
+  bool CanElideCurrent(const BytecodeNode* const current) const;
+  void ElideCurrent(BytecodeNode* const current);
+  void UpdateCurrentBytecode(BytecodeNode* const current);
+
+  ConstantArrayBuilder* constant_array_builder_;
+  BytecodePipelineStage* next_stage_;
+  BytecodeNode last_;
+  // Whether |last_| has not been written to the next stage yet.
+  bool last_is_deferred_;
+  // Source information of elided bytecodes, which is carried over to the
+  // next bytecode written.
+  BytecodeSourceInfo elided_source_info_;
+
+  DISALLOW_COPY_AND_ASSIGN(BytecodePeepholeOptimizer);
+};
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INTERPRETER_BYTECODE_PEEPHOLE_OPTIMIZER_H_
@@ -0,0 +1,214 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/interpreter/bytecode-register-optimizer.h"
+
+#include "src/interpreter/bytecode-array-builder.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+namespace {
+
+// Returns the number of registers written by an operand of |operand_type|.
+int RegistersWrittenByOperand(OperandType operand_type) {
+  switch (operand_type) {
+    case OperandType::kRegOut:
+      return 1;
+    case OperandType::kRegOutPair:
+      return 2;
+    case OperandType::kRegOutTriple:
+      return 3;
+    default:
+      DCHECK(!Bytecodes::IsRegisterOutputOperandType(operand_type));
+      return 0;
+  }
+}
+
+}  // namespace
+
+BytecodeRegisterOptimizer::BytecodeRegisterOptimizer(
+    Zone* zone, BytecodePipelineStage* next_stage)
+    : next_stage_(next_stage),
+      register_equivalence_ids_(zone),
+      accumulator_equivalence_id_(kInvalidEquivalenceId),
+      equivalence_id_(kInvalidEquivalenceId) {
+  ResetState();
+}
+
+// override
+void BytecodeRegisterOptimizer::Write(BytecodeNode* node) {
+  switch (node->bytecode()) {
+    case Bytecode::kLdar:
+      DoLdar(node);
+      break;
+    case Bytecode::kStar:
+      DoStar(node);
+      break;
+    case Bytecode::kMov:
+      DoMov(node);
+      break;
+    default:
+      DoOther(node);
+      break;
+  }
+}
+
+// override
+size_t BytecodeRegisterOptimizer::FlushForOffset() {
+  // The next bytecode must start at the returned offset, so the deferred
+  // load cannot be emitted in front of it later.
+  MaterializeAccumulator();
+  return next_stage_->FlushForOffset();
+}
+
+// override
+void BytecodeRegisterOptimizer::FlushBasicBlock() {
+  MaterializeAccumulator();
+  ResetState();
+  next_stage_->FlushBasicBlock();
+}
+
+void BytecodeRegisterOptimizer::DoLdar(BytecodeNode* node) {
+  Register source = Register::FromOperand(node->operand(0));
+  uint32_t equivalence_id = GetEquivalenceId(source);
+  if (equivalence_id != accumulator_equivalence_id_) {
+    accumulator_equivalence_id_ = equivalence_id;
+    accumulator_source_ = source;
+  }
+  Elide(node);
+}
+
+void BytecodeRegisterOptimizer::DoStar(BytecodeNode* node) {
+  Register target = Register::FromOperand(node->operand(0));
+  if (GetEquivalenceId(target) == accumulator_equivalence_id_) {
+    Elide(node);
+    return;
+  }
+  DCHECK(accumulator_source_ != target);
+  if (accumulator_source_.is_valid()) {
+    // Copy the value directly from where the accumulator would load it.
+    Register source = accumulator_source_;
+    OperandScale operand_scale = BytecodeArrayBuilder::OperandSizesToScale(
+        source.SizeOfOperand(), target.SizeOfOperand());
+    BytecodeNode mov(Bytecode::kMov,
+                     BytecodeArrayBuilder::RegisterOperand(source),
+                     BytecodeArrayBuilder::RegisterOperand(target),
+                     operand_scale);
+    mov.source_info() = node->source_info();
+    WriteToNextStage(&mov);
+  } else {
+    WriteToNextStage(node);
+  }
+  SetEquivalenceId(target, accumulator_equivalence_id_);
+}
+
+void BytecodeRegisterOptimizer::DoMov(BytecodeNode* node) {
+  Register source = Register::FromOperand(node->operand(0));
+  Register target = Register::FromOperand(node->operand(1));
+  uint32_t equivalence_id = GetEquivalenceId(source);
+  if (equivalence_id == GetEquivalenceId(target)) {
+    Elide(node);
+    return;
+  }
+  RegisterWillBeWritten(target);
+  WriteToNextStage(node);
+  SetEquivalenceId(target, equivalence_id);
+}
+
+void BytecodeRegisterOptimizer::DoOther(BytecodeNode* node) {
+  Bytecode bytecode = node->bytecode();
+
+  // Jumps and returns transfer the accumulator value implicitly, and the
+  // debugger may inspect it.
+  if (Bytecodes::ReadsAccumulator(bytecode) ||
+      Bytecodes::IsJumpOrReturn(bytecode) || bytecode == Bytecode::kDebugger) {
+    MaterializeAccumulator();
+  }
+
+  for (int i = 0; i < node->operand_count(); ++i) {
+    int count =
+        RegistersWrittenByOperand(Bytecodes::GetOperandType(bytecode, i));
+    if (count == 0) continue;
+    Register first = Register::FromOperand(node->operand(i));
+    for (int j = 0; j < count; ++j) {
+      RegisterWillBeWritten(Register(first.index() + j));
+    }
+  }
+  if (bytecode == Bytecode::kPushContext) {
+    // PushContext saves the current context into its (input) operand.
+    RegisterWillBeWritten(Register::FromOperand(node->operand(0)));
+  }
+  if (bytecode == Bytecode::kPushContext || bytecode == Bytecode::kPopContext) {
+    RegisterWillBeWritten(Register::current_context());
+  }
+
+  WriteToNextStage(node);
+
+  if (Bytecodes::WritesAccumulator(bytecode)) {
+    // A pending load into the accumulator is dead, unless the bytecode
+    // read the accumulator (in which case it was materialized above).
+    accumulator_source_ = Register();
+    accumulator_equivalence_id_ = NextEquivalenceId();
+  }
+  if (bytecode == Bytecode::kResumeGenerator ||
+      bytecode == Bytecode::kDebugger) {
+    // The register file is restored from the generator object, or might
+    // have been modified by the debugger.
+    ResetState();
+  }
+}
+
+void BytecodeRegisterOptimizer::WriteToNextStage(BytecodeNode* node) {
+  if (deferred_source_info_.is_valid()) {
+    BytecodeSourceInfo source_info = deferred_source_info_;
+    source_info.Update(node->source_info());
+    node->source_info() = source_info;
+    deferred_source_info_.set_invalid();
+  }
+  next_stage_->Write(node);
+}
+
+void BytecodeRegisterOptimizer::Elide(BytecodeNode* node) {
+  deferred_source_info_.Update(node->source_info());
+}
+
+void BytecodeRegisterOptimizer::MaterializeAccumulator() {
+  if (!accumulator_source_.is_valid()) return;
+  Register source = accumulator_source_;
+  accumulator_source_ = Register();
+  BytecodeNode ldar(
+      Bytecode::kLdar, BytecodeArrayBuilder::RegisterOperand(source),
+      BytecodeArrayBuilder::OperandSizesToScale(source.SizeOfOperand()));
+  WriteToNextStage(&ldar);
+}
+
+void BytecodeRegisterOptimizer::RegisterWillBeWritten(Register reg) {
+  if (accumulator_source_ == reg) MaterializeAccumulator();
+  SetEquivalenceId(reg, NextEquivalenceId());
+}
+
+uint32_t BytecodeRegisterOptimizer::GetEquivalenceId(Register reg) {
+  auto it = register_equivalence_ids_.find(reg.index());
+  if (it != register_equivalence_ids_.end()) return it->second;
+  uint32_t equivalence_id = NextEquivalenceId();
+  register_equivalence_ids_.insert(std::make_pair(reg.index(), equivalence_id));
+  return equivalence_id;
+}
+
+void BytecodeRegisterOptimizer::SetEquivalenceId(Register reg,
+                                                 uint32_t equivalence_id) {
+  register_equivalence_ids_[reg.index()] = equivalence_id;
+}
+
+void BytecodeRegisterOptimizer::ResetState() {
+  DCHECK(!accumulator_source_.is_valid());
+  register_equivalence_ids_.clear();
+  accumulator_equivalence_id_ = NextEquivalenceId();
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
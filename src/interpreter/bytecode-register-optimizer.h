@@ -0,0 +1,84 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INTERPRETER_BYTECODE_REGISTER_OPTIMIZER_H_
+#define V8_INTERPRETER_BYTECODE_REGISTER_OPTIMIZER_H_
+
+#include "src/interpreter/bytecode-pipeline.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+// An optimization stage for eliminating unnecessary transfers between
+// registers. The bytecode generator uses temporary registers liberally
+// for correctness and convenience, and this stage removes the transfers
+// that are not required to preserve semantics.
+//
+// The optimizer tracks which registers and the accumulator hold the same
+// value within a basic block, i.e. their equivalence classes, and elides
+// Ldar, Star and Mov bytecodes between equivalent locations. Loads into
+// the accumulator from a register are deferred until a bytecode reads the
+// accumulator, so a load is dropped if the accumulator is overwritten
+// first, and a Star of a deferred load becomes a single Mov. Registers are
+// always written eagerly, so the register file is accurate at any bytecode
+// that might throw or suspend.
+class BytecodeRegisterOptimizer final : public BytecodePipelineStage,
+                                        public ZoneObject {
+ public:
+  BytecodeRegisterOptimizer(Zone* zone, BytecodePipelineStage* next_stage);
+
+  // BytecodePipelineStage interface.
+  void Write(BytecodeNode* node) override;
+  size_t FlushForOffset() override;
+  void FlushBasicBlock() override;
+
+ private:
+  static const uint32_t kInvalidEquivalenceId = 0;
+
+  void DoLdar(BytecodeNode* node);
+  void DoStar(BytecodeNode* node);
+  void DoMov(BytecodeNode* node);
+  void DoOther(BytecodeNode* node);
+
+  // Writes |node| to the next stage, with the source information of
+  // bytecodes elided or deferred before it.
+  void WriteToNextStage(BytecodeNode* node);
+
+  // Drops |node|, whose source information moves to the next bytecode.
+  void Elide(BytecodeNode* node);
+
+  // Emits the deferred load of the accumulator, if any.
+  void MaterializeAccumulator();
+
+  // Marks |reg| as holding a new value, which is not equivalent to any
+  // other location, before |reg| is overwritten by a bytecode.
+  void RegisterWillBeWritten(Register reg);
+
+  uint32_t GetEquivalenceId(Register reg);
+  void SetEquivalenceId(Register reg, uint32_t equivalence_id);
+  uint32_t NextEquivalenceId() { return ++equivalence_id_; }
+
+  // Forgets all equivalences, e.g. at the start of a basic block.
+  void ResetState();
+
+  BytecodePipelineStage* next_stage_;
+  // Maps register indices to the equivalence class of the value held.
+  // Registers without an entry are equivalent to no other location.
+  ZoneMap<int, uint32_t> register_equivalence_ids_;
+  uint32_t accumulator_equivalence_id_;
+  uint32_t equivalence_id_;
+  // The register a deferred load into the accumulator comes from, if the
+  // accumulator has not been materialized.
+  Register accumulator_source_;
+  BytecodeSourceInfo deferred_source_info_;
+
+  DISALLOW_COPY_AND_ASSIGN(BytecodeRegisterOptimizer);
+};
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INTERPRETER_BYTECODE_REGISTER_OPTIMIZER_H_
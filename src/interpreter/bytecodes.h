@@ -124,6 +124,17 @@ namespace interpreter {
   V(KeyedLoadIC, AccumulatorUse::kReadWrite, OperandType::kReg,               \
     OperandType::kIdx)                                                        \
                                                                               \
+  /* Register loads which leave the accumulator untouched */                  \
+  V(LdrUndefined, AccumulatorUse::kNone, OperandType::kRegOut)                \
+  V(LdrGlobal, AccumulatorUse::kNone, OperandType::kIdx, OperandType::kIdx,   \
+    OperandType::kRegOut)                                                     \
+  V(LdrContextSlot, AccumulatorUse::kNone, OperandType::kReg,                 \
+    OperandType::kIdx, OperandType::kRegOut)                                  \
+  V(LdrNamedProperty, AccumulatorUse::kNone, OperandType::kReg,               \
+    OperandType::kIdx, OperandType::kIdx, OperandType::kRegOut)               \
+  V(LdrKeyedProperty, AccumulatorUse::kRead, OperandType::kReg,               \
+    OperandType::kIdx, OperandType::kRegOut)                                  \
+                                                                              \
   /* StoreIC operations */                                                    \
   V(StoreICSloppy, AccumulatorUse::kRead, OperandType::kReg,                  \
     OperandType::kIdx, OperandType::kIdx)                                     \
@@ -236,6 +247,9 @@ namespace interpreter {
   /* Perform a stack guard check */                                           \
   V(StackCheck, AccumulatorUse::kNone)                                        \
                                                                               \
+  /* Perform a check to trigger on-stack replacement */                       \
+  V(OsrPoll, AccumulatorUse::kNone, OperandType::kImm)                        \
+                                                                              \
   /* Non-local flow control */                                                \
   V(Throw, AccumulatorUse::kRead)                                             \
   V(ReThrow, AccumulatorUse::kRead)                                           \
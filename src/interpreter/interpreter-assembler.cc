@@ -24,12 +24,14 @@ using compiler::Node;
 
 InterpreterAssembler::InterpreterAssembler(Isolate* isolate, Zone* zone,
                                            Bytecode bytecode,
-                                           OperandScale operand_scale)
+                                           OperandScale operand_scale,
+                                           DispatchMode dispatch_mode)
     : CodeStubAssembler(isolate, zone, InterpreterDispatchDescriptor(isolate),
                         Code::ComputeFlags(Code::BYTECODE_HANDLER),
                         Bytecodes::ToString(bytecode), 0),
       bytecode_(bytecode),
       operand_scale_(operand_scale),
+      dispatch_mode_(dispatch_mode),
       accumulator_(this, MachineRepresentation::kTagged),
       accumulator_use_(AccumulatorUse::kNone),
       made_call_(false),
@@ -40,6 +42,9 @@ InterpreterAssembler::InterpreterAssembler(Isolate* isolate, Zone* zone,
   if (FLAG_trace_ignition) {
     TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
   }
+  if (FLAG_ignition_handler_statistics) {
+    RecordHandlerStatistics();
+  }
 }
 
 InterpreterAssembler::~InterpreterAssembler() {
@@ -400,6 +405,28 @@ Node* InterpreterAssembler::LoadTypeFeedbackVector() {
   return vector;
 }
 
+Node* InterpreterAssembler::LoadMonomorphicICHandler(Node* receiver,
+                                                     Node* type_feedback_vector,
+                                                     Node* smi_slot,
+                                                     Label* if_miss) {
+  // Smi receivers are cached as the heap number map, leave them to the IC.
+  GotoIf(WordIsSmi(receiver), if_miss);
+  Node* receiver_map = LoadMap(receiver);
+
+  // Only a weak cell holding the receiver map is monomorphic feedback for
+  // this receiver; sentinels and polymorphic arrays are left to the IC. The
+  // handler is in the following slot.
+  Node* feedback =
+      LoadFixedArrayElementSmiIndex(type_feedback_vector, smi_slot);
+  GotoIf(WordIsSmi(feedback), if_miss);
+  Node* weak_cell_map = LoadRoot(Heap::kWeakCellMapRootIndex);
+  GotoUnless(WordEqual(LoadMap(feedback), weak_cell_map), if_miss);
+  Node* cached_map = LoadObjectField(feedback, WeakCell::kValueOffset);
+  GotoUnless(WordEqual(cached_map, receiver_map), if_miss);
+  return LoadFixedArrayElementSmiIndex(type_feedback_vector, smi_slot,
+                                       kPointerSize);
+}
+
 void InterpreterAssembler::CallPrologue() {
   StoreRegister(SmiTag(BytecodeOffset()), Register::bytecode_offset());
 
@@ -489,6 +516,12 @@ void InterpreterAssembler::UpdateInterruptBudget(Node* weight) {
   Bind(&end);
 }
 
+Node* InterpreterAssembler::LoadOSRNestingLevel() {
+  Node* offset =
+      IntPtrConstant(BytecodeArray::kOSRNestingLevelOffset - kHeapObjectTag);
+  return Load(MachineType::Int8(), BytecodeArrayTaggedPointer(), offset);
+}
+
 Node* InterpreterAssembler::Advance(int delta) {
   return IntPtrAdd(BytecodeOffset(), IntPtrConstant(delta));
 }
@@ -527,6 +560,42 @@ Node* InterpreterAssembler::Dispatch() {
 }
 
 Node* InterpreterAssembler::DispatchTo(Node* new_bytecode_offset) {
+  if (dispatch_mode_ == DispatchMode::kThreaded) {
+    return DispatchThreadedTo(new_bytecode_offset);
+  }
+  return DispatchThroughTable(new_bytecode_offset, DispatchTableRawPointer());
+}
+
+Node* InterpreterAssembler::DispatchThreadedTo(Node* new_bytecode_offset) {
+  DCHECK(dispatch_mode_ == DispatchMode::kThreaded);
+  if (!made_call_) {
+    return DispatchThroughThreadedCode(new_bytecode_offset,
+                                       DispatchTableRawPointer());
+  }
+
+  // The threaded code might have been moved by a GC during the call, and the
+  // debugger might have swapped us to the patched debugger bytecode array,
+  // which has no threaded code. In the latter case continue in the dispatch
+  // table to hit the debug break bytecodes.
+  CodeStubAssembler::Label table_dispatch(this);
+  CodeStubAssembler::Label threaded_dispatch(this);
+  Node* threaded_code = LoadObjectField(BytecodeArrayTaggedPointer(),
+                                        BytecodeArray::kThreadedCodeOffset);
+  Branch(WordEqual(threaded_code, UndefinedConstant()), &table_dispatch,
+         &threaded_dispatch);
+  Bind(&table_dispatch);
+  DispatchThroughTable(
+      new_bytecode_offset,
+      ExternalConstant(
+          ExternalReference::interpreter_dispatch_table_address(isolate())));
+  Bind(&threaded_dispatch);
+  Node* dispatch_table = IntPtrAdd(
+      threaded_code, IntPtrConstant(BytecodeArray::kThreadedDispatchTableBias));
+  return DispatchThroughThreadedCode(new_bytecode_offset, dispatch_table);
+}
+
+Node* InterpreterAssembler::DispatchThroughTable(Node* new_bytecode_offset,
+                                                 Node* dispatch_table) {
   Node* target_bytecode = Load(
       MachineType::Uint8(), BytecodeArrayTaggedPointer(), new_bytecode_offset);
   if (kPointerSize == 8) {
@@ -538,10 +607,35 @@ Node* InterpreterAssembler::DispatchTo(Node* new_bytecode_offset) {
   }
 
   Node* target_code_entry =
-      Load(MachineType::Pointer(), DispatchTableRawPointer(),
+      Load(MachineType::Pointer(), dispatch_table,
            WordShl(target_bytecode, IntPtrConstant(kPointerSizeLog2)));
 
-  return DispatchToBytecodeHandlerEntry(target_code_entry, new_bytecode_offset);
+  return DispatchToBytecodeHandlerEntry(target_code_entry, new_bytecode_offset,
+                                        dispatch_table);
+}
+
+Node* InterpreterAssembler::DispatchThroughThreadedCode(
+    Node* new_bytecode_offset, Node* dispatch_table) {
+  if (FLAG_trace_ignition_dispatches) {
+    Node* target_bytecode =
+        Load(MachineType::Uint8(), BytecodeArrayTaggedPointer(),
+             new_bytecode_offset);
+    if (kPointerSize == 8) {
+      target_bytecode = ChangeUint32ToUint64(target_bytecode);
+    }
+    TraceBytecodeDispatch(target_bytecode);
+  }
+
+  // The threaded code holds the handler itself rather than its entry point,
+  // so that the GC updates it when handlers move.
+  Node* target_handler =
+      Load(MachineType::AnyTagged(), dispatch_table,
+           WordShl(new_bytecode_offset, IntPtrConstant(kPointerSizeLog2)));
+  Node* target_code_entry = IntPtrAdd(
+      target_handler, IntPtrConstant(Code::kHeaderSize - kHeapObjectTag));
+
+  return DispatchToBytecodeHandlerEntry(target_code_entry, new_bytecode_offset,
+                                        dispatch_table);
 }
 
 Node* InterpreterAssembler::DispatchToBytecodeHandler(Node* handler,
@@ -552,14 +646,14 @@ Node* InterpreterAssembler::DispatchToBytecodeHandler(Node* handler,
 }
 
 Node* InterpreterAssembler::DispatchToBytecodeHandlerEntry(
-    Node* handler_entry, Node* bytecode_offset) {
+    Node* handler_entry, Node* bytecode_offset, Node* dispatch_table) {
   if (FLAG_trace_ignition) {
     TraceBytecode(Runtime::kInterpreterTraceBytecodeExit);
   }
 
   InterpreterDispatchDescriptor descriptor(isolate());
   Node* args[] = {GetAccumulatorUnchecked(), bytecode_offset,
-                  BytecodeArrayTaggedPointer(), DispatchTableRawPointer()};
+                  BytecodeArrayTaggedPointer(), dispatch_table};
   return TailCallBytecodeDispatch(descriptor, handler_entry, args);
 }
 
@@ -571,7 +665,15 @@ void InterpreterAssembler::DispatchWide(OperandScale operand_scale) {
   //   Indices 0-255 correspond to bytecodes with operand_scale == 0
   //   Indices 256-511 correspond to bytecodes with operand_scale == 1
   //   Indices 512-767 correspond to bytecodes with operand_scale == 2
+  //
+  // Threaded code instead holds the scaled handler at the offset of the
+  // bytecode following the prefix.
   Node* next_bytecode_offset = Advance(1);
+  if (dispatch_mode_ == DispatchMode::kThreaded) {
+    DispatchThreadedTo(next_bytecode_offset);
+    return;
+  }
+
   Node* next_bytecode = Load(MachineType::Uint8(), BytecodeArrayTaggedPointer(),
                              next_bytecode_offset);
   if (kPointerSize == 8) {
@@ -694,6 +796,52 @@ void InterpreterAssembler::TraceBytecodeDispatch(Node* target_bytecode) {
   Bind(&end);
 }
 
+void InterpreterAssembler::RecordHandlerStatistics() {
+  Node* statistics = ExternalConstant(
+      ExternalReference::interpreter_handler_statistics(isolate()));
+
+  CodeStubAssembler::Label enabled(this);
+  CodeStubAssembler::Label take_sample(this);
+  CodeStubAssembler::Label end(this);
+
+  Node* is_enabled =
+      Load(MachineType::IntPtr(), statistics,
+           IntPtrConstant(offsetof(HandlerStatistics, enabled)));
+  Branch(WordEqual(is_enabled, IntPtrConstant(0)), &end, &enabled);
+  Bind(&enabled);
+  {
+    Node* count_offset =
+        IntPtrConstant(offsetof(HandlerStatistics, execution_counts) +
+                       Bytecodes::ToByte(bytecode_) * kPointerSize);
+    Node* old_count = Load(MachineType::IntPtr(), statistics, count_offset);
+    StoreNoWriteBarrier(MachineType::PointerRepresentation(), statistics,
+                        count_offset, IntPtrAdd(old_count, IntPtrConstant(1)));
+
+    Node* countdown_offset =
+        IntPtrConstant(offsetof(HandlerStatistics, sample_countdown));
+    Node* countdown = IntPtrSub(
+        Load(MachineType::IntPtr(), statistics, countdown_offset),
+        IntPtrConstant(1));
+    StoreNoWriteBarrier(MachineType::PointerRepresentation(), statistics,
+                        countdown_offset, countdown);
+    Branch(IntPtrGreaterThan(countdown, IntPtrConstant(0)), &end,
+           &take_sample);
+  }
+  Bind(&take_sample);
+  {
+    Node* function = ExternalConstant(
+        ExternalReference::interpreter_sample_bytecode_handler_function(
+            isolate()));
+    Node* isolate_address =
+        ExternalConstant(ExternalReference::isolate_address(isolate()));
+    CallCFunction2(MachineType::Pointer(), MachineType::Pointer(),
+                   MachineType::IntPtr(), function, isolate_address,
+                   IntPtrConstant(Bytecodes::ToByte(bytecode_)));
+    Goto(&end);
+  }
+  Bind(&end);
+}
+
 // static
 bool InterpreterAssembler::TargetSupportsUnalignedAccess() {
 #if V8_TARGET_ARCH_MIPS || V8_TARGET_ARCH_MIPS64
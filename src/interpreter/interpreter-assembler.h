@@ -11,6 +11,7 @@
 #include "src/code-stub-assembler.h"
 #include "src/frames.h"
 #include "src/interpreter/bytecodes.h"
+#include "src/interpreter/interpreter.h"
 #include "src/runtime/runtime.h"
 
 namespace v8 {
@@ -20,7 +21,8 @@ namespace interpreter {
 class InterpreterAssembler : public CodeStubAssembler {
  public:
   InterpreterAssembler(Isolate* isolate, Zone* zone, Bytecode bytecode,
-                       OperandScale operand_scale);
+                       OperandScale operand_scale,
+                       DispatchMode dispatch_mode = DispatchMode::kTable);
   virtual ~InterpreterAssembler();
 
   // Returns the count immediate for bytecode operand |operand_index| in the
@@ -86,6 +88,14 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Load the TypeFeedbackVector for the current function.
   compiler::Node* LoadTypeFeedbackVector();
 
+  // Returns the IC handler cached in |smi_slot| of |type_feedback_vector| if
+  // the feedback is monomorphic for the map of |receiver|, and jumps to
+  // |if_miss| otherwise.
+  compiler::Node* LoadMonomorphicICHandler(compiler::Node* receiver,
+                                           compiler::Node* type_feedback_vector,
+                                           compiler::Node* smi_slot,
+                                           Label* if_miss);
+
   // Call JSFunction or Callable |function| with |arg_count|
   // arguments (not including receiver) and the first argument
   // located at |first_arg|.
@@ -132,6 +142,9 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Perform a stack guard check.
   void StackCheck();
 
+  // Load the OSR loop nesting level from the bytecode array.
+  compiler::Node* LoadOSRNestingLevel();
+
   // Returns from the function.
   compiler::Node* InterpreterReturn();
 
@@ -158,7 +171,8 @@ class InterpreterAssembler : public CodeStubAssembler {
   compiler::Node* BytecodeArrayTaggedPointer();
   // Returns the offset from the BytecodeArrayPointer of the current bytecode.
   compiler::Node* BytecodeOffset();
-  // Returns a raw pointer to first entry in the interpreter dispatch table.
+  // Returns a raw pointer to first entry in the interpreter dispatch table, or
+  // the biased pointer into the threaded code when dispatching threaded.
   compiler::Node* DispatchTableRawPointer();
 
   // Returns the accumulator value without checking whether bytecode
@@ -177,6 +191,10 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Traces the current bytecode by calling |function_id|.
   void TraceBytecode(Runtime::FunctionId function_id);
 
+  // Counts the execution of the current handler and takes a cycle sample
+  // when due, if handler statistics are being collected.
+  void RecordHandlerStatistics();
+
   // Updates the bytecode array's interrupt budget by |weight| and calls
   // Runtime::kInterrupt if counter reaches zero.
   void UpdateInterruptBudget(compiler::Node* weight);
@@ -215,13 +233,34 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Starts next instruction dispatch at |new_bytecode_offset|.
   compiler::Node* DispatchTo(compiler::Node* new_bytecode_offset);
 
+  // Starts next instruction dispatch at |new_bytecode_offset| through the
+  // threaded code, falling back to the dispatch table if the bytecode array
+  // might have been replaced by one without threaded code.
+  compiler::Node* DispatchThreadedTo(compiler::Node* new_bytecode_offset);
+
+  // Dispatch to the handler of the bytecode at |new_bytecode_offset|, found in
+  // |dispatch_table| by bytecode.
+  compiler::Node* DispatchThroughTable(compiler::Node* new_bytecode_offset,
+                                       compiler::Node* dispatch_table);
+
+  // Dispatch to the handler at |new_bytecode_offset| in the threaded code
+  // that the biased pointer |dispatch_table| points into.
+  compiler::Node* DispatchThroughThreadedCode(
+      compiler::Node* new_bytecode_offset, compiler::Node* dispatch_table);
+
   // Dispatch to the bytecode handler with code offset |handler|.
   compiler::Node* DispatchToBytecodeHandler(compiler::Node* handler,
                                             compiler::Node* bytecode_offset);
 
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   compiler::Node* DispatchToBytecodeHandlerEntry(
-      compiler::Node* handler_entry, compiler::Node* bytecode_offset);
+      compiler::Node* handler_entry, compiler::Node* bytecode_offset) {
+    return DispatchToBytecodeHandlerEntry(handler_entry, bytecode_offset,
+                                          DispatchTableRawPointer());
+  }
+  compiler::Node* DispatchToBytecodeHandlerEntry(
+      compiler::Node* handler_entry, compiler::Node* bytecode_offset,
+      compiler::Node* dispatch_table);
 
   // Abort operations for debug code.
   void AbortIfWordNotEqual(compiler::Node* lhs, compiler::Node* rhs,
@@ -231,6 +270,7 @@ class InterpreterAssembler : public CodeStubAssembler {
 
   Bytecode bytecode_;
   OperandScale operand_scale_;
+  DispatchMode dispatch_mode_;
   CodeStubAssembler::Variable accumulator_;
   AccumulatorUse accumulator_use_;
   bool made_call_;
@@ -6,10 +6,16 @@
 
 #include <fstream>
 
+#if V8_CC_MSVC && (V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64)
+#include <intrin.h>
+#endif
+
 #include "src/ast/prettyprinter.h"
+#include "src/base/platform/time.h"
 #include "src/code-factory.h"
 #include "src/compiler.h"
 #include "src/factory.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter-assembler.h"
@@ -29,10 +35,21 @@ typedef CodeStubAssembler::Variable Variable;
 
 Interpreter::Interpreter(Isolate* isolate) : isolate_(isolate) {
   memset(dispatch_table_, 0, sizeof(dispatch_table_));
+  memset(threaded_dispatch_table_, 0, sizeof(threaded_dispatch_table_));
+  handler_statistics_.enabled = 0;
+  ResetHandlerStatistics();
 }
 
 void Interpreter::Initialize() {
-  if (IsDispatchTableInitialized()) return;
+  List<DispatchMode> dispatch_modes(2);
+  if (!IsDispatchTableInitialized(DispatchMode::kTable)) {
+    dispatch_modes.Add(DispatchMode::kTable);
+  }
+  if (FLAG_ignition_threaded_dispatch &&
+      !IsDispatchTableInitialized(DispatchMode::kThreaded)) {
+    dispatch_modes.Add(DispatchMode::kThreaded);
+  }
+  if (dispatch_modes.is_empty()) return;
   Zone zone(isolate_->allocator());
   HandleScope scope(isolate_);
 
@@ -44,19 +61,23 @@ void Interpreter::Initialize() {
            sizeof(uintptr_t) * kBytecodeCount * kBytecodeCount);
   }
 
-  // Generate bytecode handlers for all bytecodes and scales.
-  for (OperandScale operand_scale = OperandScale::kSingle;
-       operand_scale <= OperandScale::kMaxValid;
-       operand_scale = Bytecodes::NextOperandScale(operand_scale)) {
+  // Generate bytecode handlers for all bytecodes, scales and dispatch modes
+  // whose dispatch table is not initialized yet.
+  for (int i = 0; i < dispatch_modes.length(); i++) {
+    DispatchMode dispatch_mode = dispatch_modes[i];
+    Address* dispatch_table = GetDispatchTable(dispatch_mode);
+    for (OperandScale operand_scale = OperandScale::kSingle;
+         operand_scale <= OperandScale::kMaxValid;
+         operand_scale = Bytecodes::NextOperandScale(operand_scale)) {
 #define GENERATE_CODE(Name, ...)                                               \
   {                                                                            \
     if (Bytecodes::BytecodeHasHandler(Bytecode::k##Name, operand_scale)) {     \
       InterpreterAssembler assembler(isolate_, &zone, Bytecode::k##Name,       \
-                                     operand_scale);                           \
+                                     operand_scale, dispatch_mode);            \
       Do##Name(&assembler);                                                    \
       Handle<Code> code = assembler.GenerateCode();                            \
       size_t index = GetDispatchTableIndex(Bytecode::k##Name, operand_scale);  \
-      dispatch_table_[index] = code->entry();                                  \
+      dispatch_table[index] = code->entry();                                   \
       TraceCodegen(code);                                                      \
       LOG_CODE_EVENT(                                                          \
           isolate_,                                                            \
@@ -65,23 +86,24 @@ void Interpreter::Initialize() {
               Bytecodes::ToString(Bytecode::k##Name, operand_scale).c_str())); \
     }                                                                          \
   }
-    BYTECODE_LIST(GENERATE_CODE)
+      BYTECODE_LIST(GENERATE_CODE)
 #undef GENERATE_CODE
-  }
+    }
 
-  // Fill unused entries will the illegal bytecode handler.
-  size_t illegal_index =
-      GetDispatchTableIndex(Bytecode::kIllegal, OperandScale::kSingle);
-  for (size_t index = 0; index < arraysize(dispatch_table_); ++index) {
-    if (dispatch_table_[index] == nullptr) {
-      dispatch_table_[index] = dispatch_table_[illegal_index];
+    // Fill unused entries will the illegal bytecode handler.
+    size_t illegal_index =
+        GetDispatchTableIndex(Bytecode::kIllegal, OperandScale::kSingle);
+    for (size_t index = 0; index < kDispatchTableSize; ++index) {
+      if (dispatch_table[index] == nullptr) {
+        dispatch_table[index] = dispatch_table[illegal_index];
+      }
     }
   }
 }
 
 Code* Interpreter::GetBytecodeHandler(Bytecode bytecode,
                                       OperandScale operand_scale) {
-  DCHECK(IsDispatchTableInitialized());
+  DCHECK(IsDispatchTableInitialized(DispatchMode::kTable));
   DCHECK(Bytecodes::BytecodeHasHandler(bytecode, operand_scale));
   size_t index = GetDispatchTableIndex(bytecode, operand_scale);
   Address code_entry = dispatch_table_[index];
@@ -101,20 +123,73 @@ size_t Interpreter::GetDispatchTableIndex(Bytecode bytecode,
   return index;
 }
 
+bool Interpreter::ThreadBytecodeArray(Handle<BytecodeArray> bytecode_array) {
+  Address* dispatch_table = GetDispatchTable(DispatchMode::kThreaded);
+  if (dispatch_table[0] == nullptr) return false;
+  DCHECK(!bytecode_array->HasThreadedCode());
+
+  // Offsets which do not start a bytecode are never dispatched to, and keep
+  // the illegal bytecode handler.
+  Handle<FixedArray> threaded_code = isolate_->factory()->NewFixedArray(
+      bytecode_array->length(), TENURED);
+  size_t illegal_index =
+      GetDispatchTableIndex(Bytecode::kIllegal, OperandScale::kSingle);
+  Code* illegal = Code::GetCodeFromTargetAddress(dispatch_table[illegal_index]);
+  for (int i = 0; i < threaded_code->length(); i++) {
+    threaded_code->set(i, illegal);
+  }
+
+  for (BytecodeArrayIterator iterator(bytecode_array); !iterator.done();
+       iterator.Advance()) {
+    int offset = iterator.current_offset();
+    OperandScale operand_scale = iterator.current_operand_scale();
+    if (operand_scale != OperandScale::kSingle) {
+      // The prefix handler dispatches to the scaled handler, which is stored
+      // at the offset of the bytecode following the prefix.
+      Bytecode prefix = Bytecodes::OperandScaleToPrefixBytecode(operand_scale);
+      size_t index = GetDispatchTableIndex(prefix, OperandScale::kSingle);
+      threaded_code->set(
+          offset, Code::GetCodeFromTargetAddress(dispatch_table[index]));
+      offset += iterator.current_prefix_offset();
+    }
+    size_t index =
+        GetDispatchTableIndex(iterator.current_bytecode(), operand_scale);
+    threaded_code->set(offset,
+                       Code::GetCodeFromTargetAddress(dispatch_table[index]));
+  }
+
+  bytecode_array->set_threaded_code(*threaded_code);
+  return true;
+}
+
 void Interpreter::IterateDispatchTable(ObjectVisitor* v) {
-  for (int i = 0; i < kDispatchTableSize; i++) {
-    Address code_entry = dispatch_table_[i];
-    Object* code = code_entry == nullptr
-                       ? nullptr
-                       : Code::GetCodeFromTargetAddress(code_entry);
-    Object* old_code = code;
-    v->VisitPointer(&code);
-    if (code != old_code) {
-      dispatch_table_[i] = reinterpret_cast<Code*>(code)->entry();
+  Address* dispatch_tables[] = {dispatch_table_, threaded_dispatch_table_};
+  for (Address* dispatch_table : dispatch_tables) {
+    for (int i = 0; i < kDispatchTableSize; i++) {
+      Address code_entry = dispatch_table[i];
+      Object* code = code_entry == nullptr
+                         ? nullptr
+                         : Code::GetCodeFromTargetAddress(code_entry);
+      Object* old_code = code;
+      v->VisitPointer(&code);
+      if (code != old_code) {
+        dispatch_table[i] = reinterpret_cast<Code*>(code)->entry();
+      }
     }
   }
 }
 
+Address* Interpreter::GetDispatchTable(DispatchMode dispatch_mode) {
+  switch (dispatch_mode) {
+    case DispatchMode::kTable:
+      return dispatch_table_;
+    case DispatchMode::kThreaded:
+      return threaded_dispatch_table_;
+  }
+  UNREACHABLE();
+  return nullptr;
+}
+
 // static
 int Interpreter::InterruptBudget() {
   // TODO(ignition): Tune code size multiplier.
@@ -167,15 +242,15 @@ bool Interpreter::MakeBytecode(CompilationInfo* info) {
   return true;
 }
 
-bool Interpreter::IsDispatchTableInitialized() {
+bool Interpreter::IsDispatchTableInitialized(DispatchMode dispatch_mode) {
   if (FLAG_trace_ignition || FLAG_trace_ignition_codegen ||
-      FLAG_trace_ignition_dispatches) {
+      FLAG_trace_ignition_dispatches || FLAG_ignition_handler_statistics) {
     // Regenerate table to add bytecode tracing operations,
     // print the assembly code generated by TurboFan,
-    // or instrument handlers with dispatch counters.
+    // or instrument handlers with dispatch counters or handler statistics.
     return false;
   }
-  return dispatch_table_[0] != nullptr;
+  return GetDispatchTable(dispatch_mode)[0] != nullptr;
 }
 
 void Interpreter::TraceCodegen(Handle<Code> code) {
@@ -190,10 +265,12 @@ void Interpreter::TraceCodegen(Handle<Code> code) {
 
 const char* Interpreter::LookupNameOfBytecodeHandler(Code* code) {
 #ifdef ENABLE_DISASSEMBLER
-#define RETURN_NAME(Name, ...)                                 \
-  if (dispatch_table_[Bytecodes::ToByte(Bytecode::k##Name)] == \
-      code->entry()) {                                         \
-    return #Name;                                              \
+#define RETURN_NAME(Name, ...)                                           \
+  if (dispatch_table_[Bytecodes::ToByte(Bytecode::k##Name)] ==           \
+          code->entry() ||                                               \
+      threaded_dispatch_table_[Bytecodes::ToByte(Bytecode::k##Name)] ==  \
+          code->entry()) {                                               \
+    return #Name;                                                        \
   }
   BYTECODE_LIST(RETURN_NAME)
 #undef RETURN_NAME
@@ -208,6 +285,71 @@ uintptr_t Interpreter::GetDispatchCounter(Bytecode from, Bytecode to) const {
                                            to_index];
 }
 
+namespace {
+
+uint64_t ReadCycleCounter() {
+#if V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+#if V8_CC_MSVC
+  return __rdtsc();
+#else
+  uint32_t low, high;
+  __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+  return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+#else
+  // Fall back to nanoseconds where there is no portable cycle counter.
+  return static_cast<uint64_t>(
+      base::TimeTicks::HighResolutionNow().ToInternalValue() *
+      base::Time::kNanosecondsPerMicrosecond);
+#endif
+}
+
+}  // namespace
+
+void Interpreter::StartHandlerStatistics() {
+  handler_statistics_.enabled = 1;
+}
+
+void Interpreter::StopHandlerStatistics() {
+  handler_statistics_.enabled = 0;
+  // Drop a sample in progress, it would otherwise span the stopped period.
+  handler_statistics_.sampled_bytecode = -1;
+  handler_statistics_.sample_countdown = FLAG_ignition_handler_sample_interval;
+}
+
+void Interpreter::ResetHandlerStatistics() {
+  handler_statistics_.sample_countdown = FLAG_ignition_handler_sample_interval;
+  handler_statistics_.sampled_bytecode = -1;
+  handler_statistics_.sample_start = 0;
+  memset(handler_statistics_.execution_counts, 0,
+         sizeof(handler_statistics_.execution_counts));
+  memset(handler_statistics_.sample_counts, 0,
+         sizeof(handler_statistics_.sample_counts));
+  memset(handler_statistics_.sampled_cycles, 0,
+         sizeof(handler_statistics_.sampled_cycles));
+}
+
+// static
+void Interpreter::SampleBytecodeHandler(Isolate* isolate, intptr_t bytecode) {
+  HandlerStatistics* statistics =
+      &isolate->interpreter()->handler_statistics_;
+  uint64_t now = ReadCycleCounter();
+  if (statistics->sampled_bytecode >= 0) {
+    // The estimate includes the dispatch to the next handler, and any calls
+    // the sampled handler made.
+    intptr_t index = statistics->sampled_bytecode;
+    statistics->sample_counts[index]++;
+    statistics->sampled_cycles[index] += now - statistics->sample_start;
+    statistics->sampled_bytecode = -1;
+    statistics->sample_countdown = FLAG_ignition_handler_sample_interval;
+  } else {
+    // End the sample on entry of the next handler.
+    statistics->sampled_bytecode = bytecode;
+    statistics->sample_countdown = 1;
+    statistics->sample_start = ReadCycleCounter();
+  }
+}
+
 Local<v8::Object> Interpreter::GetDispatchCountersObject() {
   v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(isolate_);
   Local<v8::Context> context = isolate->GetCurrentContext();
@@ -301,6 +443,16 @@ void Interpreter::DoLdaUndefined(InterpreterAssembler* assembler) {
   __ Dispatch();
 }
 
+// LdrUndefined <reg>
+//
+// Loads undefined into register <reg>.
+void Interpreter::DoLdrUndefined(InterpreterAssembler* assembler) {
+  Node* undefined_value =
+      __ HeapConstant(isolate_->factory()->undefined_value());
+  Node* destination = __ BytecodeOperandReg(0);
+  __ StoreRegister(undefined_value, destination);
+  __ Dispatch();
+}
 
 // LdaNull
 //
@@ -376,7 +528,63 @@ void Interpreter::DoMov(InterpreterAssembler* assembler) {
 }
 
 
-void Interpreter::DoLoadGlobal(Callable ic, InterpreterAssembler* assembler) {
+Node* Interpreter::BuildLoadICCall(Callable ic, Node* context, Node* object,
+                                   Node* name, Node* smi_slot,
+                                   Node* type_feedback_vector,
+                                   InterpreterAssembler* assembler) {
+  Node* code_target = __ HeapConstant(ic.code());
+  if (!FLAG_ignition_inline_ics) {
+    return __ CallStub(ic.descriptor(), code_target, context, object, name,
+                       smi_slot, type_feedback_vector);
+  }
+
+  // Call the handler cached for a monomorphic hit directly, which skips the
+  // dispatch on the kind of feedback done by the IC.
+  Variable result(assembler, MachineRepresentation::kTagged);
+  Label if_miss(assembler), end(assembler);
+  Node* handler = __ LoadMonomorphicICHandler(object, type_feedback_vector,
+                                              smi_slot, &if_miss);
+  result.Bind(__ CallStub(ic.descriptor(), handler, context, object, name,
+                          smi_slot, type_feedback_vector));
+  __ Goto(&end);
+
+  __ Bind(&if_miss);
+  result.Bind(__ CallStub(ic.descriptor(), code_target, context, object, name,
+                          smi_slot, type_feedback_vector));
+  __ Goto(&end);
+
+  __ Bind(&end);
+  return result.value();
+}
+
+void Interpreter::BuildStoreICCall(Callable ic, Node* context, Node* object,
+                                   Node* name, Node* value, Node* smi_slot,
+                                   Node* type_feedback_vector,
+                                   InterpreterAssembler* assembler) {
+  Node* code_target = __ HeapConstant(ic.code());
+  if (!FLAG_ignition_inline_ics) {
+    __ CallStub(ic.descriptor(), code_target, context, object, name, value,
+                smi_slot, type_feedback_vector);
+    return;
+  }
+
+  Label if_miss(assembler), end(assembler);
+  Node* handler = __ LoadMonomorphicICHandler(object, type_feedback_vector,
+                                              smi_slot, &if_miss);
+  __ CallStub(ic.descriptor(), handler, context, object, name, value, smi_slot,
+              type_feedback_vector);
+  __ Goto(&end);
+
+  __ Bind(&if_miss);
+  __ CallStub(ic.descriptor(), code_target, context, object, name, value,
+              smi_slot, type_feedback_vector);
+  __ Goto(&end);
+
+  __ Bind(&end);
+}
+
+Node* Interpreter::BuildLoadGlobal(Callable ic,
+                                   InterpreterAssembler* assembler) {
   // Get the global object.
   Node* context = __ GetContext();
   Node* native_context =
@@ -384,16 +592,13 @@ void Interpreter::DoLoadGlobal(Callable ic, InterpreterAssembler* assembler) {
   Node* global = __ LoadContextSlot(native_context, Context::EXTENSION_INDEX);
 
   // Load the global via the LoadIC.
-  Node* code_target = __ HeapConstant(ic.code());
   Node* constant_index = __ BytecodeOperandIdx(0);
   Node* name = __ LoadConstantPoolEntry(constant_index);
   Node* raw_slot = __ BytecodeOperandIdx(1);
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
-  Node* result = __ CallStub(ic.descriptor(), code_target, context, global,
-                             name, smi_slot, type_feedback_vector);
-  __ SetAccumulator(result);
-  __ Dispatch();
+  return BuildLoadICCall(ic, context, global, name, smi_slot,
+                         type_feedback_vector, assembler);
 }
 
 // LdaGlobal <name_index> <slot>
@@ -403,7 +608,22 @@ void Interpreter::DoLoadGlobal(Callable ic, InterpreterAssembler* assembler) {
 void Interpreter::DoLdaGlobal(InterpreterAssembler* assembler) {
   Callable ic = CodeFactory::LoadICInOptimizedCode(isolate_, NOT_INSIDE_TYPEOF,
                                                    UNINITIALIZED);
-  DoLoadGlobal(ic, assembler);
+  Node* result = BuildLoadGlobal(ic, assembler);
+  __ SetAccumulator(result);
+  __ Dispatch();
+}
+
+// LdrGlobal <name_index> <slot> <reg>
+//
+// Load the global with name in constant pool entry <name_index> into register
+// <reg> using FeedBackVector slot <slot> outside of a typeof.
+void Interpreter::DoLdrGlobal(InterpreterAssembler* assembler) {
+  Callable ic = CodeFactory::LoadICInOptimizedCode(isolate_, NOT_INSIDE_TYPEOF,
+                                                   UNINITIALIZED);
+  Node* result = BuildLoadGlobal(ic, assembler);
+  Node* destination = __ BytecodeOperandReg(2);
+  __ StoreRegister(result, destination);
+  __ Dispatch();
 }
 
 // LdaGlobalInsideTypeof <name_index> <slot>
@@ -413,7 +633,9 @@ void Interpreter::DoLdaGlobal(InterpreterAssembler* assembler) {
 void Interpreter::DoLdaGlobalInsideTypeof(InterpreterAssembler* assembler) {
   Callable ic = CodeFactory::LoadICInOptimizedCode(isolate_, INSIDE_TYPEOF,
                                                    UNINITIALIZED);
-  DoLoadGlobal(ic, assembler);
+  Node* result = BuildLoadGlobal(ic, assembler);
+  __ SetAccumulator(result);
+  __ Dispatch();
 }
 
 void Interpreter::DoStoreGlobal(Callable ic, InterpreterAssembler* assembler) {
@@ -458,18 +680,32 @@ void Interpreter::DoStaGlobalStrict(InterpreterAssembler* assembler) {
   DoStoreGlobal(ic, assembler);
 }
 
+Node* Interpreter::BuildLoadContextSlot(InterpreterAssembler* assembler) {
+  Node* reg_index = __ BytecodeOperandReg(0);
+  Node* context = __ LoadRegister(reg_index);
+  Node* slot_index = __ BytecodeOperandIdx(1);
+  return __ LoadContextSlot(context, slot_index);
+}
+
 // LdaContextSlot <context> <slot_index>
 //
 // Load the object in |slot_index| of |context| into the accumulator.
 void Interpreter::DoLdaContextSlot(InterpreterAssembler* assembler) {
-  Node* reg_index = __ BytecodeOperandReg(0);
-  Node* context = __ LoadRegister(reg_index);
-  Node* slot_index = __ BytecodeOperandIdx(1);
-  Node* result = __ LoadContextSlot(context, slot_index);
+  Node* result = BuildLoadContextSlot(assembler);
   __ SetAccumulator(result);
   __ Dispatch();
 }
 
+// LdrContextSlot <context> <slot_index> <reg>
+//
+// Load the object in |slot_index| of |context| into register |reg|.
+void Interpreter::DoLdrContextSlot(InterpreterAssembler* assembler) {
+  Node* result = BuildLoadContextSlot(assembler);
+  Node* destination = __ BytecodeOperandReg(2);
+  __ StoreRegister(result, destination);
+  __ Dispatch();
+}
+
 // StaContextSlot <context> <slot_index>
 //
 // Stores the object in the accumulator into |slot_index| of |context|.
@@ -539,8 +775,7 @@ void Interpreter::DoStaLookupSlotStrict(InterpreterAssembler* assembler) {
   DoStoreLookupSlot(LanguageMode::STRICT, assembler);
 }
 
-void Interpreter::DoLoadIC(Callable ic, InterpreterAssembler* assembler) {
-  Node* code_target = __ HeapConstant(ic.code());
+Node* Interpreter::BuildLoadIC(Callable ic, InterpreterAssembler* assembler) {
   Node* register_index = __ BytecodeOperandReg(0);
   Node* object = __ LoadRegister(register_index);
   Node* constant_index = __ BytecodeOperandIdx(1);
@@ -549,10 +784,8 @@ void Interpreter::DoLoadIC(Callable ic, InterpreterAssembler* assembler) {
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
   Node* context = __ GetContext();
-  Node* result = __ CallStub(ic.descriptor(), code_target, context, object,
-                             name, smi_slot, type_feedback_vector);
-  __ SetAccumulator(result);
-  __ Dispatch();
+  return BuildLoadICCall(ic, context, object, name, smi_slot,
+                         type_feedback_vector, assembler);
 }
 
 // LoadIC <object> <name_index> <slot>
@@ -562,11 +795,26 @@ void Interpreter::DoLoadIC(Callable ic, InterpreterAssembler* assembler) {
 void Interpreter::DoLoadIC(InterpreterAssembler* assembler) {
   Callable ic = CodeFactory::LoadICInOptimizedCode(isolate_, NOT_INSIDE_TYPEOF,
                                                    UNINITIALIZED);
-  DoLoadIC(ic, assembler);
+  Node* result = BuildLoadIC(ic, assembler);
+  __ SetAccumulator(result);
+  __ Dispatch();
 }
 
-void Interpreter::DoKeyedLoadIC(Callable ic, InterpreterAssembler* assembler) {
-  Node* code_target = __ HeapConstant(ic.code());
+// LdrNamedProperty <object> <name_index> <slot> <reg>
+//
+// Calls the LoadIC at FeedBackVector slot <slot> for <object> and the name at
+// constant pool entry <name_index>, and stores the result in register <reg>.
+void Interpreter::DoLdrNamedProperty(InterpreterAssembler* assembler) {
+  Callable ic = CodeFactory::LoadICInOptimizedCode(isolate_, NOT_INSIDE_TYPEOF,
+                                                   UNINITIALIZED);
+  Node* result = BuildLoadIC(ic, assembler);
+  Node* destination = __ BytecodeOperandReg(3);
+  __ StoreRegister(result, destination);
+  __ Dispatch();
+}
+
+Node* Interpreter::BuildKeyedLoadIC(Callable ic,
+                                    InterpreterAssembler* assembler) {
   Node* reg_index = __ BytecodeOperandReg(0);
   Node* object = __ LoadRegister(reg_index);
   Node* name = __ GetAccumulator();
@@ -574,10 +822,8 @@ void Interpreter::DoKeyedLoadIC(Callable ic, InterpreterAssembler* assembler) {
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
   Node* context = __ GetContext();
-  Node* result = __ CallStub(ic.descriptor(), code_target, context, object,
-                             name, smi_slot, type_feedback_vector);
-  __ SetAccumulator(result);
-  __ Dispatch();
+  return BuildLoadICCall(ic, context, object, name, smi_slot,
+                         type_feedback_vector, assembler);
 }
 
 // KeyedLoadIC <object> <slot>
@@ -587,11 +833,25 @@ void Interpreter::DoKeyedLoadIC(Callable ic, InterpreterAssembler* assembler) {
 void Interpreter::DoKeyedLoadIC(InterpreterAssembler* assembler) {
   Callable ic =
       CodeFactory::KeyedLoadICInOptimizedCode(isolate_, UNINITIALIZED);
-  DoKeyedLoadIC(ic, assembler);
+  Node* result = BuildKeyedLoadIC(ic, assembler);
+  __ SetAccumulator(result);
+  __ Dispatch();
+}
+
+// LdrKeyedProperty <object> <slot> <reg>
+//
+// Calls the KeyedLoadIC at FeedBackVector slot <slot> for <object> and the key
+// in the accumulator, and stores the result in register <reg>.
+void Interpreter::DoLdrKeyedProperty(InterpreterAssembler* assembler) {
+  Callable ic =
+      CodeFactory::KeyedLoadICInOptimizedCode(isolate_, UNINITIALIZED);
+  Node* result = BuildKeyedLoadIC(ic, assembler);
+  Node* destination = __ BytecodeOperandReg(2);
+  __ StoreRegister(result, destination);
+  __ Dispatch();
 }
 
 void Interpreter::DoStoreIC(Callable ic, InterpreterAssembler* assembler) {
-  Node* code_target = __ HeapConstant(ic.code());
   Node* object_reg_index = __ BytecodeOperandReg(0);
   Node* object = __ LoadRegister(object_reg_index);
   Node* constant_index = __ BytecodeOperandIdx(1);
@@ -601,8 +861,8 @@ void Interpreter::DoStoreIC(Callable ic, InterpreterAssembler* assembler) {
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
   Node* context = __ GetContext();
-  __ CallStub(ic.descriptor(), code_target, context, object, name, value,
-              smi_slot, type_feedback_vector);
+  BuildStoreICCall(ic, context, object, name, value, smi_slot,
+                   type_feedback_vector, assembler);
   __ Dispatch();
 }
 
@@ -631,7 +891,6 @@ void Interpreter::DoStoreICStrict(InterpreterAssembler* assembler) {
 }
 
 void Interpreter::DoKeyedStoreIC(Callable ic, InterpreterAssembler* assembler) {
-  Node* code_target = __ HeapConstant(ic.code());
   Node* object_reg_index = __ BytecodeOperandReg(0);
   Node* object = __ LoadRegister(object_reg_index);
   Node* name_reg_index = __ BytecodeOperandReg(1);
@@ -641,8 +900,8 @@ void Interpreter::DoKeyedStoreIC(Callable ic, InterpreterAssembler* assembler) {
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
   Node* context = __ GetContext();
-  __ CallStub(ic.descriptor(), code_target, context, object, name, value,
-              smi_slot, type_feedback_vector);
+  BuildStoreICCall(ic, context, object, name, value, smi_slot,
+                   type_feedback_vector, assembler);
   __ Dispatch();
 }
 
@@ -1584,6 +1843,32 @@ void Interpreter::DoStackCheck(InterpreterAssembler* assembler) {
   __ Dispatch();
 }
 
+// OsrPoll <loop_depth>
+//
+// Performs a loop nesting check and potentially triggers OSR.
+void Interpreter::DoOsrPoll(InterpreterAssembler* assembler) {
+  Node* loop_depth = __ BytecodeOperandImm(0);
+  Node* osr_level = __ LoadOSRNestingLevel();
+
+  // Check if OSR points at the given {loop_depth} are armed by comparing it to
+  // the current {osr_level} loaded from the header of the BytecodeArray.
+  Label ok(assembler), osr_armed(assembler, Label::kDeferred);
+  Node* condition = __ Int32GreaterThanOrEqual(loop_depth, osr_level);
+  __ Branch(condition, &ok, &osr_armed);
+
+  __ Bind(&ok);
+  __ Dispatch();
+
+  __ Bind(&osr_armed);
+  {
+    Callable callable = CodeFactory::InterpreterOnStackReplacement(isolate_);
+    Node* target = __ HeapConstant(callable.code());
+    Node* context = __ GetContext();
+    __ CallStub(callable.descriptor(), target, context);
+    __ Dispatch();
+  }
+}
+
 // Throw
 //
 // Throws the exception in the accumulator.
@@ -21,10 +21,39 @@ class Isolate;
 class Callable;
 class CompilationInfo;
 
+namespace compiler {
+class Node;
+}  // namespace compiler
+
 namespace interpreter {
 
 class InterpreterAssembler;
 
+// Bytecode handlers dispatch to the next handler either through the
+// interpreter's dispatch table, which is indexed by bytecode, or through the
+// threaded code of a hot BytecodeArray, which is indexed by bytecode offset.
+enum class DispatchMode : uint8_t { kTable, kThreaded };
+
+// Statistics recorded by bytecode handlers instrumented with
+// --ignition-handler-statistics. Instrumented handlers update the fields
+// directly, see InterpreterAssembler::RecordHandlerStatistics.
+struct HandlerStatistics {
+  static const int kNumberOfBytecodes = static_cast<int>(Bytecode::kLast) + 1;
+
+  // Non-zero while statistics are collected.
+  intptr_t enabled;
+  // Number of handler executions until the next cycle sample is taken.
+  intptr_t sample_countdown;
+  // The bytecode whose handler is currently sampled, or -1.
+  intptr_t sampled_bytecode;
+  // The cycle counter at the start of the current sample.
+  uint64_t sample_start;
+
+  uintptr_t execution_counts[kNumberOfBytecodes];
+  uintptr_t sample_counts[kNumberOfBytecodes];
+  uint64_t sampled_cycles[kNumberOfBytecodes];
+};
+
 class Interpreter {
  public:
   explicit Interpreter(Isolate* isolate);
@@ -42,6 +71,11 @@ class Interpreter {
   // Return bytecode handler for |bytecode|.
   Code* GetBytecodeHandler(Bytecode bytecode, OperandScale operand_scale);
 
+  // Creates the threaded code for |bytecode_array|, which the interpreter entry
+  // trampoline dispatches through on subsequent calls. Returns false if the
+  // threaded bytecode handlers have not been generated.
+  bool ThreadBytecodeArray(Handle<BytecodeArray> bytecode_array);
+
   // GC support.
   void IterateDispatchTable(ObjectVisitor* v);
 
@@ -51,6 +85,22 @@ class Interpreter {
 
   Local<v8::Object> GetDispatchCountersObject();
 
+  // Starts, stops and clears the collection of handler statistics. Only
+  // handlers generated with --ignition-handler-statistics record any.
+  void StartHandlerStatistics();
+  void StopHandlerStatistics();
+  void ResetHandlerStatistics();
+
+  const HandlerStatistics& handler_statistics() const {
+    return handler_statistics_;
+  }
+
+  // Called by instrumented handlers when their sample countdown expires.
+  // Starts a cycle sample of the handler for |bytecode|, or ends the current
+  // sample, in which case the cycles until the entry of the handler for
+  // |bytecode| are attributed to the sampled handler.
+  static void SampleBytecodeHandler(Isolate* isolate, intptr_t bytecode);
+
   Address dispatch_table_address() {
     return reinterpret_cast<Address>(&dispatch_table_[0]);
   }
@@ -59,6 +109,10 @@ class Interpreter {
     return reinterpret_cast<Address>(bytecode_dispatch_counters_table_.get());
   }
 
+  Address handler_statistics_address() {
+    return reinterpret_cast<Address>(&handler_statistics_);
+  }
+
  private:
 // Bytecode handler generator functions.
 #define DECLARE_BYTECODE_HANDLER_GENERATOR(Name, ...) \
@@ -83,17 +137,39 @@ class Interpreter {
   // Generates code to load a constant from the constant pool.
   void DoLoadConstant(InterpreterAssembler* assembler);
 
-  // Generates code to perform a global load via |ic|.
-  void DoLoadGlobal(Callable ic, InterpreterAssembler* assembler);
+  // Generates a call to the load |ic|, or directly to the handler cached in
+  // the feedback if it is monomorphic for |object|, returning the result.
+  compiler::Node* BuildLoadICCall(Callable ic, compiler::Node* context,
+                                  compiler::Node* object, compiler::Node* name,
+                                  compiler::Node* smi_slot,
+                                  compiler::Node* type_feedback_vector,
+                                  InterpreterAssembler* assembler);
+
+  // Generates a call to the store |ic|, or directly to the handler cached in
+  // the feedback if it is monomorphic for |object|.
+  void BuildStoreICCall(Callable ic, compiler::Node* context,
+                        compiler::Node* object, compiler::Node* name,
+                        compiler::Node* value, compiler::Node* smi_slot,
+                        compiler::Node* type_feedback_vector,
+                        InterpreterAssembler* assembler);
+
+  // Generates code to perform a global load via |ic|, returning the result.
+  compiler::Node* BuildLoadGlobal(Callable ic, InterpreterAssembler* assembler);
 
   // Generates code to perform a global store via |ic|.
   void DoStoreGlobal(Callable ic, InterpreterAssembler* assembler);
 
-  // Generates code to perform a named property load via |ic|.
-  void DoLoadIC(Callable ic, InterpreterAssembler* assembler);
+  // Generates code to load a context slot, returning the result.
+  compiler::Node* BuildLoadContextSlot(InterpreterAssembler* assembler);
 
-  // Generates code to perform a keyed property load via |ic|.
-  void DoKeyedLoadIC(Callable ic, InterpreterAssembler* assembler);
+  // Generates code to perform a named property load via |ic|, returning the
+  // result.
+  compiler::Node* BuildLoadIC(Callable ic, InterpreterAssembler* assembler);
+
+  // Generates code to perform a keyed property load via |ic|, returning the
+  // result.
+  compiler::Node* BuildKeyedLoadIC(Callable ic,
+                                   InterpreterAssembler* assembler);
 
   // Generates code to perform a namedproperty store via |ic|.
   void DoStoreIC(Callable ic, InterpreterAssembler* assembler);
@@ -137,7 +213,10 @@ class Interpreter {
   static size_t GetDispatchTableIndex(Bytecode bytecode,
                                       OperandScale operand_scale);
 
-  bool IsDispatchTableInitialized();
+  // Returns the table of handlers dispatching in |dispatch_mode|.
+  Address* GetDispatchTable(DispatchMode dispatch_mode);
+
+  bool IsDispatchTableInitialized(DispatchMode dispatch_mode);
 
   static const int kNumberOfWideVariants = 3;
   static const int kDispatchTableSize = kNumberOfWideVariants * (kMaxUInt8 + 1);
@@ -145,7 +224,9 @@ class Interpreter {
 
   Isolate* isolate_;
   Address dispatch_table_[kDispatchTableSize];
+  Address threaded_dispatch_table_[kDispatchTableSize];
   v8::base::SmartArrayPointer<uintptr_t> bytecode_dispatch_counters_table_;
+  HandlerStatistics handler_statistics_;
 
   DISALLOW_COPY_AND_ASSIGN(Interpreter);
 };
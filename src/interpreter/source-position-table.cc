@@ -128,6 +128,8 @@ void SourcePositionTableBuilder::AddExpressionPosition(size_t bytecode_offset,
 }
 
 void SourcePositionTableBuilder::AddEntry(const PositionTableEntry& entry) {
+  if (Omit()) return;
+
   // Don't encode a new entry if this bytecode already has a source position
   // assigned.
   if (candidate_.bytecode_offset == entry.bytecode_offset) {
@@ -162,7 +164,7 @@ void SourcePositionTableBuilder::CommitEntry() {
 
 Handle<ByteArray> SourcePositionTableBuilder::ToSourcePositionTable() {
   CommitEntry();
-  if (bytes_.empty()) return isolate_->factory()->empty_byte_array();
+  if (bytes_.empty() || Omit()) return isolate_->factory()->empty_byte_array();
 
   Handle<ByteArray> table = isolate_->factory()->NewByteArray(
       static_cast<int>(bytes_.size()), TENURED);
@@ -36,8 +36,15 @@ struct PositionTableEntry {
 
 class SourcePositionTableBuilder : public PositionsRecorder {
  public:
-  SourcePositionTableBuilder(Isolate* isolate, Zone* zone)
+  // With OMIT_SOURCE_POSITIONS no table is built, and the positions are
+  // collected later on demand by regenerating the bytecode.
+  enum RecordingMode { RECORD_SOURCE_POSITIONS, OMIT_SOURCE_POSITIONS };
+
+  SourcePositionTableBuilder(
+      Isolate* isolate, Zone* zone,
+      RecordingMode mode = RECORD_SOURCE_POSITIONS)
       : isolate_(isolate),
+        mode_(mode),
         bytes_(zone),
 #ifdef ENABLE_SLOW_DCHECKS
         raw_entries_(zone),
@@ -49,6 +56,8 @@ class SourcePositionTableBuilder : public PositionsRecorder {
   void AddExpressionPosition(size_t bytecode_offset, int source_position);
   Handle<ByteArray> ToSourcePositionTable();
 
+  bool Omit() const { return mode_ == OMIT_SOURCE_POSITIONS; }
+
  private:
   static const int kUninitializedCandidateOffset = -1;
 
@@ -56,6 +65,7 @@ class SourcePositionTableBuilder : public PositionsRecorder {
   void CommitEntry();
 
   Isolate* isolate_;
+  RecordingMode mode_;
   ZoneVector<byte> bytes_;
 #ifdef ENABLE_SLOW_DCHECKS
   ZoneVector<PositionTableEntry> raw_entries_;
@@ -502,6 +502,22 @@ Handle<JSArray> Isolate::GetDetailedStackTrace(Handle<JSObject> error_object) {
 }
 
 
+// Returns the source position for {code_offset} in {abstract_code}. The
+// source positions of bytecode might not have been collected yet (see
+// --ignition-lazy-source-positions). Collecting them requires a reparse,
+// which must not happen while an exception is thrown or a stack trace is
+// captured, so this falls back to the start of {fun} instead.
+static int SourcePositionOrFunctionStart(JSFunction* fun,
+                                         AbstractCode* abstract_code,
+                                         int code_offset) {
+  if (abstract_code->IsBytecodeArray() &&
+      !abstract_code->GetBytecodeArray()->HasSourcePositionTable()) {
+    return fun->shared()->start_position();
+  }
+  return abstract_code->SourcePosition(code_offset);
+}
+
+
 class CaptureStackTraceHelper {
  public:
   CaptureStackTraceHelper(Isolate* isolate,
@@ -542,7 +558,8 @@ class CaptureStackTraceHelper {
   }
 
   Handle<JSObject> NewStackFrameObject(FrameSummary& summ) {
-    int position = summ.abstract_code()->SourcePosition(summ.code_offset());
+    int position = SourcePositionOrFunctionStart(
+        *summ.function(), *summ.abstract_code(), summ.code_offset());
     return NewStackFrameObject(summ.function(), position,
                                summ.is_constructor());
   }
@@ -667,7 +684,12 @@ int PositionFromStackTrace(Handle<FixedArray> elements, int index) {
   } else {
     AbstractCode* abstract_code = AbstractCode::cast(maybe_code);
     int code_offset = Smi::cast(elements->get(index + 3))->value();
-    return abstract_code->SourcePosition(code_offset);
+    // Wasm frames store a function index instead of the function.
+    if (abstract_code->IsCode()) {
+      return abstract_code->SourcePosition(code_offset);
+    }
+    JSFunction* fun = JSFunction::cast(elements->get(index + 1));
+    return SourcePositionOrFunctionStart(fun, abstract_code, code_offset);
   }
 }
 
@@ -1362,7 +1384,8 @@ void Isolate::PrintCurrentStackTrace(FILE* out) {
     int pos;
     if (frame->is_interpreted()) {
       InterpretedFrame* iframe = reinterpret_cast<InterpretedFrame*>(frame);
-      pos = iframe->GetBytecodeArray()->SourcePosition(
+      pos = SourcePositionOrFunctionStart(
+          iframe->function(), AbstractCode::cast(iframe->GetBytecodeArray()),
           iframe->GetBytecodeOffset());
     } else if (frame->is_java_script()) {
       Code* code = frame->LookupCode();
@@ -1410,7 +1433,8 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
   JavaScriptFrame::cast(frame)->Summarize(&frames);
   FrameSummary& summary = frames.last();
-  int pos = summary.abstract_code()->SourcePosition(summary.code_offset());
+  int pos = SourcePositionOrFunctionStart(
+      *summary.function(), *summary.abstract_code(), summary.code_offset());
   *target = MessageLocation(casted_script, pos, pos + 1, handle(fun));
   return true;
 }
@@ -2222,6 +2246,9 @@ bool Isolate::Init(Deserializer* des) {
   FOR_EACH_ISOLATE_ADDRESS_NAME(ASSIGN_ELEMENT)
 #undef ASSIGN_ELEMENT
 
+  allocator_.ConfigureSegmentPool(
+      static_cast<size_t>(FLAG_zone_segment_pool_size) * KB);
+
   compilation_cache_ = new CompilationCache(this);
   keyed_lookup_cache_ = new KeyedLookupCache();
   context_slot_cache_ = new ContextSlotCache();
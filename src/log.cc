@@ -11,6 +11,7 @@
 #include "src/base/platform/platform.h"
 #include "src/bootstrapper.h"
 #include "src/code-stubs.h"
+#include "src/compiler.h"
 #include "src/deoptimizer.h"
 #include "src/global-handles.h"
 #include "src/interpreter/bytecodes.h"
@@ -53,6 +54,7 @@ static const char* ComputeMarker(SharedFunctionInfo* shared,
   switch (code->kind()) {
     case AbstractCode::FUNCTION:
     case AbstractCode::INTERPRETED_FUNCTION:
+    case AbstractCode::BASELINE_FUNCTION:
       return shared->optimization_disabled() ? "" : "~";
     case AbstractCode::OPTIMIZED_FUNCTION:
       return "*";
@@ -1500,6 +1502,7 @@ void Logger::LogCodeObject(Object* object) {
   switch (code_object->kind()) {
     case AbstractCode::FUNCTION:
     case AbstractCode::INTERPRETED_FUNCTION:
+    case AbstractCode::BASELINE_FUNCTION:
     case AbstractCode::OPTIMIZED_FUNCTION:
       return;  // We log this later using LogCompiledFunctions.
     case AbstractCode::BYTECODE_HANDLER:
@@ -1663,7 +1666,20 @@ void Logger::LogCompiledFunctions() {
   for (int i = 0; i < compiled_funcs_count; ++i) {
     if (code_objects[i].is_identical_to(isolate_->builtins()->CompileLazy()))
       continue;
+    // Listeners expect line information for bytecode that was compiled
+    // before logging started without a source position table.
+    if (code_objects[i]->IsBytecodeArray()) {
+      Compiler::EnsureSourcePositions(sfis[i]);
+    }
     LogExistingFunction(sfis[i], code_objects[i]);
+    // Baseline code hangs off the bytecode rather than the function.
+    if (code_objects[i]->IsBytecodeArray()) {
+      BytecodeArray* bytecode = code_objects[i]->GetBytecodeArray();
+      if (bytecode->HasBaselineCode()) {
+        LogExistingFunction(
+            sfis[i], handle(AbstractCode::cast(bytecode->baseline_code())));
+      }
+    }
   }
 }
 
@@ -193,8 +193,7 @@ class JSArrayBuffer::BodyDescriptor final : public BodyDescriptorBase {
 class BytecodeArray::BodyDescriptor final : public BodyDescriptorBase {
  public:
   static bool IsValidSlot(HeapObject* obj, int offset) {
-    return offset >= kConstantPoolOffset &&
-           offset <= kSourcePositionTableOffset;
+    return offset >= kConstantPoolOffset && offset <= kBaselineCodeOffset;
   }
 
   template <typename ObjectVisitor>
@@ -203,6 +202,8 @@ class BytecodeArray::BodyDescriptor final : public BodyDescriptorBase {
     IteratePointer(obj, kConstantPoolOffset, v);
     IteratePointer(obj, kHandlerTableOffset, v);
     IteratePointer(obj, kSourcePositionTableOffset, v);
+    IteratePointer(obj, kThreadedCodeOffset, v);
+    IteratePointer(obj, kBaselineCodeOffset, v);
   }
 
   template <typename StaticVisitor>
@@ -211,6 +212,8 @@ class BytecodeArray::BodyDescriptor final : public BodyDescriptorBase {
     IteratePointer<StaticVisitor>(heap, obj, kConstantPoolOffset);
     IteratePointer<StaticVisitor>(heap, obj, kHandlerTableOffset);
     IteratePointer<StaticVisitor>(heap, obj, kSourcePositionTableOffset);
+    IteratePointer<StaticVisitor>(heap, obj, kThreadedCodeOffset);
+    IteratePointer<StaticVisitor>(heap, obj, kBaselineCodeOffset);
   }
 
   static inline int SizeOf(Map* map, HeapObject* obj) {
@@ -237,6 +237,10 @@ void BytecodeArray::BytecodeArrayVerify() {
   CHECK(IsBytecodeArray());
   CHECK(constant_pool()->IsFixedArray());
   VerifyHeapPointer(constant_pool());
+  CHECK(source_position_table()->IsByteArray() ||
+        source_position_table()->IsUndefined());
+  CHECK(threaded_code()->IsFixedArray() || threaded_code()->IsUndefined());
+  CHECK(baseline_code()->IsCode() || baseline_code()->IsUndefined());
 }
 
 
@@ -4001,6 +4001,25 @@ void BytecodeArray::set_interrupt_budget(int interrupt_budget) {
   WRITE_INT_FIELD(this, kInterruptBudgetOffset, interrupt_budget);
 }
 
+int BytecodeArray::osr_loop_nesting_level() const {
+  return READ_INT8_FIELD(this, kOSRNestingLevelOffset);
+}
+
+void BytecodeArray::set_osr_loop_nesting_level(int depth) {
+  DCHECK(0 <= depth && depth <= Code::kMaxLoopNestingMarker);
+  WRITE_INT8_FIELD(this, kOSRNestingLevelOffset, depth);
+}
+
+BytecodeArray::Age BytecodeArray::bytecode_age() const {
+  return static_cast<Age>(READ_INT8_FIELD(this, kBytecodeAgeOffset));
+}
+
+void BytecodeArray::set_bytecode_age(BytecodeArray::Age age) {
+  DCHECK_GE(age, kFirstBytecodeAge);
+  DCHECK_LE(age, kLastBytecodeAge);
+  WRITE_INT8_FIELD(this, kBytecodeAgeOffset, static_cast<int8_t>(age));
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
@@ -4010,9 +4029,28 @@ int BytecodeArray::parameter_count() const {
 
 ACCESSORS(BytecodeArray, constant_pool, FixedArray, kConstantPoolOffset)
 ACCESSORS(BytecodeArray, handler_table, FixedArray, kHandlerTableOffset)
-ACCESSORS(BytecodeArray, source_position_table, ByteArray,
+ACCESSORS(BytecodeArray, source_position_table, Object,
           kSourcePositionTableOffset)
 
+bool BytecodeArray::HasSourcePositionTable() {
+  return source_position_table()->IsByteArray();
+}
+
+ByteArray* BytecodeArray::SourcePositionTable() {
+  if (!HasSourcePositionTable()) return GetHeap()->empty_byte_array();
+  return ByteArray::cast(source_position_table());
+}
+
+ACCESSORS(BytecodeArray, threaded_code, Object, kThreadedCodeOffset)
+
+bool BytecodeArray::HasThreadedCode() {
+  return threaded_code()->IsFixedArray();
+}
+
+ACCESSORS(BytecodeArray, baseline_code, Object, kBaselineCodeOffset)
+
+bool BytecodeArray::HasBaselineCode() { return baseline_code()->IsCode(); }
+
 Address BytecodeArray::GetFirstBytecodeAddress() {
   return reinterpret_cast<Address>(this) - kHeapObjectTag + kHeaderSize;
 }
@@ -4397,6 +4397,20 @@ class ByteArray: public FixedArrayBase {
 // BytecodeArray represents a sequence of interpreter bytecodes.
 class BytecodeArray : public FixedArrayBase {
  public:
+  enum Age {
+    kNoAgeBytecodeAge = 0,
+    kQuadragenarianBytecodeAge,
+    kQuinquagenarianBytecodeAge,
+    kSexagenarianBytecodeAge,
+    kSeptuagenarianBytecodeAge,
+    kOctogenarianBytecodeAge,
+    kAfterLastBytecodeAge,
+    kFirstBytecodeAge = kNoAgeBytecodeAge,
+    kLastBytecodeAge = kAfterLastBytecodeAge - 1,
+    kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
+    kIsOldBytecodeAge = kSexagenarianBytecodeAge
+  };
+
   static int SizeFor(int length) {
     return OBJECT_POINTER_ALIGN(kHeaderSize + length);
   }
@@ -4423,6 +4437,16 @@ class BytecodeArray : public FixedArrayBase {
   inline int interrupt_budget() const;
   inline void set_interrupt_budget(int interrupt_budget);
 
+  // Accessors for OSR loop nesting level. Back edges of loops nested deeper
+  // than this level poll for on-stack replacement.
+  inline int osr_loop_nesting_level() const;
+  inline void set_osr_loop_nesting_level(int depth);
+
+  // Accessors for bytecode's code age. The age is reset on every entry to the
+  // function through the interpreter entry trampoline.
+  inline Age bytecode_age() const;
+  inline void set_bytecode_age(Age age);
+
   // Accessors for the constant pool.
   DECL_ACCESSORS(constant_pool, FixedArray)
 
@@ -4430,8 +4454,27 @@ class BytecodeArray : public FixedArrayBase {
   DECL_ACCESSORS(handler_table, FixedArray)
 
   // Accessors for source position table containing mappings between byte code
-  // offset and source position.
-  DECL_ACCESSORS(source_position_table, ByteArray)
+  // offset and source position. This is undefined if the source positions
+  // were omitted at compile time and have not been collected yet.
+  DECL_ACCESSORS(source_position_table, Object)
+
+  // Returns the source position table, or the empty byte array if the source
+  // positions have not been collected.
+  inline ByteArray* SourcePositionTable();
+  inline bool HasSourcePositionTable();
+
+  // Accessors for the threaded code, a FixedArray holding the bytecode handler
+  // for each bytecode offset. This is undefined until the function gets hot
+  // enough for the interpreter to dispatch through it.
+  DECL_ACCESSORS(threaded_code, Object)
+  inline bool HasThreadedCode();
+
+  // Accessors for the baseline code, machine code compiled from the bytecode
+  // that the interpreter entry trampoline runs instead of dispatching to the
+  // bytecode handlers. This is undefined unless the function got hot on a
+  // platform supported by the BaselineCompiler.
+  DECL_ACCESSORS(baseline_code, Object)
+  inline bool HasBaselineCode();
 
   DECLARE_CAST(BytecodeArray)
 
@@ -4450,15 +4493,32 @@ class BytecodeArray : public FixedArrayBase {
 
   void CopyBytecodesTo(BytecodeArray* to);
 
+  // Bytecode aging, which makes the bytecode of functions that were not
+  // executed recently eligible for flushing.
+  void MakeOlder();
+  bool IsOld() const;
+
   // Layout description.
   static const int kConstantPoolOffset = FixedArrayBase::kHeaderSize;
   static const int kHandlerTableOffset = kConstantPoolOffset + kPointerSize;
   static const int kSourcePositionTableOffset =
       kHandlerTableOffset + kPointerSize;
-  static const int kFrameSizeOffset = kSourcePositionTableOffset + kPointerSize;
+  static const int kThreadedCodeOffset =
+      kSourcePositionTableOffset + kPointerSize;
+  static const int kBaselineCodeOffset = kThreadedCodeOffset + kPointerSize;
+  static const int kFrameSizeOffset = kBaselineCodeOffset + kPointerSize;
   static const int kParameterSizeOffset = kFrameSizeOffset + kIntSize;
   static const int kInterruptBudgetOffset = kParameterSizeOffset + kIntSize;
-  static const int kHeaderSize = kInterruptBudgetOffset + kIntSize;
+  static const int kOSRNestingLevelOffset = kInterruptBudgetOffset + kIntSize;
+  static const int kBytecodeAgeOffset = kOSRNestingLevelOffset + kCharSize;
+  static const int kHeaderSize = kBytecodeAgeOffset + kCharSize;
+
+  // Offset from the tagged threaded code array to the biased dispatch table
+  // pointer that is indexed by bytecode offsets relative to the tagged
+  // BytecodeArray, i.e. including its header.
+  static const int kThreadedDispatchTableBias =
+      FixedArray::kHeaderSize - kHeapObjectTag -
+      (kHeaderSize - kHeapObjectTag) * kPointerSize;
 
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
@@ -4839,6 +4899,7 @@ class Code: public HeapObject {
 #define NON_IC_KIND_LIST(V) \
   V(FUNCTION)               \
   V(OPTIMIZED_FUNCTION)     \
+  V(BASELINE_FUNCTION)      \
   V(BYTECODE_HANDLER)       \
   V(STUB)                   \
   V(HANDLER)                \
@@ -0,0 +1,238 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/character-runs.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#endif
+
+#include "src/base/bits.h"
+#include "src/char-predicates-inl.h"
+#include "src/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Each run class classifies a single code unit with Ends() and, on x64, a
+// vector of code units at a time with EndMask<Char>(), which sets all bits of
+// the lanes holding code units that end the run.
+
+bool IsLineTerminatorCodeUnit(uint16_t c) {
+  return c == '\n' || c == '\r' || (c & 0xFFFE) == 0x2028;
+}
+
+#if V8_HOST_ARCH_X64
+
+// Lane-wise operations on vectors of Char code units. The comparisons are
+// signed, so code units at and above 0x80 (one-byte) or 0x8000 (UTF-16) are
+// negative.
+template <typename Char>
+class Lanes;
+
+template <>
+class Lanes<uint8_t> {
+ public:
+  static __m128i Splat(uint16_t c) {
+    DCHECK_LE(c, kMaxUInt8);
+    return _mm_set1_epi8(static_cast<int8_t>(c));
+  }
+  static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+  static __m128i GreaterThan(__m128i a, __m128i b) {
+    return _mm_cmpgt_epi8(a, b);
+  }
+  static __m128i LessThan(__m128i a, __m128i b) {
+    return _mm_cmplt_epi8(a, b);
+  }
+  // Neither U+2028 nor U+2029 is a one-byte character.
+  static __m128i ParagraphOrLineSeparatorMask(__m128i chars) {
+    return _mm_setzero_si128();
+  }
+};
+
+template <>
+class Lanes<uint16_t> {
+ public:
+  static __m128i Splat(uint16_t c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+  static __m128i GreaterThan(__m128i a, __m128i b) {
+    return _mm_cmpgt_epi16(a, b);
+  }
+  static __m128i LessThan(__m128i a, __m128i b) {
+    return _mm_cmplt_epi16(a, b);
+  }
+  static __m128i ParagraphOrLineSeparatorMask(__m128i chars) {
+    return _mm_cmpeq_epi16(_mm_and_si128(chars, Splat(0xFFFE)), Splat(0x2028));
+  }
+};
+
+template <typename Char>
+__m128i Equal(__m128i chars, uint16_t c) {
+  return Lanes<Char>::Equal(chars, Lanes<Char>::Splat(c));
+}
+
+__m128i Not(__m128i mask) {
+  return _mm_xor_si128(mask, _mm_cmpeq_epi8(mask, mask));
+}
+
+// Matches the code units in [from, to]. Both bounds must be ASCII, as the
+// comparisons are signed.
+template <typename Char>
+__m128i InRange(__m128i chars, uint16_t from, uint16_t to) {
+  return _mm_and_si128(
+      Lanes<Char>::GreaterThan(chars, Lanes<Char>::Splat(from - 1)),
+      Lanes<Char>::LessThan(chars, Lanes<Char>::Splat(to + 1)));
+}
+
+template <typename Char>
+__m128i NonAsciiMask(__m128i chars) {
+  return _mm_or_si128(
+      Lanes<Char>::LessThan(chars, _mm_setzero_si128()),
+      Lanes<Char>::GreaterThan(
+          chars, Lanes<Char>::Splat(unibrow::Utf8::kMaxOneByteChar)));
+}
+
+template <typename Char>
+__m128i LineTerminatorMask(__m128i chars) {
+  return _mm_or_si128(
+      _mm_or_si128(Equal<Char>(chars, '\n'), Equal<Char>(chars, '\r')),
+      Lanes<Char>::ParagraphOrLineSeparatorMask(chars));
+}
+
+#endif  // V8_HOST_ARCH_X64
+
+class WhiteSpaceRun {
+ public:
+  bool Ends(uint16_t c) const { return c != ' ' && c != '\t'; }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  __m128i EndMask(__m128i chars) const {
+    return Not(_mm_or_si128(Equal<Char>(chars, ' '), Equal<Char>(chars, '\t')));
+  }
+#endif
+};
+
+class SingleLineCommentRun {
+ public:
+  bool Ends(uint16_t c) const { return IsLineTerminatorCodeUnit(c); }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  __m128i EndMask(__m128i chars) const {
+    return LineTerminatorMask<Char>(chars);
+  }
+#endif
+};
+
+class MultiLineCommentRun {
+ public:
+  bool Ends(uint16_t c) const {
+    return c == '*' || IsLineTerminatorCodeUnit(c);
+  }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  __m128i EndMask(__m128i chars) const {
+    return _mm_or_si128(Equal<Char>(chars, '*'),
+                        LineTerminatorMask<Char>(chars));
+  }
+#endif
+};
+
+class AsciiIdentifierPartRun {
+ public:
+  bool Ends(uint16_t c) const { return !IsAsciiIdentifier(c); }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  __m128i EndMask(__m128i chars) const {
+    // Setting bit 5 maps upper case letters to lower case ones and leaves
+    // non-ASCII code units negative or above the ASCII range.
+    __m128i lower_case = _mm_or_si128(chars, Lanes<Char>::Splat(0x20));
+    __m128i in_run = _mm_or_si128(
+        _mm_or_si128(InRange<Char>(lower_case, 'a', 'z'),
+                     InRange<Char>(chars, '0', '9')),
+        _mm_or_si128(Equal<Char>(chars, '_'), Equal<Char>(chars, '$')));
+    return Not(in_run);
+  }
+#endif
+};
+
+class StringLiteralRun {
+ public:
+  explicit StringLiteralRun(uint16_t quote) : quote_(quote) {
+    DCHECK(quote == '"' || quote == '\'');
+  }
+
+  bool Ends(uint16_t c) const {
+    return c == quote_ || c == '\\' || c == '\n' || c == '\r' ||
+           c > unibrow::Utf8::kMaxOneByteChar;
+  }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  __m128i EndMask(__m128i chars) const {
+    return _mm_or_si128(
+        _mm_or_si128(Equal<Char>(chars, quote_), Equal<Char>(chars, '\\')),
+        _mm_or_si128(
+            _mm_or_si128(Equal<Char>(chars, '\n'), Equal<Char>(chars, '\r')),
+            NonAsciiMask<Char>(chars)));
+  }
+#endif
+
+ private:
+  uint16_t quote_;
+};
+
+template <typename Char, typename Run>
+size_t RunLength(const Char* chars, size_t length, const Run& run) {
+  size_t i = 0;
+#if V8_HOST_ARCH_X64
+  static const size_t kCodeUnitsPerVector = sizeof(__m128i) / sizeof(Char);
+  for (; i + kCodeUnitsPerVector <= length; i += kCodeUnitsPerVector) {
+    __m128i vector =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    uint32_t mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(run.template EndMask<Char>(vector)));
+    if (mask != 0) {
+      // The mask has one bit per byte of each code unit.
+      return i + base::bits::CountTrailingZeros32(mask) / sizeof(Char);
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (run.Ends(chars[i])) return i;
+  }
+  return length;
+}
+
+}  // namespace
+
+template <typename Char>
+size_t CharacterRunLength(CharacterRun run, const Char* chars, size_t length) {
+  switch (run) {
+    case CharacterRun::kWhiteSpace:
+      return RunLength(chars, length, WhiteSpaceRun());
+    case CharacterRun::kSingleLineComment:
+      return RunLength(chars, length, SingleLineCommentRun());
+    case CharacterRun::kMultiLineComment:
+      return RunLength(chars, length, MultiLineCommentRun());
+    case CharacterRun::kAsciiIdentifierPart:
+      return RunLength(chars, length, AsciiIdentifierPartRun());
+    case CharacterRun::kSingleQuotedString:
+      return RunLength(chars, length, StringLiteralRun('\''));
+    case CharacterRun::kDoubleQuotedString:
+      return RunLength(chars, length, StringLiteralRun('"'));
+  }
+  UNREACHABLE();
+  return 0;
+}
+
+template size_t CharacterRunLength(CharacterRun run, const uint8_t* chars,
+                                   size_t length);
+template size_t CharacterRunLength(CharacterRun run, const uint16_t* chars,
+                                   size_t length);
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,41 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_CHARACTER_RUNS_H_
+#define V8_PARSING_CHARACTER_RUNS_H_
+
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Runs of code units that the scanner can skip or copy in bulk instead of
+// classifying one character at a time.
+enum class CharacterRun {
+  // Spaces and tabs.
+  kWhiteSpace,
+  // Anything but line terminators, i.e. the body of a single-line comment.
+  kSingleLineComment,
+  // Anything but line terminators and '*', i.e. the parts of a multi-line
+  // comment that can neither end the comment nor contain a line break.
+  kMultiLineComment,
+  // ASCII identifier parts, i.e. [a-zA-Z0-9_$].
+  kAsciiIdentifierPart,
+  // ASCII characters in a string literal delimited by ' or " that need no
+  // special handling, i.e. anything but the quote, escapes and line breaks.
+  kSingleQuotedString,
+  kDoubleQuotedString
+};
+
+// Returns the number of code units at the start of |chars| belonging to
+// |run|, which is |length| if the run does not end within |chars|. Char is
+// uint8_t for one-byte and uint16_t for UTF-16 code units. On x64 the code
+// units are classified sixteen or eight at a time using SSE2.
+template <typename Char>
+size_t CharacterRunLength(CharacterRun run, const Char* chars, size_t length);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_CHARACTER_RUNS_H_
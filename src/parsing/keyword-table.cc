@@ -0,0 +1,159 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/keyword-table.h"
+
+namespace v8 {
+namespace internal {
+
+// The words of the table in index order: the keywords with their tokens,
+// followed by common identifiers. Run tools/gen-keyword-table.py after
+// changing the list.
+#define KEYWORD_TABLE_WORDS(V)                        \
+  V("await", Token::AWAIT)                            \
+  V("break", Token::BREAK)                            \
+  V("case", Token::CASE)                              \
+  V("catch", Token::CATCH)                            \
+  V("class", Token::CLASS)                            \
+  V("const", Token::CONST)                            \
+  V("continue", Token::CONTINUE)                      \
+  V("debugger", Token::DEBUGGER)                      \
+  V("default", Token::DEFAULT)                        \
+  V("delete", Token::DELETE)                          \
+  V("do", Token::DO)                                  \
+  V("else", Token::ELSE)                              \
+  V("enum", Token::ENUM)                              \
+  V("export", Token::EXPORT)                          \
+  V("extends", Token::EXTENDS)                        \
+  V("false", Token::FALSE_LITERAL)                    \
+  V("finally", Token::FINALLY)                        \
+  V("for", Token::FOR)                                \
+  V("function", Token::FUNCTION)                      \
+  V("if", Token::IF)                                  \
+  V("implements", Token::FUTURE_STRICT_RESERVED_WORD) \
+  V("import", Token::IMPORT)                          \
+  V("in", Token::IN)                                  \
+  V("instanceof", Token::INSTANCEOF)                  \
+  V("interface", Token::FUTURE_STRICT_RESERVED_WORD)  \
+  V("let", Token::LET)                                \
+  V("new", Token::NEW)                                \
+  V("null", Token::NULL_LITERAL)                      \
+  V("package", Token::FUTURE_STRICT_RESERVED_WORD)    \
+  V("private", Token::FUTURE_STRICT_RESERVED_WORD)    \
+  V("protected", Token::FUTURE_STRICT_RESERVED_WORD)  \
+  V("public", Token::FUTURE_STRICT_RESERVED_WORD)     \
+  V("return", Token::RETURN)                          \
+  V("static", Token::STATIC)                          \
+  V("super", Token::SUPER)                            \
+  V("switch", Token::SWITCH)                          \
+  V("this", Token::THIS)                              \
+  V("throw", Token::THROW)                            \
+  V("true", Token::TRUE_LITERAL)                      \
+  V("try", Token::TRY)                                \
+  V("typeof", Token::TYPEOF)                          \
+  V("var", Token::VAR)                                \
+  V("void", Token::VOID)                              \
+  V("while", Token::WHILE)                            \
+  V("with", Token::WITH)                              \
+  V("yield", Token::YIELD)                            \
+  V("arguments", Token::IDENTIFIER)                   \
+  V("constructor", Token::IDENTIFIER)                 \
+  V("eval", Token::IDENTIFIER)                        \
+  V("undefined", Token::IDENTIFIER)                   \
+  V("prototype", Token::IDENTIFIER)                   \
+  V("__proto__", Token::IDENTIFIER)                   \
+  V("length", Token::IDENTIFIER)                      \
+  V("value", Token::IDENTIFIER)                       \
+  V("done", Token::IDENTIFIER)                        \
+  V("next", Token::IDENTIFIER)                        \
+  V("get", Token::IDENTIFIER)                         \
+  V("set", Token::IDENTIFIER)                         \
+  V("of", Token::IDENTIFIER)                          \
+  V("name", Token::IDENTIFIER)                        \
+  V("call", Token::IDENTIFIER)                        \
+  V("apply", Token::IDENTIFIER)                       \
+  V("bind", Token::IDENTIFIER)                        \
+  V("push", Token::IDENTIFIER)                        \
+  V("slice", Token::IDENTIFIER)                       \
+  V("indexOf", Token::IDENTIFIER)                     \
+  V("toString", Token::IDENTIFIER)                    \
+  V("hasOwnProperty", Token::IDENTIFIER)              \
+  V("exports", Token::IDENTIFIER)                     \
+  V("module", Token::IDENTIFIER)                      \
+  V("require", Token::IDENTIFIER)                     \
+  V("window", Token::IDENTIFIER)                      \
+  V("document", Token::IDENTIFIER)                    \
+  V("console", Token::IDENTIFIER)                     \
+  V("self", Token::IDENTIFIER)                        \
+  V("key", Token::IDENTIFIER)                         \
+  V("type", Token::IDENTIFIER)                        \
+  V("data", Token::IDENTIFIER)                        \
+  V("options", Token::IDENTIFIER)                     \
+  V("Object", Token::IDENTIFIER)                      \
+  V("Array", Token::IDENTIFIER)                       \
+  V("Math", Token::IDENTIFIER)                        \
+  V("String", Token::IDENTIFIER)                      \
+  V("Error", Token::IDENTIFIER)                       \
+  V("JSON", Token::IDENTIFIER)
+
+const int KeywordTable::kNotFound;
+const int KeywordTable::kWordCount;
+
+#define WORD(chars, token) {chars, sizeof(chars) - 1, token},
+const KeywordTable::Word KeywordTable::kWords[kWordCount] = {
+    KEYWORD_TABLE_WORDS(WORD)};
+#undef WORD
+
+#define WORD(chars, token) +1
+STATIC_ASSERT(KeywordTable::kWordCount == 0 KEYWORD_TABLE_WORDS(WORD));
+#undef WORD
+
+const uint8_t KeywordTable::kSlots[kSlotCount] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   4, 255,
+     46, 255, 255,  81, 255, 255, 255, 255,  80, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  23,  51,
+    255, 255,  14, 255, 255, 255, 255, 255, 255, 255, 255,  75,
+     77, 255, 255, 255, 255, 255, 255,  60,  19, 255, 255, 255,
+    255, 255, 255,  73,   6, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255,  82, 255, 255, 255, 255, 255, 255,
+    255, 255,  34, 255, 255, 255, 255, 255,   2,  72, 255, 255,
+     50, 255, 255, 255, 255, 255, 255, 255, 255,  40,  39, 255,
+    255, 255, 255, 255, 255,  21, 255, 255, 255, 255, 255, 255,
+    255,  28, 255, 255,   3,  12, 255, 255, 255, 255,  37, 255,
+     58, 255, 255, 255,  17, 255, 255, 255, 255, 255, 255, 255,
+    255, 255,  78, 255,  43, 255, 255,  38, 255, 255, 255, 255,
+    255, 255, 255, 255, 255,  49,   9, 255, 255, 255, 255, 255,
+    255, 255, 255, 255,  67, 255, 255, 255, 255,  15, 255, 255,
+    255,  30, 255, 255, 255, 255,  56, 255,  76, 255,  61, 255,
+    255, 255, 255,  26, 255, 255, 255, 255, 255, 255,  20, 255,
+    255, 255, 255, 255, 255,  53, 255, 255, 255, 255, 255, 255,
+    255, 255, 255,  63, 255, 255,  59, 255, 255,  55,  45,  33,
+    255, 255,  69, 255, 255, 255, 255, 255, 255, 255,  66,  52,
+    255,  27, 255, 255,   8, 255, 255, 255,  22, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255,  74, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255,  62, 255, 255, 255, 255, 255,   7, 255, 255, 255, 255,
+    255, 255, 255, 255, 255,  35,  41, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255,  42,   5, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255,  57, 255, 255, 255, 255, 255,  13, 255,  79, 255,
+    255,  65, 255, 255,   0, 255, 255, 255, 255, 255,  10, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255,  18, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255,  31, 255, 255,  44,
+    255, 255, 255,  11, 255, 255, 255, 255,  24,  70, 255, 255,
+    255, 255, 255, 255, 255, 255,  54, 255, 255, 255, 255, 255,
+     25, 255, 255, 255, 255, 255,  29, 255, 255, 255,  68, 255,
+    255, 255, 255,  16, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255,  84,  64, 255, 255, 255, 255, 255, 255,  36,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255,   1, 255, 255, 255, 255, 255, 255, 255,  71, 255,
+    255, 255,  48, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255,  83, 255,  32,  47, 255,
+};
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,92 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_KEYWORD_TABLE_H_
+#define V8_PARSING_KEYWORD_TABLE_H_
+
+#include <string.h>
+
+#include "src/allocation.h"
+#include "src/parsing/token.h"
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// A perfect hash table of the keywords and of identifiers that are common in
+// JavaScript code. The scanner looks identifiers up here to classify keywords,
+// and the AstValueFactory uses the index of a word to find its AstRawString
+// without hashing the word and probing its string table again.
+class KeywordTable : public AllStatic {
+ public:
+  static const int kNotFound = -1;
+  static const int kWordCount = 85;
+
+  // Returns the index of the word |chars|, or kNotFound if it is not in the
+  // table.
+  static inline int Lookup(const uint8_t* chars, int length);
+
+  // The token of the word at |index|, which is Token::IDENTIFIER for the words
+  // that are not keywords.
+  static Token::Value token(int index) {
+    DCHECK(0 <= index && index < kWordCount);
+    return kWords[index].token;
+  }
+
+  static Vector<const uint8_t> word(int index) {
+    DCHECK(0 <= index && index < kWordCount);
+    return Vector<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(kWords[index].chars),
+        kWords[index].length);
+  }
+
+ private:
+  struct Word {
+    const char* chars;
+    int length;
+    Token::Value token;
+  };
+
+  static const int kMinLength = 2;
+  static const int kMaxLength = 14;
+  static const int kSlotCount = 512;
+  static const uint8_t kEmptySlot = 0xFF;
+
+  // The multipliers of the hash and kSlots are generated by
+  // tools/gen-keyword-table.py from the words in keyword-table.cc.
+  static const uint32_t kFirstCharMultiplier = 2402;
+  static const uint32_t kSecondCharMultiplier = 2477;
+  static const uint32_t kThirdCharMultiplier = 1822;
+  static const uint32_t kLastCharMultiplier = 2987;
+
+  static uint32_t Hash(const uint8_t* chars, int length) {
+    uint32_t third_char = length > 2 ? chars[2] : 0;
+    uint32_t hash = chars[0] * kFirstCharMultiplier +
+                    chars[1] * kSecondCharMultiplier +
+                    third_char * kThirdCharMultiplier +
+                    chars[length - 1] * kLastCharMultiplier + length;
+    return hash & (kSlotCount - 1);
+  }
+
+  static const Word kWords[kWordCount];
+  // The index of the word hashing to each slot, or kEmptySlot.
+  static const uint8_t kSlots[kSlotCount];
+};
+
+
+int KeywordTable::Lookup(const uint8_t* chars, int length) {
+  if (length < kMinLength || length > kMaxLength) return kNotFound;
+  int index = kSlots[Hash(chars, length)];
+  if (index == kEmptySlot) return kNotFound;
+  const Word& word = kWords[index];
+  if (word.length != length || memcmp(word.chars, chars, length) != 0) {
+    return kNotFound;
+  }
+  return index;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_KEYWORD_TABLE_H_
@@ -0,0 +1,618 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include "src/ast/ast-value-factory.h"
+#include "src/base/smart-pointers.h"
+#include "src/cancelable-task.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/parsing/preparse-data.h"
+#include "src/parsing/preparser.h"
+#include "src/parsing/scanner.h"
+#include "src/unicode-cache.h"
+#include "src/v8.h"
+#include "src/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Streams over the source characters held by the ParallelPreParser. Unlike
+// the streams over heap strings, they can be read on any thread.
+class OneByteSourceStream : public Utf16CharacterStream {
+ public:
+  OneByteSourceStream(const uint8_t* data, int start_position,
+                      int end_position)
+      : data_(data), bookmark_(kNoBookmark) {
+    one_byte_cursor_ = data + start_position;
+    one_byte_end_ = data + end_position;
+    pos_ = start_position;
+  }
+
+  void PushBack(int32_t code_unit) override {
+    DCHECK(one_byte_cursor_ > data_);
+    pos_--;
+    if (code_unit != kEndOfInput) one_byte_cursor_--;
+  }
+
+  bool SetBookmark() override {
+    bookmark_ = pos_;
+    return true;
+  }
+
+  void ResetToBookmark() override {
+    DCHECK(bookmark_ != kNoBookmark);
+    pos_ = bookmark_;
+    one_byte_cursor_ = data_ + bookmark_;
+  }
+
+ protected:
+  size_t SlowSeekForward(size_t delta) override {
+    // Fast case always handles seeking.
+    return 0;
+  }
+  bool ReadBlock() override {
+    // Entire source is read at start.
+    return false;
+  }
+
+ private:
+  static const size_t kNoBookmark = -1;
+
+  const uint8_t* data_;
+  size_t bookmark_;
+};
+
+class TwoByteSourceStream : public Utf16CharacterStream {
+ public:
+  TwoByteSourceStream(const uint16_t* data, int start_position,
+                      int end_position)
+      : data_(data), bookmark_(kNoBookmark) {
+    buffer_cursor_ = data + start_position;
+    buffer_end_ = data + end_position;
+    pos_ = start_position;
+  }
+
+  void PushBack(int32_t code_unit) override {
+    DCHECK(buffer_cursor_ > data_);
+    pos_--;
+    if (code_unit != kEndOfInput) buffer_cursor_--;
+  }
+
+  bool SetBookmark() override {
+    bookmark_ = pos_;
+    return true;
+  }
+
+  void ResetToBookmark() override {
+    DCHECK(bookmark_ != kNoBookmark);
+    pos_ = bookmark_;
+    buffer_cursor_ = data_ + bookmark_;
+  }
+
+ protected:
+  size_t SlowSeekForward(size_t delta) override {
+    // Fast case always handles seeking.
+    return 0;
+  }
+  bool ReadBlock() override {
+    // Entire source is read at start.
+    return false;
+  }
+
+ private:
+  static const size_t kNoBookmark = -1;
+
+  const uint16_t* data_;
+  size_t bookmark_;
+};
+
+}  // namespace
+
+// Finds the bodies of the functions the parser is going to preparse, using
+// only the tokens of the script. Regular expressions are told apart from
+// divisions by the preceding token, and the closing braces of template
+// substitutions by the brace depth at which the substitution started.
+//
+// Function literals in top-level code are preparsed by the parser. The bodies
+// of parenthesized functions are fully parsed, so the functions defined in
+// them are preparsed too. All other function bodies are skipped.
+class ParallelPreParser::Skimmer {
+ public:
+  Skimmer(ParallelPreParser* owner, Utf16CharacterStream* stream,
+          UnicodeCache* unicode_cache)
+      : owner_(owner),
+        scanner_(unicode_cache),
+        done_(false),
+        brace_depth_(0),
+        skipped_depth_(kNoDepth),
+        previous_(Token::ILLEGAL),
+        regexp_allowed_(true) {
+    scanner_.Initialize(stream);
+  }
+
+  void Skim() {
+    contexts_.Add(CodeContext(0, owner_->language_mode_));
+    SkimDirectivePrologue();
+    for (int count = 1; !done_; count++) {
+      if (count % kAbortCheckInterval == 0 && owner_->aborted()) return;
+      Token::Value before = previous_;
+      switch (Next()) {
+        case Token::FUNCTION:
+          if (skipped_depth_ == kNoDepth) SkimFunction(before);
+          break;
+        case Token::ARROW:
+          if (peek() == Token::LBRACE) {
+            Next();
+            if (skipped_depth_ == kNoDepth) skipped_depth_ = brace_depth_ - 1;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+ private:
+  static const int kNoDepth = -1;
+  static const int kAbortCheckInterval = 4096;
+
+  // Top-level code, or the body of a parenthesized function.
+  struct CodeContext {
+    CodeContext(int brace_depth, LanguageMode language_mode)
+        : brace_depth(brace_depth), language_mode(language_mode) {}
+    int brace_depth;
+    LanguageMode language_mode;
+  };
+
+  Token::Value peek() const { return scanner_.peek(); }
+
+  Token::Value Next() {
+    Token::Value token = peek();
+    if ((token == Token::DIV || token == Token::ASSIGN_DIV) &&
+        regexp_allowed_) {
+      if (!scanner_.ScanRegExpPattern(token == Token::ASSIGN_DIV) ||
+          scanner_.ScanRegExpFlags().IsNothing()) {
+        done_ = true;
+        return Token::ILLEGAL;
+      }
+      scanner_.Next();
+      regexp_allowed_ = false;
+      previous_ = token;
+      return token;
+    }
+    if (token == Token::RBRACE && !template_depths_.is_empty() &&
+        template_depths_.last() == brace_depth_) {
+      // The substitution is followed by another one or by the template end.
+      token = scanner_.ScanTemplateContinuation();
+      scanner_.Next();
+      if (token != Token::TEMPLATE_SPAN) template_depths_.RemoveLast();
+    } else {
+      scanner_.Next();
+      if (token == Token::TEMPLATE_SPAN) template_depths_.Add(brace_depth_);
+    }
+    switch (token) {
+      case Token::EOS:
+      case Token::ILLEGAL:
+        done_ = true;
+        break;
+      case Token::LBRACE:
+        brace_depth_++;
+        break;
+      case Token::RBRACE:
+        brace_depth_--;
+        if (brace_depth_ == skipped_depth_) {
+          skipped_depth_ = kNoDepth;
+        } else if (contexts_.length() > 1 &&
+                   contexts_.last().brace_depth == brace_depth_) {
+          contexts_.RemoveLast();
+        }
+        break;
+      default:
+        break;
+    }
+    regexp_allowed_ = !EndsOperand(token);
+    previous_ = token;
+    return token;
+  }
+
+  static bool EndsOperand(Token::Value token) {
+    switch (token) {
+      case Token::IDENTIFIER:
+      case Token::FUTURE_STRICT_RESERVED_WORD:
+      case Token::ESCAPED_STRICT_RESERVED_WORD:
+      case Token::LET:
+      case Token::STATIC:
+      case Token::NUMBER:
+      case Token::SMI:
+      case Token::STRING:
+      case Token::THIS:
+      case Token::SUPER:
+      case Token::NULL_LITERAL:
+      case Token::TRUE_LITERAL:
+      case Token::FALSE_LITERAL:
+      case Token::TEMPLATE_TAIL:
+      case Token::RPAREN:
+      case Token::RBRACK:
+      case Token::RBRACE:
+      case Token::INC:
+      case Token::DEC:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Records "use strict" directives at the start of the current context.
+  void SkimDirectivePrologue() {
+    while (peek() == Token::STRING) {
+      Next();
+      bool use_strict =
+          scanner_.UnescapedLiteralMatches("use strict", 10) &&
+          scanner_.location().end_pos - scanner_.location().beg_pos == 12;
+      if (peek() != Token::SEMICOLON && peek() != Token::RBRACE &&
+          peek() != Token::EOS && !scanner_.HasAnyLineTerminatorBeforeNext()) {
+        return;
+      }
+      if (use_strict) contexts_.last().language_mode = STRICT;
+      if (peek() == Token::SEMICOLON) Next();
+    }
+  }
+
+  // Called after the 'function' keyword, which followed |before|.
+  void SkimFunction(Token::Value before) {
+    // The bodies of generators are skimmed like any other code.
+    if (peek() == Token::MUL) return;
+    if (peek() != Token::LPAREN) Next();
+    if (peek() != Token::LPAREN) return;
+    Next();
+    bool has_simple_parameters = true;
+    for (int paren_depth = 1; paren_depth > 0 && !done_;) {
+      switch (Next()) {
+        case Token::LPAREN:
+          paren_depth++;
+          has_simple_parameters = false;
+          break;
+        case Token::RPAREN:
+          paren_depth--;
+          break;
+        case Token::IDENTIFIER:
+        case Token::COMMA:
+          break;
+        default:
+          has_simple_parameters = false;
+          break;
+      }
+    }
+    if (peek() != Token::LBRACE) return;
+    Next();
+    if (before == Token::LPAREN) {
+      contexts_.Add(
+          CodeContext(brace_depth_ - 1, contexts_.last().language_mode));
+      SkimDirectivePrologue();
+      return;
+    }
+    if (has_simple_parameters) {
+      owner_->AddJob(scanner_.location().beg_pos,
+                     contexts_.last().language_mode);
+    }
+    skipped_depth_ = brace_depth_ - 1;
+  }
+
+  ParallelPreParser* owner_;
+  Scanner scanner_;
+  bool done_;
+  int brace_depth_;
+  // The brace depth outside of the function body being skipped, if any.
+  int skipped_depth_;
+  List<CodeContext> contexts_;
+  // The brace depths at which the open template substitutions started.
+  List<int> template_depths_;
+  Token::Value previous_;
+  bool regexp_allowed_;
+
+  DISALLOW_COPY_AND_ASSIGN(Skimmer);
+};
+
+class ParallelPreParser::SkimTask : public CancelableTask {
+ public:
+  SkimTask(Isolate* isolate, ParallelPreParser* owner)
+      : CancelableTask(isolate), owner_(owner) {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHandleDereference no_deref;
+
+    UnicodeCache unicode_cache;
+    base::SmartPointer<Utf16CharacterStream> stream(owner_->NewStream(0));
+    Skimmer skimmer(owner_, stream.get(), &unicode_cache);
+    skimmer.Skim();
+    owner_->FinishSkimming();
+    owner_->pending_tasks_.Signal();
+  }
+
+  ParallelPreParser* owner_;
+
+  DISALLOW_COPY_AND_ASSIGN(SkimTask);
+};
+
+class ParallelPreParser::PreParseTask : public CancelableTask {
+ public:
+  PreParseTask(Isolate* isolate, ParallelPreParser* owner)
+      : CancelableTask(isolate), owner_(owner) {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHandleDereference no_deref;
+
+    UnicodeCache unicode_cache;
+    for (Job* job = owner_->NextJob(); job != NULL; job = owner_->NextJob()) {
+      owner_->PreParseJob(job, &unicode_cache);
+    }
+    owner_->pending_tasks_.Signal();
+  }
+
+  ParallelPreParser* owner_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreParseTask);
+};
+
+ParallelPreParser::ParallelPreParser(Isolate* isolate, Handle<String> source,
+                                     LanguageMode language_mode)
+    : isolate_(isolate),
+      allocator_(isolate->allocator()),
+      hash_seed_(isolate->heap()->HashSeed()),
+      language_mode_(language_mode),
+      one_byte_source_(NULL),
+      two_byte_source_(NULL),
+      source_length_(source->length()),
+      one_byte_copy_(NULL),
+      two_byte_copy_(NULL),
+      allow_natives_(false),
+      allow_harmony_do_expressions_(false),
+      allow_harmony_for_in_(false),
+      allow_harmony_function_name_(false),
+      allow_harmony_function_sent_(false),
+      allow_harmony_exponentiation_operator_(false),
+      allow_harmony_restrictive_declarations_(false),
+      next_job_(0),
+      next_consumed_job_(0),
+      parser_position_(0),
+      skimming_done_(false),
+      aborted_(false),
+      consumed_count_(0),
+      num_tasks_(0),
+      pending_tasks_(0) {
+  DCHECK(source->IsFlat());
+  DisallowHeapAllocation no_allocation;
+  // The characters of external strings do not move.
+  if (source->IsExternalOneByteString()) {
+    one_byte_source_ = ExternalOneByteString::cast(*source)->GetChars();
+  } else if (source->IsExternalTwoByteString()) {
+    two_byte_source_ = ExternalTwoByteString::cast(*source)->GetChars();
+  } else if (source->IsOneByteRepresentation()) {
+    one_byte_copy_ = NewArray<uint8_t>(source_length_);
+    String::WriteToFlat(*source, one_byte_copy_, 0, source_length_);
+    one_byte_source_ = one_byte_copy_;
+  } else {
+    two_byte_copy_ = NewArray<uint16_t>(source_length_);
+    String::WriteToFlat(*source, two_byte_copy_, 0, source_length_);
+    two_byte_source_ = two_byte_copy_;
+  }
+}
+
+ParallelPreParser::~ParallelPreParser() {
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    aborted_ = true;
+    jobs_changed_.NotifyAll();
+  }
+  for (int i = 0; i < num_tasks_; i++) {
+    if (!isolate_->cancelable_task_manager()->TryAbort(task_ids_[i])) {
+      pending_tasks_.Wait();
+    }
+  }
+  for (int i = 0; i < jobs_.length(); i++) delete jobs_[i];
+  DeleteArray(one_byte_copy_);
+  DeleteArray(two_byte_copy_);
+}
+
+// static
+bool ParallelPreParser::IsEnabled(int source_length) {
+  // One background thread skims the source, the others preparse.
+  return FLAG_parallel_preparse &&
+         source_length >= FLAG_parallel_preparse_min_source_size &&
+         V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads() > 1;
+}
+
+void ParallelPreParser::Start() {
+  DCHECK_EQ(0, num_tasks_);
+  int available_threads = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  int num_preparse_tasks =
+      Max(1, Min(FLAG_parallel_preparse_tasks,
+                 Min(kMaxNumberOfTasks, available_threads) - 1));
+  // The skimmer is posted first, as the preparse tasks wait for its jobs.
+  CancelableTask* task = new SkimTask(isolate_, this);
+  task_ids_[num_tasks_++] = task->id();
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      task, v8::Platform::kShortRunningTask);
+  for (int i = 0; i < num_preparse_tasks; i++) {
+    task = new PreParseTask(isolate_, this);
+    task_ids_[num_tasks_++] = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+}
+
+bool ParallelPreParser::Consume(int position, LanguageMode language_mode,
+                                FunctionKind kind, bool has_simple_parameters,
+                                SingletonLogger* logger, int* use_counts) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  DCHECK_LE(parser_position_, position);
+  parser_position_ = position;
+  while (next_consumed_job_ < jobs_.length() &&
+         jobs_[next_consumed_job_]->position < position) {
+    next_consumed_job_++;
+  }
+  // The skimmer may not have got this far yet, or it did not expect the
+  // parser to preparse this function.
+  if (next_consumed_job_ == jobs_.length()) return false;
+  Job* job = jobs_[next_consumed_job_];
+  if (job->position != position) return false;
+  if (job->language_mode != language_mode || kind != kNormalFunction ||
+      !has_simple_parameters) {
+    if (job->state == kAvailable) job->state = kAbandoned;
+    return false;
+  }
+  while (job->state == kProcessing) jobs_changed_.Wait(&mutex_);
+  if (job->state != kFinished) {
+    // Preparsing failed, the trial preparse would have reset, or the job was
+    // not picked up yet. In all cases the parser preparses the function
+    // itself, and resets to its own bookmark if it has one.
+    job->state = kAbandoned;
+    return false;
+  }
+  job->state = kAbandoned;
+  logger->LogFunction(job->position, job->end_position, job->literal_count,
+                      job->property_count, job->result_language_mode,
+                      job->uses_super_property, job->calls_eval);
+  if (job->use_counts != NULL) {
+    for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+         ++feature) {
+      use_counts[feature] += job->use_counts[feature];
+    }
+  }
+  consumed_count_++;
+  return true;
+}
+
+void ParallelPreParser::AddJob(int position, LanguageMode language_mode) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  jobs_.Add(new Job(position, language_mode));
+  jobs_changed_.NotifyAll();
+}
+
+void ParallelPreParser::FinishSkimming() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  skimming_done_ = true;
+  jobs_changed_.NotifyAll();
+}
+
+bool ParallelPreParser::aborted() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  return aborted_;
+}
+
+ParallelPreParser::Job* ParallelPreParser::NextJob() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  while (!aborted_) {
+    if (next_job_ < jobs_.length()) {
+      Job* job = jobs_[next_job_++];
+      // Functions the parser has passed are not needed anymore.
+      if (job->state != kAvailable || job->position < parser_position_) {
+        continue;
+      }
+      job->state = kProcessing;
+      return job;
+    }
+    if (skimming_done_) break;
+    jobs_changed_.Wait(&mutex_);
+  }
+  return NULL;
+}
+
+void ParallelPreParser::PreParseJob(Job* job, UnicodeCache* unicode_cache) {
+  uintptr_t stack_limit =
+      reinterpret_cast<uintptr_t>(&stack_limit) - FLAG_stack_size * KB;
+
+  Zone zone(allocator_);
+  AstValueFactory ast_value_factory(&zone, hash_seed_);
+  base::SmartPointer<Utf16CharacterStream> stream(NewStream(job->position));
+  Scanner scanner(unicode_cache);
+  scanner.Initialize(stream.get());
+  SingletonLogger logger;
+  int use_counts[v8::Isolate::kUseCounterFeatureCount];
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    use_counts[feature] = 0;
+  }
+
+  // Run the same trial preparse as the parser does, with a bookmark at the
+  // start of the body.
+  bool success = false;
+  bool would_reset = false;
+  if (scanner.Next() == Token::LBRACE) {
+    Scanner::BookmarkScope bookmark(&scanner);
+    Scanner::BookmarkScope* maybe_bookmark =
+        bookmark.Set() ? &bookmark : nullptr;
+    PreParser preparser(&zone, &scanner, &ast_value_factory, NULL,
+                        stack_limit);
+    SetFlags(&preparser);
+    PreParser::PreParseResult result = preparser.PreParseLazyFunction(
+        job->language_mode, kNormalFunction, true, false, &logger,
+        maybe_bookmark, use_counts);
+    would_reset = bookmark.HasBeenReset();
+    success = !would_reset && result == PreParser::kPreParseSuccess &&
+              !logger.has_error();
+  }
+
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  if (would_reset) {
+    job->state = kWouldReset;
+  } else if (success) {
+    job->end_position = logger.end();
+    job->literal_count = logger.literals();
+    job->property_count = logger.properties();
+    job->result_language_mode = logger.language_mode();
+    job->uses_super_property = logger.uses_super_property();
+    job->calls_eval = logger.calls_eval();
+    for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+         ++feature) {
+      if (use_counts[feature] == 0) continue;
+      if (job->use_counts == NULL) {
+        job->use_counts = new int[v8::Isolate::kUseCounterFeatureCount]();
+      }
+      job->use_counts[feature] = use_counts[feature];
+    }
+    job->state = kFinished;
+  } else {
+    job->state = kFailed;
+  }
+  jobs_changed_.NotifyAll();
+}
+
+Utf16CharacterStream* ParallelPreParser::NewStream(int start_position) {
+  if (one_byte_source_ != NULL) {
+    return new OneByteSourceStream(one_byte_source_, start_position,
+                                   source_length_);
+  }
+  return new TwoByteSourceStream(two_byte_source_, start_position,
+                                 source_length_);
+}
+
+void ParallelPreParser::SetFlags(PreParser* preparser) {
+  preparser->set_allow_lazy(true);
+#define SET_ALLOW(name) preparser->set_allow_##name(allow_##name());
+  SET_ALLOW(natives);
+  SET_ALLOW(harmony_do_expressions);
+  SET_ALLOW(harmony_for_in);
+  SET_ALLOW(harmony_function_name);
+  SET_ALLOW(harmony_function_sent);
+  SET_ALLOW(harmony_exponentiation_operator);
+  SET_ALLOW(harmony_restrictive_declarations);
+#undef SET_ALLOW
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,191 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PARALLEL_PREPARSER_H_
+#define V8_PARSING_PARALLEL_PREPARSER_H_
+
+#include "include/v8.h"
+#include "src/allocation.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/globals.h"
+#include "src/handles.h"
+#include "src/list.h"
+
+namespace v8 {
+
+namespace base {
+class AccountingAllocator;
+}  // namespace base
+
+namespace internal {
+
+class PreParser;
+class SingletonLogger;
+class UnicodeCache;
+class Utf16CharacterStream;
+
+// Preparses the lazily parsed functions of a large script on background
+// threads while the parser works through the script on the main thread.
+//
+// A skimmer task tokenizes the script ahead of the parser and collects the
+// bodies of the functions the parser is going to skip, i.e. those of function
+// literals in top-level code and in the bodies of parenthesized functions.
+// Preparse tasks pick the bodies up in source order and preparse them. Once
+// the parser gets to one of these functions, it takes the preparse data from
+// Consume() and seeks past the body instead of preparsing it again.
+//
+// The skimmer only guesses the context of each function. Preparse data is
+// used only if the guess matches the context the parser found; otherwise, and
+// for functions which have not been skimmed or preparsed yet, the parser
+// preparses the function itself.
+class ParallelPreParser {
+ public:
+  // The source is flattened and copied unless it is external, so that it can
+  // be read on background threads.
+  ParallelPreParser(Isolate* isolate, Handle<String> source,
+                    LanguageMode language_mode);
+  // Cancels the background tasks and waits for the running ones to finish.
+  ~ParallelPreParser();
+
+  // Returns true if the functions of a script of |source_length| characters
+  // should be preparsed in parallel.
+  static bool IsEnabled(int source_length);
+
+#define ALLOW_ACCESSORS(name)                           \
+  bool allow_##name() const { return allow_##name##_; } \
+  void set_allow_##name(bool allow) { allow_##name##_ = allow; }
+
+  ALLOW_ACCESSORS(natives);
+  ALLOW_ACCESSORS(harmony_do_expressions);
+  ALLOW_ACCESSORS(harmony_for_in);
+  ALLOW_ACCESSORS(harmony_function_name);
+  ALLOW_ACCESSORS(harmony_function_sent);
+  ALLOW_ACCESSORS(harmony_exponentiation_operator);
+  ALLOW_ACCESSORS(harmony_restrictive_declarations);
+
+#undef ALLOW_ACCESSORS
+
+  // Posts the skimmer and preparse tasks. The syntax flags have to be set
+  // before.
+  void Start();
+
+  // Looks up the preparse data of the function whose body starts with the
+  // '{' at |position|, waiting for it if the function is being preparsed.
+  // If the data was produced for the given context, it is logged to |logger|,
+  // the use counts are added to |use_counts| and true is returned. Functions
+  // have to be consumed in source order. Functions whose trial preparse would
+  // have reset to the bookmark are left to the parser, which decides whether
+  // to parse them eagerly.
+  bool Consume(int position, LanguageMode language_mode, FunctionKind kind,
+               bool has_simple_parameters, SingletonLogger* logger,
+               int* use_counts);
+
+  int consumed_count() const { return consumed_count_; }
+
+ private:
+  class PreParseTask;
+  class SkimTask;
+  class Skimmer;
+
+  enum JobState {
+    kAvailable,
+    kProcessing,
+    kFinished,
+    kFailed,
+    // The function is long and trivial, see PreParser::ParseStatementList.
+    kWouldReset,
+    kAbandoned
+  };
+
+  // A function body found by the skimmer, and the result of preparsing it.
+  struct Job : public Malloced {
+    Job(int position, LanguageMode language_mode)
+        : position(position),
+          language_mode(language_mode),
+          state(kAvailable),
+          end_position(-1),
+          literal_count(0),
+          property_count(0),
+          result_language_mode(language_mode),
+          uses_super_property(false),
+          calls_eval(false),
+          use_counts(NULL) {}
+    ~Job() { delete[] use_counts; }
+
+    int position;
+    LanguageMode language_mode;
+    JobState state;
+    int end_position;
+    int literal_count;
+    int property_count;
+    LanguageMode result_language_mode;
+    bool uses_super_property;
+    bool calls_eval;
+    // Only allocated if the preparser counted any use.
+    int* use_counts;
+  };
+
+  static const int kMaxNumberOfTasks = 8;
+
+  // Called on the skimmer task.
+  void AddJob(int position, LanguageMode language_mode);
+  void FinishSkimming();
+  bool aborted();
+
+  // Called on the preparse tasks. Returns NULL once there are no more jobs.
+  Job* NextJob();
+  void PreParseJob(Job* job, UnicodeCache* unicode_cache);
+
+  // Returns a stream over the source starting at |start_position|.
+  Utf16CharacterStream* NewStream(int start_position);
+  void SetFlags(PreParser* preparser);
+
+  Isolate* isolate_;
+  base::AccountingAllocator* allocator_;
+  uint32_t hash_seed_;
+  LanguageMode language_mode_;
+
+  // The source as one-byte or two-byte characters, and the copy owning them
+  // unless the source is external.
+  const uint8_t* one_byte_source_;
+  const uint16_t* two_byte_source_;
+  int source_length_;
+  uint8_t* one_byte_copy_;
+  uint16_t* two_byte_copy_;
+
+  bool allow_natives_;
+  bool allow_harmony_do_expressions_;
+  bool allow_harmony_for_in_;
+  bool allow_harmony_function_name_;
+  bool allow_harmony_function_sent_;
+  bool allow_harmony_exponentiation_operator_;
+  bool allow_harmony_restrictive_declarations_;
+
+  // The jobs in source order. Guarded by mutex_, like the state below.
+  base::Mutex mutex_;
+  base::ConditionVariable jobs_changed_;
+  List<Job*> jobs_;
+  // The first job not yet taken by a preparse task.
+  int next_job_;
+  // The first job the parser has not yet passed.
+  int next_consumed_job_;
+  // The position of the last function the parser looked up.
+  int parser_position_;
+  bool skimming_done_;
+  bool aborted_;
+
+  int consumed_count_;
+  int num_tasks_;
+  uint32_t task_ids_[kMaxNumberOfTasks];
+  base::Semaphore pending_tasks_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelPreParser);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PARALLEL_PREPARSER_H_
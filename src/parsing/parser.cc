@@ -17,6 +17,7 @@
 #include "src/codegen.h"
 #include "src/compiler.h"
 #include "src/messages.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parameter-initializer-rewriter.h"
 #include "src/parsing/parser-base.h"
 #include "src/parsing/rewriter.h"
@@ -29,7 +30,11 @@ namespace v8 {
 namespace internal {
 
 ScriptData::ScriptData(const byte* data, int length)
-    : owns_data_(false), rejected_(false), data_(data), length_(length) {
+    : owns_data_(false),
+      rejected_(false),
+      checksum_verified_(false),
+      data_(data),
+      length_(length) {
   if (!IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment)) {
     byte* copy = NewArray<byte>(length);
     DCHECK(IsAligned(reinterpret_cast<intptr_t>(copy), kPointerAlignment));
@@ -779,6 +784,7 @@ Parser::Parser(ParseInfo* info)
       target_stack_(NULL),
       compile_options_(info->compile_options()),
       cached_parse_data_(NULL),
+      parallel_preparser_(NULL),
       total_preparse_skipped_(0),
       pre_parse_timer_(NULL),
       parsing_on_main_thread_(true) {
@@ -841,6 +847,11 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
   source = String::Flatten(source);
   FunctionLiteral* result;
 
+  // Stops the background tasks on return.
+  base::SmartPointer<ParallelPreParser> parallel_preparser(
+      NewParallelPreParser(isolate, info, source));
+  parallel_preparser_ = parallel_preparser.get();
+
   if (source->IsExternalTwoByteString()) {
     // Notice that the stream is destroyed at the end of the branch block.
     // The last line of the blocks can't be moved outside, even though they're
@@ -849,6 +860,11 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
         Handle<ExternalTwoByteString>::cast(source), 0, source->length());
     scanner_.Initialize(&stream);
     result = DoParseProgram(info);
+  } else if (source->IsExternalOneByteString()) {
+    ExternalOneByteStringUtf16CharacterStream stream(
+        Handle<ExternalOneByteString>::cast(source), 0, source->length());
+    scanner_.Initialize(&stream);
+    result = DoParseProgram(info);
   } else {
     GenericStringUtf16CharacterStream stream(source, 0, source->length());
     scanner_.Initialize(&stream);
@@ -859,6 +875,12 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
   }
   HandleSourceURLComments(isolate, info->script());
 
+  if (FLAG_trace_parse && parallel_preparser_ != NULL) {
+    PrintF("[parallel preparse: %d functions preparsed in the background]\n",
+           parallel_preparser_->consumed_count());
+  }
+  parallel_preparser_ = NULL;
+
   if (FLAG_trace_parse && result != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
     if (info->is_eval()) {
@@ -1003,6 +1025,12 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
         shared_info->start_position(),
         shared_info->end_position());
     result = ParseLazy(isolate, info, &stream);
+  } else if (source->IsExternalOneByteString()) {
+    ExternalOneByteStringUtf16CharacterStream stream(
+        Handle<ExternalOneByteString>::cast(source),
+        shared_info->start_position(),
+        shared_info->end_position());
+    result = ParseLazy(isolate, info, &stream);
   } else {
     GenericStringUtf16CharacterStream stream(source,
                                              shared_info->start_position(),
@@ -4241,25 +4269,34 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
     cached_parse_data_->Reject();
   }
   // With no cached data, we partially parse the function, without building an
-  // AST. This gathers the data needed to build a lazy function.
+  // AST. This gathers the data needed to build a lazy function. The function
+  // may have been preparsed on a background thread already.
   SingletonLogger logger;
-  PreParser::PreParseResult result =
-      ParseLazyFunctionBodyWithPreParser(&logger, bookmark);
-  if (bookmark && bookmark->HasBeenReset()) {
-    return;  // Return immediately if pre-parser devided to abort parsing.
-  }
-  if (result == PreParser::kPreParseStackOverflow) {
-    // Propagate stack overflow.
-    set_stack_overflow();
-    *ok = false;
-    return;
-  }
-  if (logger.has_error()) {
-    ParserTraits::ReportMessageAt(
-        Scanner::Location(logger.start(), logger.end()), logger.message(),
-        logger.argument_opt(), logger.error_type());
-    *ok = false;
-    return;
+  if (parallel_preparser_ != NULL &&
+      parallel_preparser_->Consume(function_block_pos, language_mode(),
+                                   function_state_->kind(),
+                                   scope_->has_simple_parameters(), &logger,
+                                   use_counts_)) {
+    scanner()->SeekForward(logger.end() - 1);
+  } else {
+    PreParser::PreParseResult result =
+        ParseLazyFunctionBodyWithPreParser(&logger, bookmark);
+    if (bookmark && bookmark->HasBeenReset()) {
+      return;  // Return immediately if pre-parser devided to abort parsing.
+    }
+    if (result == PreParser::kPreParseStackOverflow) {
+      // Propagate stack overflow.
+      set_stack_overflow();
+      *ok = false;
+      return;
+    }
+    if (logger.has_error()) {
+      ParserTraits::ReportMessageAt(
+          Scanner::Location(logger.start(), logger.end()), logger.message(),
+          logger.argument_opt(), logger.error_type());
+      *ok = false;
+      return;
+    }
   }
   scope_->set_end_position(logger.end());
   Expect(Token::RBRACE, ok);
@@ -4616,6 +4653,31 @@ PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
   return result;
 }
 
+ParallelPreParser* Parser::NewParallelPreParser(Isolate* isolate,
+                                                ParseInfo* info,
+                                                Handle<String> source) {
+  // Functions are only preparsed in parallel when the parser preparses them
+  // itself, i.e. not for modules and not with cached data or extensions.
+  if (!allow_lazy() || !info->is_global() || info->is_module() ||
+      consume_cached_parse_data() || extension_ != NULL ||
+      !ParallelPreParser::IsEnabled(source->length())) {
+    return NULL;
+  }
+  ParallelPreParser* parallel_preparser =
+      new ParallelPreParser(isolate, source, info->language_mode());
+#define SET_ALLOW(name) parallel_preparser->set_allow_##name(allow_##name());
+  SET_ALLOW(natives);
+  SET_ALLOW(harmony_do_expressions);
+  SET_ALLOW(harmony_for_in);
+  SET_ALLOW(harmony_function_name);
+  SET_ALLOW(harmony_function_sent);
+  SET_ALLOW(harmony_exponentiation_operator);
+  SET_ALLOW(harmony_restrictive_declarations);
+#undef SET_ALLOW
+  parallel_preparser->Start();
+  return parallel_preparser;
+}
+
 ClassLiteral* Parser::ParseClassLiteral(ExpressionClassifier* classifier,
                                         const AstRawString* name,
                                         Scanner::Location class_name_location,
@@ -4958,6 +5020,14 @@ void Parser::Internalize(Isolate* isolate, Handle<Script> script, bool error) {
   }
   isolate->counters()->total_preparse_skipped()->Increment(
       total_preparse_skipped_);
+  if (background_analysis_time_ != base::TimeDelta()) {
+    isolate->counters()->streaming_analysis()->AddSample(
+        static_cast<int>(background_analysis_time_.InMicroseconds()));
+    if (FLAG_trace_parse) {
+      PrintF("[streaming analysis: %.3f ms moved off the main thread]\n",
+             background_analysis_time_.InMillisecondsF());
+    }
+  }
 }
 
 
@@ -5044,6 +5114,26 @@ void Parser::ParseOnBackground(ParseInfo* info) {
 }
 
 
+void Parser::AnalyzeOnBackground(ParseInfo* info) {
+  DCHECK(!parsing_on_main_thread_);
+  DCHECK(info->literal() != NULL);
+  DCHECK(info->scope() == NULL);
+
+  base::ElapsedTimer timer;
+  timer.Start();
+  if (!Rewriter::Rewrite(this, info)) {
+    set_stack_overflow();
+    info->set_literal(NULL);
+    return;
+  }
+
+  // Variable resolution doesn't report errors in scripts, so the analysis
+  // succeeds without touching the heap.
+  CHECK(Scope::Analyze(info));
+  background_analysis_time_ = timer.Elapsed();
+}
+
+
 ParserTraits::TemplateLiteralState Parser::OpenTemplateLiteral(int pos) {
   return new (zone()) ParserTraits::TemplateLiteral(zone(), pos);
 }
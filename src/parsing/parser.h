@@ -149,10 +149,6 @@ class ParseInfo {
     context_ = Handle<Context>(*context_);
   }
 
-#ifdef DEBUG
-  bool script_is_native() { return script_->type() == Script::TYPE_NATIVE; }
-#endif  // DEBUG
-
  private:
   // Various configuration flags for parsing.
   enum Flag {
@@ -283,6 +279,7 @@ class ParseData {
 // ----------------------------------------------------------------------------
 // JAVASCRIPT PARSING
 
+class ParallelPreParser;
 class Parser;
 class SingletonLogger;
 
@@ -690,6 +687,12 @@ class Parser : public ParserBase<ParserTraits> {
   static bool ParseStatic(ParseInfo* info);
   bool Parse(ParseInfo* info);
   void ParseOnBackground(ParseInfo* info);
+  // Rewrites the program parsed by ParseOnBackground() and analyzes its
+  // scopes, which only needs the zone. This is only the heap-independent part
+  // of Compiler::Analyze; numbering the AST and generating code is still left
+  // to the main thread. Internalize() reports a stack overflow like a parse
+  // error, and the time spent here in the streaming_analysis histogram.
+  void AnalyzeOnBackground(ParseInfo* info);
 
   // Handle errors detected during parsing, move statistics to Isolate,
   // internalize strings (move them to the heap).
@@ -1020,6 +1023,11 @@ class Parser : public ParserBase<ParserTraits> {
   PreParser::PreParseResult ParseLazyFunctionBodyWithPreParser(
       SingletonLogger* logger, Scanner::BookmarkScope* bookmark = nullptr);
 
+  // Returns a started ParallelPreParser for the given script, or NULL if its
+  // functions are not preparsed in parallel.
+  ParallelPreParser* NewParallelPreParser(Isolate* isolate, ParseInfo* info,
+                                          Handle<String> source);
+
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters, bool* ok);
 
@@ -1072,6 +1080,7 @@ class Parser : public ParserBase<ParserTraits> {
   Target* target_stack_;  // for break, continue statements
   ScriptCompiler::CompileOptions compile_options_;
   ParseData* cached_parse_data_;
+  ParallelPreParser* parallel_preparser_;
 
   PendingCompilationErrorHandler pending_error_handler_;
 
@@ -1080,6 +1089,8 @@ class Parser : public ParserBase<ParserTraits> {
   int use_counts_[v8::Isolate::kUseCounterFeatureCount];
   int total_preparse_skipped_;
   HistogramTimer* pre_parse_timer_;
+  // Time spent in a successful AnalyzeOnBackground(), or zero.
+  base::TimeDelta background_analysis_time_;
 
   bool parsing_on_main_thread_;
 };
@@ -27,6 +27,11 @@ class ScriptData {
 
   void Reject() { rejected_ = true; }
 
+  // Set once the checksum of code cache data has been verified, e.g. on a
+  // background thread before the data is consumed.
+  bool checksum_verified() const { return checksum_verified_; }
+  void MarkChecksumVerified() { checksum_verified_ = true; }
+
   void AcquireDataOwnership() {
     DCHECK(!owns_data_);
     owns_data_ = true;
@@ -40,6 +45,7 @@ class ScriptData {
  private:
   bool owns_data_ : 1;
   bool rejected_ : 1;
+  bool checksum_verified_ : 1;
   const byte* data_;
   int length_;
 
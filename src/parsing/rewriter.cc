@@ -13,7 +13,7 @@ namespace internal {
 
 class Processor: public AstVisitor {
  public:
-  Processor(Isolate* isolate, Scope* scope, Variable* result,
+  Processor(uintptr_t stack_limit, Scope* scope, Variable* result,
             AstValueFactory* ast_value_factory)
       : result_(result),
         result_assigned_(false),
@@ -22,7 +22,7 @@ class Processor: public AstVisitor {
         zone_(ast_value_factory->zone()),
         scope_(scope),
         factory_(ast_value_factory) {
-    InitializeAstVisitor(isolate);
+    InitializeAstVisitor(stack_limit);
   }
 
   Processor(Parser* parser, Scope* scope, Variable* result,
@@ -334,9 +334,11 @@ DECLARATION_NODE_LIST(DEF_VISIT)
 #undef DEF_VISIT
 
 
+namespace {
+
 // Assumes code has been parsed.  Mutates the AST, so the AST should not
 // continue to be used in the case of failure.
-bool Rewriter::Rewrite(ParseInfo* info) {
+bool RewriteProgram(ParseInfo* info, uintptr_t stack_limit) {
   FunctionLiteral* function = info->literal();
   DCHECK(function != NULL);
   Scope* scope = function->scope();
@@ -347,10 +349,7 @@ bool Rewriter::Rewrite(ParseInfo* info) {
   if (!body->is_empty()) {
     Variable* result =
         scope->NewTemporary(info->ast_value_factory()->dot_result_string());
-    // The name string must be internalized at this point.
-    DCHECK(!result->name().is_null());
-    Processor processor(info->isolate(), scope, result,
-                        info->ast_value_factory());
+    Processor processor(stack_limit, scope, result, info->ast_value_factory());
     processor.Process(body);
     if (processor.HasStackOverflow()) return false;
 
@@ -367,6 +366,20 @@ bool Rewriter::Rewrite(ParseInfo* info) {
   return true;
 }
 
+}  // namespace
+
+
+bool Rewriter::Rewrite(ParseInfo* info) {
+  // The name string must be internalized at this point.
+  DCHECK(!info->ast_value_factory()->dot_result_string()->string().is_null());
+  return RewriteProgram(info, info->isolate()->stack_guard()->real_climit());
+}
+
+
+bool Rewriter::Rewrite(Parser* parser, ParseInfo* info) {
+  return RewriteProgram(info, parser->stack_limit());
+}
+
 
 bool Rewriter::Rewrite(Parser* parser, DoExpression* expr,
                        AstValueFactory* factory) {
@@ -23,6 +23,11 @@ class Rewriter {
   // AST, so the AST should not continue to be used in the case of failure.
   static bool Rewrite(ParseInfo* info);
 
+  // Like the above, but for a program that |parser| has just parsed on a
+  // background thread. Doesn't access the heap, so the names of the
+  // introduced variables are only internalized with the rest of the AST.
+  static bool Rewrite(Parser* parser, ParseInfo* info);
+
   // Rewrite a list of statements, using the same rules as a top-level program,
   // to  ensure identical behaviour of completion result.
   static bool Rewrite(Parser* parser, DoExpression* expr,
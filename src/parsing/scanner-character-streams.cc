@@ -8,7 +8,7 @@
 #include "src/globals.h"
 #include "src/handles.h"
 #include "src/list-inl.h"  // TODO(mstarzinger): Temporary cycle breaker!
-#include "src/objects.h"
+#include "src/objects-inl.h"
 #include "src/unicode-inl.h"
 
 namespace v8 {
@@ -50,8 +50,11 @@ size_t CopyCharsHelper(uint16_t* dest, size_t length, const uint8_t* src,
 
 BufferedUtf16CharacterStream::BufferedUtf16CharacterStream()
     : Utf16CharacterStream(),
-      pushback_limit_(NULL) {
+      pushback_limit_(NULL),
+      one_byte_block_(false) {
   // Initialize buffer as being empty. First read will fill the buffer.
+  one_byte_cursor_ = one_byte_buffer_;
+  one_byte_end_ = one_byte_buffer_;
   buffer_cursor_ = buffer_;
   buffer_end_ = buffer_;
 }
@@ -64,6 +67,17 @@ void BufferedUtf16CharacterStream::PushBack(uc32 character) {
     pos_--;
     return;
   }
+  if (one_byte_cursor_ > one_byte_buffer_ &&
+      character <= String::kMaxOneByteCharCode) {
+    // one_byte_buffer_ is writable, one_byte_cursor_ is const pointer.
+    one_byte_buffer_[--one_byte_cursor_ - one_byte_buffer_] =
+        static_cast<uint8_t>(character);
+    pos_--;
+    return;
+  }
+  // Pushing back beyond the start of a one-byte block needs the pushback
+  // mode of the UTF-16 buffer.
+  if (one_byte_end_ > one_byte_buffer_) WidenOneByteBlock();
   if (pushback_limit_ == NULL && buffer_cursor_ > buffer_) {
     // buffer_ is writable, buffer_cursor_ is const pointer.
     buffer_[--buffer_cursor_ - buffer_] = static_cast<uc16>(character);
@@ -100,7 +114,22 @@ void BufferedUtf16CharacterStream::SlowPushBack(uc16 character) {
 }
 
 
+void BufferedUtf16CharacterStream::WidenOneByteBlock() {
+  DCHECK(pushback_limit_ == NULL);
+  size_t length = one_byte_end_ - one_byte_cursor_;
+  DCHECK(length <= kOneByteBufferSize);
+  uc16* start = buffer_ + kBufferSize - length;
+  CopyChars(start, one_byte_cursor_, length);
+  buffer_cursor_ = start;
+  buffer_end_ = buffer_ + kBufferSize;
+  one_byte_cursor_ = one_byte_buffer_;
+  one_byte_end_ = one_byte_buffer_;
+}
+
+
 bool BufferedUtf16CharacterStream::ReadBlock() {
+  one_byte_cursor_ = one_byte_buffer_;
+  one_byte_end_ = one_byte_buffer_;
   buffer_cursor_ = buffer_;
   if (pushback_limit_ != NULL) {
     // Leave pushback mode.
@@ -111,8 +140,14 @@ bool BufferedUtf16CharacterStream::ReadBlock() {
     if (buffer_cursor_ < buffer_end_) return true;
     // Otherwise read a new block.
   }
+  one_byte_block_ = false;
   size_t length = FillBuffer(pos_);
-  buffer_end_ = buffer_ + length;
+  if (one_byte_block_) {
+    one_byte_end_ = one_byte_buffer_ + length;
+    buffer_end_ = buffer_;
+  } else {
+    buffer_end_ = buffer_ + length;
+  }
   return length > 0;
 }
 
@@ -131,7 +166,10 @@ size_t BufferedUtf16CharacterStream::SlowSeekForward(size_t delta) {
 
 GenericStringUtf16CharacterStream::GenericStringUtf16CharacterStream(
     Handle<String> data, size_t start_position, size_t end_position)
-    : string_(data), length_(end_position), bookmark_(kNoBookmark) {
+    : string_(data),
+      length_(end_position),
+      bookmark_(kNoBookmark),
+      is_one_byte_(data->IsOneByteRepresentation()) {
   DCHECK(end_position >= start_position);
   pos_ = start_position;
 }
@@ -149,8 +187,8 @@ bool GenericStringUtf16CharacterStream::SetBookmark() {
 void GenericStringUtf16CharacterStream::ResetToBookmark() {
   DCHECK(bookmark_ != kNoBookmark);
   pos_ = bookmark_;
-  buffer_cursor_ = buffer_;
-  buffer_end_ = buffer_ + FillBuffer(pos_);
+  pushback_limit_ = NULL;
+  ReadBlock();
 }
 
 
@@ -164,12 +202,19 @@ size_t GenericStringUtf16CharacterStream::BufferSeekForward(size_t delta) {
 
 size_t GenericStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
   if (from_pos >= length_) return 0;
-  size_t length = kBufferSize;
+  size_t length = is_one_byte_ ? kOneByteBufferSize : kBufferSize;
   if (from_pos + length > length_) {
     length = length_ - from_pos;
   }
-  String::WriteToFlat<uc16>(*string_, buffer_, static_cast<int>(from_pos),
-                            static_cast<int>(from_pos + length));
+  if (is_one_byte_) {
+    String::WriteToFlat<uint8_t>(*string_, one_byte_buffer_,
+                                 static_cast<int>(from_pos),
+                                 static_cast<int>(from_pos + length));
+    one_byte_block_ = true;
+  } else {
+    String::WriteToFlat<uc16>(*string_, buffer_, static_cast<int>(from_pos),
+                              static_cast<int>(from_pos + length));
+  }
   return length;
 }
 
@@ -219,6 +264,22 @@ size_t Utf8ToUtf16CharacterStream::CopyChars(uint16_t* dest, size_t length,
 }
 
 
+size_t Utf8ToUtf16CharacterStream::CopyAsciiChars(uint8_t* dest, size_t length,
+                                                  const byte* src,
+                                                  size_t* src_pos,
+                                                  size_t src_length) {
+  size_t to_fill = Min(length, src_length - *src_pos);
+  size_t i = 0;
+  for (; i < to_fill; i++) {
+    byte c = src[*src_pos + i];
+    if (c > unibrow::Utf8::kMaxOneByteChar) break;
+    dest[i] = c;
+  }
+  *src_pos += i;
+  return i;
+}
+
+
 size_t Utf8ToUtf16CharacterStream::BufferSeekForward(size_t delta) {
   size_t old_pos = pos_;
   size_t target_pos = pos_ + delta;
@@ -236,8 +297,14 @@ size_t Utf8ToUtf16CharacterStream::FillBuffer(size_t char_position) {
     // while spooling to it).
     return 0u;
   }
-  size_t i = CopyChars(buffer_, kBufferSize, raw_data_, &raw_data_pos_,
-                       raw_data_length_);
+  size_t i = CopyAsciiChars(one_byte_buffer_, kOneByteBufferSize, raw_data_,
+                            &raw_data_pos_, raw_data_length_);
+  if (i > 0) {
+    one_byte_block_ = true;
+  } else {
+    i = CopyChars(buffer_, kBufferSize, raw_data_, &raw_data_pos_,
+                  raw_data_length_);
+  }
   raw_character_position_ = char_position + i;
   return i;
 }
@@ -371,6 +438,12 @@ size_t ExternalStreamingStream::FillBuffer(size_t position) {
       }
     }
 
+    // Keep blocks of one-byte characters as they are.
+    if (data_in_buffer == 0) {
+      size_t one_byte_length = FillOneByteBuffer();
+      if (one_byte_length > 0) return one_byte_length;
+    }
+
     // Fill the buffer from current_data_.
     size_t new_offset = 0;
     size_t new_chars_in_buffer =
@@ -390,6 +463,27 @@ size_t ExternalStreamingStream::FillBuffer(size_t position) {
 }
 
 
+size_t ExternalStreamingStream::FillOneByteBuffer() {
+  size_t length = 0;
+  if (encoding_ == ScriptCompiler::StreamedSource::ONE_BYTE) {
+    length =
+        Min(kOneByteBufferSize, current_data_length_ - current_data_offset_);
+    CopyBytes(one_byte_buffer_, current_data_ + current_data_offset_, length);
+    current_data_offset_ += length;
+  } else if (encoding_ == ScriptCompiler::StreamedSource::UTF8) {
+    length = Utf8ToUtf16CharacterStream::CopyAsciiChars(
+        one_byte_buffer_, kOneByteBufferSize, current_data_,
+        &current_data_offset_, current_data_length_);
+  }
+  if (length == 0) return 0;
+  one_byte_block_ = true;
+  if (current_data_offset_ == current_data_length_) {
+    FlushCurrent();
+  }
+  return length;
+}
+
+
 bool ExternalStreamingStream::SetBookmark() {
   // Bookmarking for this stream is a bit more complex than expected, since
   // the stream state is distributed over several places:
@@ -406,6 +500,7 @@ bool ExternalStreamingStream::SetBookmark() {
   // What gets saved where:
   // - pos_  =>  bookmark_
   // - buffer_[buffer_cursor_ .. buffer_end_]  =>  bookmark_buffer_
+  //   (or the one-byte equivalent, widened to UTF-16)
   // - current_data_[.._offset_ .. .._length_]  =>  bookmark_data_
   // - utf8_split_char_buffer_* => bookmark_utf8_split...
   //
@@ -420,10 +515,14 @@ bool ExternalStreamingStream::SetBookmark() {
 
   bookmark_ = pos_;
 
+  size_t one_byte_length = one_byte_end_ - one_byte_cursor_;
   size_t buffer_length = buffer_end_ - buffer_cursor_;
   bookmark_buffer_.Dispose();
-  bookmark_buffer_ = Vector<uint16_t>::New(static_cast<int>(buffer_length));
-  CopyCharsUnsigned(bookmark_buffer_.start(), buffer_cursor_, buffer_length);
+  bookmark_buffer_ =
+      Vector<uint16_t>::New(static_cast<int>(one_byte_length + buffer_length));
+  CopyChars(bookmark_buffer_.start(), one_byte_cursor_, one_byte_length);
+  CopyChars(bookmark_buffer_.start() + one_byte_length, buffer_cursor_,
+            buffer_length);
 
   size_t data_length = current_data_length_ - current_data_offset_;
   size_t bookmark_data_length = static_cast<size_t>(bookmark_data_.length());
@@ -471,6 +570,9 @@ void ExternalStreamingStream::ResetToBookmark() {
   // bookmark_buffer_ needs to be copied to buffer_.
   CopyCharsUnsigned(buffer_, bookmark_buffer_.begin(),
                     bookmark_buffer_.length());
+  pushback_limit_ = NULL;
+  one_byte_cursor_ = one_byte_buffer_;
+  one_byte_end_ = one_byte_buffer_;
   buffer_cursor_ = buffer_;
   buffer_end_ = buffer_ + bookmark_buffer_.length();
 
@@ -585,5 +687,39 @@ void ExternalTwoByteStringUtf16CharacterStream::ResetToBookmark() {
   pos_ = bookmark_;
   buffer_cursor_ = raw_data_ + bookmark_;
 }
+
+
+// ----------------------------------------------------------------------------
+// ExternalOneByteStringUtf16CharacterStream
+
+ExternalOneByteStringUtf16CharacterStream::
+    ~ExternalOneByteStringUtf16CharacterStream() {}
+
+
+ExternalOneByteStringUtf16CharacterStream::
+    ExternalOneByteStringUtf16CharacterStream(
+        Handle<ExternalOneByteString> data, int start_position,
+        int end_position)
+    : Utf16CharacterStream(),
+      source_(data),
+      raw_data_(data->GetChars()),
+      bookmark_(kNoBookmark) {
+  one_byte_cursor_ = raw_data_ + start_position;
+  one_byte_end_ = raw_data_ + end_position;
+  pos_ = start_position;
+}
+
+
+bool ExternalOneByteStringUtf16CharacterStream::SetBookmark() {
+  bookmark_ = pos_;
+  return true;
+}
+
+
+void ExternalOneByteStringUtf16CharacterStream::ResetToBookmark() {
+  DCHECK(bookmark_ != kNoBookmark);
+  pos_ = bookmark_;
+  one_byte_cursor_ = raw_data_ + bookmark_;
+}
 }  // namespace internal
 }  // namespace v8
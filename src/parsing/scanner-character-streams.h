@@ -13,11 +13,13 @@ namespace v8 {
 namespace internal {
 
 // Forward declarations.
+class ExternalOneByteString;
 class ExternalTwoByteString;
 
 // A buffered character stream based on a random access character
 // source (ReadBlock can be called with pos_ pointing to any position,
-// even positions before the current).
+// even positions before the current). Blocks of one-byte characters can be
+// buffered without widening them to UTF-16.
 class BufferedUtf16CharacterStream: public Utf16CharacterStream {
  public:
   BufferedUtf16CharacterStream();
@@ -28,16 +30,26 @@ class BufferedUtf16CharacterStream: public Utf16CharacterStream {
  protected:
   static const size_t kBufferSize = 512;
   static const size_t kPushBackStepSize = 16;
+  // One-byte blocks leave room for pushing back into buffer_ once widened.
+  static const size_t kOneByteBufferSize = kBufferSize - kPushBackStepSize;
 
   size_t SlowSeekForward(size_t delta) override;
   bool ReadBlock() override;
   virtual void SlowPushBack(uc16 character);
 
   virtual size_t BufferSeekForward(size_t delta) = 0;
+  // Fills the buffer with the characters from |position| on and returns
+  // their number. Blocks of one-byte characters can be written to
+  // one_byte_buffer_ instead of buffer_ by also setting one_byte_block_.
   virtual size_t FillBuffer(size_t position) = 0;
 
+  // Moves the rest of the current one-byte block to the end of buffer_.
+  void WidenOneByteBlock();
+
   const uc16* pushback_limit_;
   uc16 buffer_[kBufferSize];
+  uint8_t one_byte_buffer_[kOneByteBufferSize];
+  bool one_byte_block_;
 };
 
 
@@ -60,6 +72,7 @@ class GenericStringUtf16CharacterStream: public BufferedUtf16CharacterStream {
   Handle<String> string_;
   size_t length_;
   size_t bookmark_;
+  bool is_one_byte_;
 };
 
 
@@ -71,6 +84,10 @@ class Utf8ToUtf16CharacterStream: public BufferedUtf16CharacterStream {
 
   static size_t CopyChars(uint16_t* dest, size_t length, const byte* src,
                           size_t* src_pos, size_t src_length);
+  // Copies the ASCII characters at the start of the UTF-8 data, which
+  // need no decoding, and stops at the first multi-byte character.
+  static size_t CopyAsciiChars(uint8_t* dest, size_t length, const byte* src,
+                               size_t* src_pos, size_t src_length);
 
  protected:
   size_t BufferSeekForward(size_t delta) override;
@@ -125,6 +142,7 @@ class ExternalStreamingStream : public BufferedUtf16CharacterStream {
 
  private:
   void HandleUtf8SplitCharacters(size_t* data_in_buffer);
+  size_t FillOneByteBuffer();
   void FlushCurrent();
 
   ScriptCompiler::ExternalSourceStream* source_stream_;
@@ -185,6 +203,45 @@ class ExternalTwoByteStringUtf16CharacterStream: public Utf16CharacterStream {
   size_t bookmark_;
 };
 
+
+// One-byte buffer to read characters from an external one-byte string. The
+// characters are not widened to UTF-16 but scanned in place.
+class ExternalOneByteStringUtf16CharacterStream : public Utf16CharacterStream {
+ public:
+  ExternalOneByteStringUtf16CharacterStream(Handle<ExternalOneByteString> data,
+                                            int start_position,
+                                            int end_position);
+  ~ExternalOneByteStringUtf16CharacterStream() override;
+
+  void PushBack(uc32 character) override {
+    DCHECK(one_byte_cursor_ > raw_data_);
+    pos_--;
+    if (character != kEndOfInput) {
+      one_byte_cursor_--;
+    }
+  }
+
+  bool SetBookmark() override;
+  void ResetToBookmark() override;
+
+ protected:
+  size_t SlowSeekForward(size_t delta) override {
+    // Fast case always handles seeking.
+    return 0;
+  }
+  bool ReadBlock() override {
+    // Entire string is read at start.
+    return false;
+  }
+  Handle<ExternalOneByteString> source_;
+  const uint8_t* raw_data_;  // Pointer to the actual array of characters.
+
+ private:
+  static const size_t kNoBookmark = -1;
+
+  size_t bookmark_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
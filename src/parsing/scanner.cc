@@ -33,6 +33,22 @@ bool Utf16CharacterStream::SetBookmark() { return false; }
 void Utf16CharacterStream::ResetToBookmark() { UNREACHABLE(); }
 
 
+uc32 Utf16CharacterStream::ReadBlockAndAdvance() {
+  bool has_more = ReadBlock();
+  // Note: currently the following increment is necessary to avoid a
+  // parser problem! The scanner treats the final kEndOfInput as
+  // a code unit with a position, and does math relative to that
+  // position.
+  pos_++;
+  if (!has_more) return kEndOfInput;
+  if (one_byte_cursor_ < one_byte_end_) {
+    return static_cast<uc32>(*(one_byte_cursor_++));
+  }
+  DCHECK(buffer_cursor_ < buffer_end_);
+  return static_cast<uc32>(*(buffer_cursor_++));
+}
+
+
 // ----------------------------------------------------------------------------
 // Scanner
 
@@ -46,6 +62,23 @@ Scanner::Scanner(UnicodeCache* unicode_cache)
   bookmark_current_.raw_literal_chars = &bookmark_current_raw_literal_;
   bookmark_next_.literal_chars = &bookmark_next_literal_;
   bookmark_next_.raw_literal_chars = &bookmark_next_raw_literal_;
+  LiteralBuffer* buffers[] = {&literal_buffer0_,     &literal_buffer1_,
+                              &literal_buffer2_,     &raw_literal_buffer0_,
+                              &raw_literal_buffer1_, &raw_literal_buffer2_};
+  for (LiteralBuffer* buffer : buffers) {
+    buffer->AdoptBackingStore(unicode_cache_->TakeLiteralBufferStore());
+  }
+}
+
+
+Scanner::~Scanner() {
+  // Leave the backing stores of the most used buffers to the next scanner.
+  LiteralBuffer* buffers[] = {&literal_buffer0_,     &literal_buffer1_,
+                              &literal_buffer2_,     &raw_literal_buffer0_,
+                              &raw_literal_buffer1_, &raw_literal_buffer2_};
+  for (LiteralBuffer* buffer : buffers) {
+    unicode_cache_->ReturnLiteralBufferStore(buffer->ReleaseBackingStore());
+  }
 }
 
 
@@ -311,6 +344,7 @@ bool Scanner::SkipWhiteSpace() {
                  !IsLittleEndianByteOrderMark(c0_)) {
         break;
       }
+      SkipBufferedSource(BufferedRunLength(CharacterRun::kWhiteSpace));
       Advance();
     }
 
@@ -347,6 +381,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
   while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+    SkipBufferedSource(BufferedRunLength(CharacterRun::kSingleLineComment));
     Advance();
   }
 
@@ -421,6 +456,10 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   while (c0_ >= 0) {
     uc32 ch = c0_;
+    if (ch != '*') {
+      // Nothing up to the next '*' or line terminator affects the comment.
+      SkipBufferedSource(BufferedRunLength(CharacterRun::kMultiLineComment));
+    }
     Advance();
     if (c0_ >= 0 && unicode_cache_->IsLineTerminator(ch)) {
       // Following ECMA-262, section 7.4, a comment containing
@@ -837,6 +876,8 @@ const int kMaxAscii = 127;
 
 Token::Value Scanner::ScanString() {
   uc32 quote = c0_;
+  CharacterRun run = quote == '"' ? CharacterRun::kDoubleQuotedString
+                                  : CharacterRun::kSingleQuotedString;
   Advance<false, false>();  // consume quote
 
   LiteralScope literal(this);
@@ -851,10 +892,8 @@ Token::Value Scanner::ScanString() {
       Advance<false, false>();
       return Token::STRING;
     }
-    uc32 c = c0_;
-    if (c == '\\') break;
-    Advance<false, false>();
-    AddLiteralChar(c);
+    if (c0_ == '\\') break;
+    AddLiteralRunAdvance(run);
   }
 
   while (c0_ != quote && c0_ >= 0
@@ -1134,112 +1173,20 @@ uc32 Scanner::ScanUnicodeEscape() {
 // ----------------------------------------------------------------------------
 // Keyword Matcher
 
-#define KEYWORDS(KEYWORD_GROUP, KEYWORD)                    \
-  KEYWORD_GROUP('a')                                        \
-  KEYWORD("await", Token::AWAIT)                            \
-  KEYWORD_GROUP('b')                                        \
-  KEYWORD("break", Token::BREAK)                            \
-  KEYWORD_GROUP('c')                                        \
-  KEYWORD("case", Token::CASE)                              \
-  KEYWORD("catch", Token::CATCH)                            \
-  KEYWORD("class", Token::CLASS)                            \
-  KEYWORD("const", Token::CONST)                            \
-  KEYWORD("continue", Token::CONTINUE)                      \
-  KEYWORD_GROUP('d')                                        \
-  KEYWORD("debugger", Token::DEBUGGER)                      \
-  KEYWORD("default", Token::DEFAULT)                        \
-  KEYWORD("delete", Token::DELETE)                          \
-  KEYWORD("do", Token::DO)                                  \
-  KEYWORD_GROUP('e')                                        \
-  KEYWORD("else", Token::ELSE)                              \
-  KEYWORD("enum", Token::ENUM)                              \
-  KEYWORD("export", Token::EXPORT)                          \
-  KEYWORD("extends", Token::EXTENDS)                        \
-  KEYWORD_GROUP('f')                                        \
-  KEYWORD("false", Token::FALSE_LITERAL)                    \
-  KEYWORD("finally", Token::FINALLY)                        \
-  KEYWORD("for", Token::FOR)                                \
-  KEYWORD("function", Token::FUNCTION)                      \
-  KEYWORD_GROUP('i')                                        \
-  KEYWORD("if", Token::IF)                                  \
-  KEYWORD("implements", Token::FUTURE_STRICT_RESERVED_WORD) \
-  KEYWORD("import", Token::IMPORT)                          \
-  KEYWORD("in", Token::IN)                                  \
-  KEYWORD("instanceof", Token::INSTANCEOF)                  \
-  KEYWORD("interface", Token::FUTURE_STRICT_RESERVED_WORD)  \
-  KEYWORD_GROUP('l')                                        \
-  KEYWORD("let", Token::LET)                                \
-  KEYWORD_GROUP('n')                                        \
-  KEYWORD("new", Token::NEW)                                \
-  KEYWORD("null", Token::NULL_LITERAL)                      \
-  KEYWORD_GROUP('p')                                        \
-  KEYWORD("package", Token::FUTURE_STRICT_RESERVED_WORD)    \
-  KEYWORD("private", Token::FUTURE_STRICT_RESERVED_WORD)    \
-  KEYWORD("protected", Token::FUTURE_STRICT_RESERVED_WORD)  \
-  KEYWORD("public", Token::FUTURE_STRICT_RESERVED_WORD)     \
-  KEYWORD_GROUP('r')                                        \
-  KEYWORD("return", Token::RETURN)                          \
-  KEYWORD_GROUP('s')                                        \
-  KEYWORD("static", Token::STATIC)                          \
-  KEYWORD("super", Token::SUPER)                            \
-  KEYWORD("switch", Token::SWITCH)                          \
-  KEYWORD_GROUP('t')                                        \
-  KEYWORD("this", Token::THIS)                              \
-  KEYWORD("throw", Token::THROW)                            \
-  KEYWORD("true", Token::TRUE_LITERAL)                      \
-  KEYWORD("try", Token::TRY)                                \
-  KEYWORD("typeof", Token::TYPEOF)                          \
-  KEYWORD_GROUP('v')                                        \
-  KEYWORD("var", Token::VAR)                                \
-  KEYWORD("void", Token::VOID)                              \
-  KEYWORD_GROUP('w')                                        \
-  KEYWORD("while", Token::WHILE)                            \
-  KEYWORD("with", Token::WITH)                              \
-  KEYWORD_GROUP('y')                                        \
-  KEYWORD("yield", Token::YIELD)
-
 static Token::Value KeywordOrIdentifierToken(const uint8_t* input,
                                              int input_length, bool escaped) {
   DCHECK(input_length >= 1);
-  const int kMinLength = 2;
-  const int kMaxLength = 10;
-  if (input_length < kMinLength || input_length > kMaxLength) {
-    return Token::IDENTIFIER;
-  }
-  switch (input[0]) {
-    default:
-#define KEYWORD_GROUP_CASE(ch)                                \
-      break;                                                  \
-    case ch:
-#define KEYWORD(keyword, token)                                     \
-  {                                                                 \
-    /* 'keyword' is a char array, so sizeof(keyword) is */          \
-    /* strlen(keyword) plus 1 for the NUL char. */                  \
-    const int keyword_length = sizeof(keyword) - 1;                 \
-    STATIC_ASSERT(keyword_length >= kMinLength);                    \
-    STATIC_ASSERT(keyword_length <= kMaxLength);                    \
-    if (input_length == keyword_length && input[1] == keyword[1] && \
-        (keyword_length <= 2 || input[2] == keyword[2]) &&          \
-        (keyword_length <= 3 || input[3] == keyword[3]) &&          \
-        (keyword_length <= 4 || input[4] == keyword[4]) &&          \
-        (keyword_length <= 5 || input[5] == keyword[5]) &&          \
-        (keyword_length <= 6 || input[6] == keyword[6]) &&          \
-        (keyword_length <= 7 || input[7] == keyword[7]) &&          \
-        (keyword_length <= 8 || input[8] == keyword[8]) &&          \
-        (keyword_length <= 9 || input[9] == keyword[9])) {          \
-      if (escaped) {                                                \
-        /* TODO(adamk): YIELD should be handled specially. */       \
-        return (token == Token::FUTURE_STRICT_RESERVED_WORD ||      \
-                token == Token::LET || token == Token::STATIC)      \
-                   ? Token::ESCAPED_STRICT_RESERVED_WORD            \
-                   : Token::ESCAPED_KEYWORD;                        \
-      }                                                             \
-      return token;                                                 \
-    }                                                               \
-  }
-    KEYWORDS(KEYWORD_GROUP_CASE, KEYWORD)
+  int index = KeywordTable::Lookup(input, input_length);
+  if (index == KeywordTable::kNotFound) return Token::IDENTIFIER;
+  Token::Value token = KeywordTable::token(index);
+  if (escaped && token != Token::IDENTIFIER) {
+    // TODO(adamk): YIELD should be handled specially.
+    return (token == Token::FUTURE_STRICT_RESERVED_WORD ||
+            token == Token::LET || token == Token::STATIC)
+               ? Token::ESCAPED_STRICT_RESERVED_WORD
+               : Token::ESCAPED_KEYWORD;
   }
-  return Token::IDENTIFIER;
+  return token;
 }
 
 
@@ -1269,36 +1216,28 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
     if (IsDecimalDigit(c0_) || IsInRange(c0_, 'A', 'Z') || c0_ == '_' ||
         c0_ == '$') {
       // Identifier starting with lowercase.
-      uc32 first_char = c0_;
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-      while (IsAsciiIdentifier(c0_)) {
-        uc32 first_char = c0_;
-        Advance<false, false>();
-        AddLiteralChar(first_char);
-      }
+      do {
+        AddAsciiIdentifierPartsAdvance();
+      } while (IsAsciiIdentifier(c0_));
       if (c0_ <= kMaxAscii && c0_ != '\\') {
         literal.Complete();
-        return Token::IDENTIFIER;
+        return LookUpKeywordOrIdentifier();
       }
     } else if (c0_ <= kMaxAscii && c0_ != '\\') {
       // Only a-z+: could be a keyword or identifier.
       literal.Complete();
-      Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
-      return KeywordOrIdentifierToken(chars.start(), chars.length(), false);
+      return LookUpKeywordOrIdentifier();
     }
 
     HandleLeadSurrogate();
   } else if (IsInRange(c0_, 'A', 'Z') || c0_ == '_' || c0_ == '$') {
     do {
-      uc32 first_char = c0_;
-      Advance<false, false>();
-      AddLiteralChar(first_char);
+      AddAsciiIdentifierPartsAdvance();
     } while (IsAsciiIdentifier(c0_));
 
     if (c0_ <= kMaxAscii && c0_ != '\\') {
       literal.Complete();
-      return Token::IDENTIFIER;
+      return LookUpKeywordOrIdentifier();
     }
 
     HandleLeadSurrogate();
@@ -1333,14 +1272,20 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
   literal.Complete();
 
-  if (next_.literal_chars->is_one_byte()) {
-    Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
-    return KeywordOrIdentifierToken(chars.start(), chars.length(), false);
-  }
+  if (next_.literal_chars->is_one_byte()) return LookUpKeywordOrIdentifier();
   return Token::IDENTIFIER;
 }
 
 
+Token::Value Scanner::LookUpKeywordOrIdentifier() {
+  Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
+  int index = KeywordTable::Lookup(chars.start(), chars.length());
+  next_.keyword_table_index = index;
+  if (index == KeywordTable::kNotFound) return Token::IDENTIFIER;
+  return KeywordTable::token(index);
+}
+
+
 Token::Value Scanner::ScanIdentifierSuffix(LiteralScope* literal,
                                            bool escaped) {
   // Scan the rest of the identifier characters.
@@ -1455,6 +1400,10 @@ Maybe<RegExp::Flags> Scanner::ScanRegExpFlags() {
 
 
 const AstRawString* Scanner::CurrentSymbol(AstValueFactory* ast_value_factory) {
+  if (current_.keyword_table_index != KeywordTable::kNotFound) {
+    return ast_value_factory->GetKeywordTableString(
+        current_.keyword_table_index);
+  }
   if (is_literal_one_byte()) {
     return ast_value_factory->GetOneByteString(literal_one_byte_string());
   }
@@ -1463,6 +1412,9 @@ const AstRawString* Scanner::CurrentSymbol(AstValueFactory* ast_value_factory) {
 
 
 const AstRawString* Scanner::NextSymbol(AstValueFactory* ast_value_factory) {
+  if (next_.keyword_table_index != KeywordTable::kNotFound) {
+    return ast_value_factory->GetKeywordTableString(next_.keyword_table_index);
+  }
   if (is_next_literal_one_byte()) {
     return ast_value_factory->GetOneByteString(next_literal_one_byte_string());
   }
@@ -1550,6 +1502,7 @@ void Scanner::CopyTokenDesc(TokenDesc* to, TokenDesc* from) {
   to->location = from->location;
   to->literal_chars->CopyFrom(from->literal_chars);
   to->raw_literal_chars->CopyFrom(from->raw_literal_chars);
+  to->keyword_table_index = from->keyword_table_index;
 }
 
 
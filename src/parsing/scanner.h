@@ -15,6 +15,8 @@
 #include "src/hashmap.h"
 #include "src/list.h"
 #include "src/messages.h"
+#include "src/parsing/character-runs.h"
+#include "src/parsing/keyword-table.h"
 #include "src/parsing/token.h"
 #include "src/unicode.h"
 #include "src/unicode-decoder.h"
@@ -36,24 +38,27 @@ class UnicodeCache;
 
 class Utf16CharacterStream {
  public:
-  Utf16CharacterStream() : pos_(0) { }
+  Utf16CharacterStream()
+      : one_byte_cursor_(NULL),
+        one_byte_end_(NULL),
+        buffer_cursor_(NULL),
+        buffer_end_(NULL),
+        pos_(0) {}
   virtual ~Utf16CharacterStream() { }
 
   // Returns and advances past the next UTF-16 code unit in the input
   // stream. If there are no more code units, it returns a negative
   // value.
   inline uc32 Advance() {
-    if (buffer_cursor_ < buffer_end_ || ReadBlock()) {
+    if (one_byte_cursor_ < one_byte_end_) {
+      pos_++;
+      return static_cast<uc32>(*(one_byte_cursor_++));
+    }
+    if (buffer_cursor_ < buffer_end_) {
       pos_++;
       return static_cast<uc32>(*(buffer_cursor_++));
     }
-    // Note: currently the following increment is necessary to avoid a
-    // parser problem! The scanner treats the final kEndOfInput as
-    // a code unit with a position, and does math relative to that
-    // position.
-    pos_++;
-
-    return kEndOfInput;
+    return ReadBlockAndAdvance();
   }
 
   // Return the current position in the code unit stream.
@@ -65,6 +70,12 @@ class Utf16CharacterStream {
   // Returns the number of code units actually skipped. If less
   // than code_unit_count,
   inline size_t SeekForward(size_t code_unit_count) {
+    size_t buffered_one_byte_chars = one_byte_end_ - one_byte_cursor_;
+    if (code_unit_count <= buffered_one_byte_chars) {
+      one_byte_cursor_ += code_unit_count;
+      pos_ += code_unit_count;
+      return code_unit_count;
+    }
     size_t buffered_chars = buffer_end_ - buffer_cursor_;
     if (code_unit_count <= buffered_chars) {
       buffer_cursor_ += code_unit_count;
@@ -74,6 +85,20 @@ class Utf16CharacterStream {
     return SlowSeekForward(code_unit_count);
   }
 
+  // Returns the code units that are buffered after the current position.
+  // Streams over one-byte sources buffer them as one-byte characters, which
+  // saves widening them to UTF-16; only one of the two is ever non-empty.
+  // A prefix of them can be consumed with SeekForward without refilling the
+  // buffer.
+  inline Vector<const uint8_t> BufferedOneByteCodeUnits() const {
+    return Vector<const uint8_t>(
+        one_byte_cursor_, static_cast<int>(one_byte_end_ - one_byte_cursor_));
+  }
+  inline Vector<const uint16_t> BufferedTwoByteCodeUnits() const {
+    return Vector<const uint16_t>(
+        buffer_cursor_, static_cast<int>(buffer_end_ - buffer_cursor_));
+  }
+
   // Pushes back the most recently read UTF-16 code unit (or negative
   // value if at end of input), i.e., the value returned by the most recent
   // call to Advance.
@@ -86,13 +111,21 @@ class Utf16CharacterStream {
  protected:
   static const uc32 kEndOfInput = -1;
 
-  // Ensures that the buffer_cursor_ points to the code_unit at
-  // position pos_ of the input, if possible. If the position
-  // is at or after the end of the input, return false. If there
-  // are more code_units available, return true.
+  // Ensures that either the one_byte_cursor_ or the buffer_cursor_ points
+  // to the code_unit at position pos_ of the input, if possible, and that
+  // the other buffer is empty. If the position is at or after the end of
+  // the input, return false. If there are more code_units available, return
+  // true.
   virtual bool ReadBlock() = 0;
   virtual size_t SlowSeekForward(size_t code_unit_count) = 0;
 
+  // The slow path of Advance, taken when both buffers are exhausted.
+  uc32 ReadBlockAndAdvance();
+
+  // Blocks of one-byte characters are buffered without widening them, and
+  // the UTF-16 buffer below is empty while they are read.
+  const uint8_t* one_byte_cursor_;
+  const uint8_t* one_byte_end_;
   const uint16_t* buffer_cursor_;
   const uint16_t* buffer_end_;
   size_t pos_;
@@ -182,6 +215,20 @@ class LiteralBuffer {
     }
   }
 
+  // Adds ASCII code units, which never require conversion to two bytes.
+  template <typename Char>
+  void AddAsciiChars(const Char* chars, int count) {
+    int size = count * (is_one_byte_ ? kOneByteSize : kUC16Size);
+    while (position_ + size > backing_store_.length()) ExpandBuffer();
+    if (is_one_byte_) {
+      CopyChars(&backing_store_[position_], chars, count);
+    } else {
+      CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]), chars,
+                count);
+    }
+    position_ += size;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool is_contextual_keyword(Vector<const char> keyword) const {
@@ -217,6 +264,20 @@ class LiteralBuffer {
     is_one_byte_ = true;
   }
 
+  // Adopts |store|, which may be empty, as the backing store of the buffer.
+  void AdoptBackingStore(Vector<byte> store) {
+    DCHECK(backing_store_.is_empty());
+    backing_store_ = store;
+  }
+
+  // Gives up the backing store, leaving the buffer empty.
+  Vector<byte> ReleaseBackingStore() {
+    Vector<byte> store = backing_store_;
+    backing_store_ = Vector<byte>();
+    Reset();
+    return store;
+  }
+
   Handle<String> Internalize(Isolate* isolate) const;
 
   void CopyFrom(const LiteralBuffer* other) {
@@ -348,6 +409,7 @@ class Scanner {
   static const int kNoOctalLocation = -1;
 
   explicit Scanner(UnicodeCache* scanner_contants);
+  ~Scanner();
 
   void Initialize(Utf16CharacterStream* source);
 
@@ -475,6 +537,9 @@ class Scanner {
     LiteralBuffer* literal_chars;
     LiteralBuffer* raw_literal_chars;
     int smi_value_;
+    // The index of an unescaped identifier or keyword in the KeywordTable,
+    // or KeywordTable::kNotFound.
+    int keyword_table_index;
   };
 
   static const int kCharacterLookaheadBufferSize = 1;
@@ -526,6 +591,7 @@ class Scanner {
                                                             : &literal_buffer0_;
     free_buffer->Reset();
     next_.literal_chars = free_buffer;
+    next_.keyword_table_index = KeywordTable::kNotFound;
   }
 
   inline void StartRawLiteral() {
@@ -566,6 +632,57 @@ class Scanner {
     Advance();
   }
 
+  // Returns the length of the |run| of code units buffered in the source
+  // after c0_, which lets the fast paths for comments, identifiers and
+  // strings find the end of a run of characters without advancing through
+  // it one character at a time.
+  inline size_t BufferedRunLength(CharacterRun run) const {
+    Vector<const uint8_t> one_byte = source_->BufferedOneByteCodeUnits();
+    if (!one_byte.is_empty()) {
+      return CharacterRunLength(run, one_byte.start(),
+                                static_cast<size_t>(one_byte.length()));
+    }
+    Vector<const uint16_t> two_byte = source_->BufferedTwoByteCodeUnits();
+    return CharacterRunLength(run, two_byte.start(),
+                              static_cast<size_t>(two_byte.length()));
+  }
+
+  // Skips |count| code units buffered in the source after c0_. c0_ is left
+  // unchanged, so this has to be followed by Advance.
+  inline void SkipBufferedSource(size_t count) {
+    size_t skipped = source_->SeekForward(count);
+    USE(skipped);
+    DCHECK_EQ(count, skipped);
+  }
+
+  // Adds c0_ and the |run| of code units buffered after it, which must
+  // consist of ASCII characters only, to the literal and advances past them.
+  inline void AddLiteralRunAdvance(CharacterRun run) {
+    AddLiteralChar(c0_);
+    size_t count;
+    Vector<const uint8_t> one_byte = source_->BufferedOneByteCodeUnits();
+    if (!one_byte.is_empty()) {
+      count = CharacterRunLength(run, one_byte.start(),
+                                 static_cast<size_t>(one_byte.length()));
+      next_.literal_chars->AddAsciiChars(one_byte.start(),
+                                         static_cast<int>(count));
+    } else {
+      Vector<const uint16_t> two_byte = source_->BufferedTwoByteCodeUnits();
+      count = CharacterRunLength(run, two_byte.start(),
+                                 static_cast<size_t>(two_byte.length()));
+      next_.literal_chars->AddAsciiChars(two_byte.start(),
+                                         static_cast<int>(count));
+    }
+    SkipBufferedSource(count);
+    Advance<false, false>();
+  }
+
+  // Adds c0_, an ASCII identifier part, and the ASCII identifier parts
+  // buffered after it to the literal and advances past them.
+  inline void AddAsciiIdentifierPartsAdvance() {
+    AddLiteralRunAdvance(CharacterRun::kAsciiIdentifierPart);
+  }
+
   // Low-level scanning support.
   template <bool capture_raw = false, bool check_surrogate = true>
   void Advance() {
@@ -685,6 +802,9 @@ class Scanner {
   Token::Value ScanNumber(bool seen_period);
   Token::Value ScanIdentifierOrKeyword();
   Token::Value ScanIdentifierSuffix(LiteralScope* literal, bool escaped);
+  // Classifies the one-byte identifier in next_.literal_chars and remembers
+  // its index in the keyword table.
+  Token::Value LookUpKeywordOrIdentifier();
 
   Token::Value ScanString();
 
@@ -14,6 +14,7 @@
 #include "src/frames-inl.h"
 #include "src/full-codegen/full-codegen.h"
 #include "src/global-handles.h"
+#include "src/interpreter/interpreter.h"
 
 namespace v8 {
 namespace internal {
@@ -42,6 +43,11 @@ static const int kOSRCodeSizeAllowanceBase =
 static const int kOSRCodeSizeAllowancePerTick =
     4 * FullCodeGenerator::kCodeSizeMultiplier;
 
+// Maximum size in bytes of generated bytecode for a function to allow OSR.
+static const int kOSRBytecodeSizeAllowanceBase = 132;
+
+static const int kOSRBytecodeSizeAllowancePerTick = 48;
+
 // Maximum size in bytes of generated code for a function to be optimized
 // the very first time it is seen on the stack.
 static const int kMaxSizeEarlyOpt =
@@ -106,7 +112,8 @@ void RuntimeProfiler::Optimize(JSFunction* function, const char* reason) {
     PrintF("]\n");
   }
 
-  if (function->shared()->HasBytecodeArray()) {
+  if (function->shared()->HasBytecodeArray() &&
+      !function->shared()->bytecode_array()->HasBaselineCode()) {
     function->MarkForBaseline();
   } else {
     function->AttemptConcurrentOptimization();
@@ -133,13 +140,22 @@ void RuntimeProfiler::AttemptOnStackReplacement(JSFunction* function,
   // any back edge in any unoptimized frame will trigger on-stack
   // replacement for that frame.
   if (FLAG_trace_osr) {
-    PrintF("[OSR - patching back edges in ");
+    PrintF("[OSR - arming back edges in ");
     function->PrintName();
     PrintF("]\n");
   }
 
-  for (int i = 0; i < loop_nesting_levels; i++) {
-    BackEdgeTable::Patch(isolate_, shared->code());
+  if (shared->code()->kind() == Code::FUNCTION) {
+    for (int i = 0; i < loop_nesting_levels; i++) {
+      BackEdgeTable::Patch(isolate_, shared->code());
+    }
+  } else if (shared->HasBytecodeArray() && FLAG_ignition_osr) {
+    // Interpreted loops poll the nesting level stored in the bytecode array
+    // instead of having their back edges patched.
+    BytecodeArray* bytecode = shared->bytecode_array();
+    int level = Min(bytecode->osr_loop_nesting_level() + loop_nesting_levels,
+                    static_cast<int>(Code::kMaxLoopNestingMarker));
+    bytecode->set_osr_loop_nesting_level(level);
   }
 }
 
@@ -251,12 +267,24 @@ void RuntimeProfiler::MaybeOptimizeIgnition(JSFunction* function,
   // TODO(rmcilroy): Consider whether we should optimize small functions when
   // they are first seen on the stack (e.g., kMaxSizeEarlyOpt).
 
-  if (!frame_optimized && (function->IsMarkedForBaseline() ||
-                           function->IsMarkedForOptimization() ||
-                           function->IsMarkedForConcurrentOptimization() ||
-                           function->IsOptimized())) {
-    // TODO(rmcilroy): Support OSR in these cases.
-
+  if (FLAG_ignition_osr && FLAG_always_osr) {
+    AttemptOnStackReplacement(function, Code::kMaxLoopNestingMarker);
+    // Fall through and do a normal optimized compile as well.
+  } else if (!frame_optimized &&
+             (function->IsMarkedForBaseline() ||
+              function->IsMarkedForOptimization() ||
+              function->IsMarkedForConcurrentOptimization() ||
+              function->IsOptimized())) {
+    // Attempt OSR if we are still running interpreted code even though the
+    // function has long been marked or even already been optimized.
+    if (FLAG_ignition_osr && !function->IsMarkedForBaseline()) {
+      int64_t allowance =
+          kOSRBytecodeSizeAllowanceBase +
+          static_cast<int64_t>(ticks) * kOSRBytecodeSizeAllowancePerTick;
+      if (shared->bytecode_array()->Size() <= allowance) {
+        AttemptOnStackReplacement(function);
+      }
+    }
     return;
   }
 
@@ -297,41 +325,65 @@ void RuntimeProfiler::MaybeOptimizeIgnition(JSFunction* function,
   }
 }
 
+bool RuntimeProfiler::ShouldThreadBytecode(JSFunction* function) {
+  if (!FLAG_ignition_threaded_dispatch) return false;
+  SharedFunctionInfo* shared = function->shared();
+  // Debugging dispatches through the patched copy of the bytecode array.
+  if (!shared->HasBytecodeArray() || shared->HasDebugInfo()) return false;
+  if (shared->bytecode_array()->HasThreadedCode()) return false;
+  return shared->profiler_ticks() >= FLAG_ignition_threaded_dispatch_ticks;
+}
+
 void RuntimeProfiler::MarkCandidatesForOptimization() {
   HandleScope scope(isolate_);
 
   if (!isolate_->use_crankshaft()) return;
 
-  DisallowHeapAllocation no_gc;
-
-  // Run through the JavaScript frames and collect them. If we already
-  // have a sample of the function, we mark it for optimizations
-  // (eagerly or lazily).
-  int frame_count = 0;
-  int frame_count_limit = FLAG_frame_count;
-  for (JavaScriptFrameIterator it(isolate_);
-       frame_count++ < frame_count_limit && !it.done();
-       it.Advance()) {
-    JavaScriptFrame* frame = it.frame();
-    JSFunction* function = frame->function();
-
-    List<JSFunction*> functions(4);
-    frame->GetFunctions(&functions);
-    for (int i = functions.length(); --i >= 0; ) {
-      SharedFunctionInfo* shared_function_info = functions[i]->shared();
-      int ticks = shared_function_info->profiler_ticks();
-      if (ticks < Smi::kMaxValue) {
-        shared_function_info->set_profiler_ticks(ticks + 1);
+  List<Handle<BytecodeArray> > bytecode_arrays_to_thread;
+  {
+    DisallowHeapAllocation no_gc;
+
+    // Run through the JavaScript frames and collect them. If we already
+    // have a sample of the function, we mark it for optimizations
+    // (eagerly or lazily).
+    int frame_count = 0;
+    int frame_count_limit = FLAG_frame_count;
+    for (JavaScriptFrameIterator it(isolate_);
+         frame_count++ < frame_count_limit && !it.done();
+         it.Advance()) {
+      JavaScriptFrame* frame = it.frame();
+      JSFunction* function = frame->function();
+
+      List<JSFunction*> functions(4);
+      frame->GetFunctions(&functions);
+      for (int i = functions.length(); --i >= 0; ) {
+        SharedFunctionInfo* shared_function_info = functions[i]->shared();
+        int ticks = shared_function_info->profiler_ticks();
+        if (ticks < Smi::kMaxValue) {
+          shared_function_info->set_profiler_ticks(ticks + 1);
+        }
       }
-    }
 
-    if (frame->is_interpreted()) {
-      MaybeOptimizeIgnition(function, frame->is_optimized());
-    } else {
-      MaybeOptimizeFullCodegen(function, frame_count, frame->is_optimized());
+      if (frame->is_interpreted()) {
+        if (ShouldThreadBytecode(function)) {
+          bytecode_arrays_to_thread.Add(
+              handle(function->shared()->bytecode_array(), isolate_));
+        }
+        MaybeOptimizeIgnition(function, frame->is_optimized());
+      } else {
+        MaybeOptimizeFullCodegen(function, frame_count, frame->is_optimized());
+      }
     }
   }
   any_ic_changed_ = false;
+
+  // Threading allocates, so it is done once the frames have been visited.
+  for (int i = 0; i < bytecode_arrays_to_thread.length(); i++) {
+    Handle<BytecodeArray> bytecode_array = bytecode_arrays_to_thread[i];
+    // Recursive functions appear more than once.
+    if (bytecode_array->HasThreadedCode()) continue;
+    isolate_->interpreter()->ThreadBytecodeArray(bytecode_array);
+  }
 }
 
 
@@ -27,6 +27,9 @@ class RuntimeProfiler {
   void MaybeOptimizeFullCodegen(JSFunction* function, int frame_count,
                                 bool frame_optimized);
   void MaybeOptimizeIgnition(JSFunction* function, bool frame_optimized);
+  // Returns true if the bytecode of |function| is hot enough to dispatch
+  // through threaded code.
+  bool ShouldThreadBytecode(JSFunction* function);
   void Optimize(JSFunction* function, const char* reason);
 
   bool CodeSizeOKForOSR(Code* shared_code);
@@ -197,7 +197,6 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
   CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
-  Handle<Code> caller_code(function->shared()->code());
 
   // We're not prepared to handle a function with arguments object.
   DCHECK(!function->shared()->uses_arguments());
@@ -208,22 +207,42 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
   // not GC safe, so we walk the stack to get it.
   JavaScriptFrameIterator it(isolate);
   JavaScriptFrame* frame = it.frame();
-  if (!caller_code->contains(frame->pc())) {
-    // Code on the stack may not be the code object referenced by the shared
-    // function info.  It may have been replaced to include deoptimization data.
-    caller_code = Handle<Code>(frame->LookupCode());
-  }
+  DCHECK_EQ(frame->function(), *function);
 
-  uint32_t pc_offset =
-      static_cast<uint32_t>(frame->pc() - caller_code->instruction_start());
+  // Determine the entry point for which this OSR request has been fired and
+  // also disarm all back edges in the calling code to stop new requests.
+  Handle<Code> caller_code;
+  BailoutId ast_id = BailoutId::None();
+  if (frame->is_interpreted()) {
+    DCHECK(FLAG_ignition_osr);
+    // Reset the OSR loop nesting depth to disarm back edges. This disarms
+    // all activations sharing the BytecodeArray, just like unpatching the
+    // back edges of full-codegen code does; the runtime profiler arms them
+    // again if they stay hot.
+    function->shared()->bytecode_array()->set_osr_loop_nesting_level(0);
+    // The {OsrPoll} that fired is the first bytecode of its loop header, so
+    // its offset identifies the loop in the graph built from bytecode.
+    InterpretedFrame* interpreted_frame = static_cast<InterpretedFrame*>(frame);
+    ast_id = BailoutId(interpreted_frame->GetBytecodeOffset());
+  } else {
+    caller_code = handle(function->shared()->code());
+    if (!caller_code->contains(frame->pc())) {
+      // Code on the stack may not be the code object referenced by the shared
+      // function info.  It may have been replaced to include deoptimization
+      // data.
+      caller_code = Handle<Code>(frame->LookupCode());
+    }
+
+    uint32_t pc_offset =
+        static_cast<uint32_t>(frame->pc() - caller_code->instruction_start());
 
 #ifdef DEBUG
-  DCHECK_EQ(frame->function(), *function);
-  DCHECK_EQ(frame->LookupCode(), *caller_code);
-  DCHECK(caller_code->contains(frame->pc()));
+    DCHECK_EQ(frame->LookupCode(), *caller_code);
+    DCHECK(caller_code->contains(frame->pc()));
 #endif  // DEBUG
 
-  BailoutId ast_id = caller_code->TranslatePcOffsetToAstId(pc_offset);
+    ast_id = caller_code->TranslatePcOffsetToAstId(pc_offset);
+  }
   DCHECK(!ast_id.IsNone());
 
   MaybeHandle<Code> maybe_result;
@@ -237,7 +256,7 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
   }
 
   // Revert the patched back edge table, regardless of whether OSR succeeds.
-  BackEdgeTable::Revert(isolate, *caller_code);
+  if (!caller_code.is_null()) BackEdgeTable::Revert(isolate, *caller_code);
 
   // Check whether we ended up with usable optimized code.
   Handle<Code> result;
@@ -89,11 +89,24 @@ RUNTIME_FUNCTION(Runtime_FunctionGetScriptSourcePosition) {
 
 
 RUNTIME_FUNCTION(Runtime_FunctionGetPositionForOffset) {
-  SealHandleScope shs(isolate);
-  DCHECK(args.length() == 2);
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 3);
 
-  CONVERT_ARG_CHECKED(AbstractCode, abstract_code, 0);
+  CONVERT_ARG_HANDLE_CHECKED(AbstractCode, abstract_code, 0);
   CONVERT_NUMBER_CHECKED(int, offset, Int32, args[1]);
+  CONVERT_ARG_HANDLE_CHECKED(Object, function, 2);
+
+  // Stack traces only record the bytecode offset. If the function was
+  // compiled without a source position table, it is collected now that the
+  // stack trace is formatted, or the start of the function is used.
+  if (abstract_code->IsBytecodeArray() &&
+      !abstract_code->GetBytecodeArray()->HasSourcePositionTable()) {
+    Handle<JSFunction> fun = Handle<JSFunction>::cast(function);
+    if (!Compiler::EnsureSourcePositions(fun) ||
+        !abstract_code->GetBytecodeArray()->HasSourcePositionTable()) {
+      return Smi::FromInt(fun->shared()->start_position());
+    }
+  }
   return Smi::FromInt(abstract_code->SourcePosition(offset));
 }
 
@@ -128,6 +128,20 @@ RUNTIME_FUNCTION(Runtime_OptimizeFunctionOnNextCall) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_BaselineFunctionOnNextCall) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+
+  // Only functions which have been interpreted can get baseline code.
+  if (function->is_compiled() && function->shared()->HasBytecodeArray() &&
+      !function->shared()->bytecode_array()->HasBaselineCode()) {
+    function->MarkForBaseline();
+  }
+  return isolate->heap()->undefined_value();
+}
+
+
 RUNTIME_FUNCTION(Runtime_OptimizeOsr) {
   HandleScope scope(isolate);
   RUNTIME_ASSERT(args.length() == 0 || args.length() == 1);
@@ -154,18 +168,20 @@ RUNTIME_FUNCTION(Runtime_OptimizeOsr) {
   RUNTIME_ASSERT(function->shared()->allows_lazy_compilation() ||
                  !function->shared()->optimization_disabled());
 
-  // If function is interpreted, just return. OSR is not supported.
-  // TODO(4764): Remove this check when OSR is enabled in the interpreter.
-  if (function->shared()->HasBytecodeArray()) {
+  // If function is interpreted but OSR hasn't been enabled, just return.
+  if (function->shared()->HasBytecodeArray() && !FLAG_ignition_osr) {
     return isolate->heap()->undefined_value();
   }
 
   // If the function is already optimized, just return.
   if (function->IsOptimized()) return isolate->heap()->undefined_value();
 
+  // Make the profiler arm all back edges in unoptimized code.
   Code* unoptimized = function->shared()->code();
-  if (unoptimized->kind() == Code::FUNCTION) {
-    DCHECK(BackEdgeTable::Verify(isolate, unoptimized));
+  if (unoptimized->kind() == Code::FUNCTION ||
+      function->shared()->HasBytecodeArray()) {
+    DCHECK(unoptimized->kind() != Code::FUNCTION ||
+           BackEdgeTable::Verify(isolate, unoptimized));
     isolate->runtime_profiler()->AttemptOnStackReplacement(
         *function, Code::kMaxLoopNestingMarker);
   }
@@ -238,6 +254,17 @@ RUNTIME_FUNCTION(Runtime_GetOptimizationCount) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_HasBaselineCode) {
+  SealHandleScope shs(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_CHECKED(JSFunction, function, 0);
+  SharedFunctionInfo* shared = function->shared();
+  return isolate->heap()->ToBoolean(
+      shared->HasBytecodeArray() &&
+      shared->bytecode_array()->HasBaselineCode());
+}
+
+
 RUNTIME_FUNCTION(Runtime_GetUndetectable) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 0);
@@ -63,6 +63,7 @@ void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
     Code* code_object = Code::cast(obj);
     switch (code_object->kind()) {
       case Code::OPTIMIZED_FUNCTION:  // No optimized code compiled yet.
+      case Code::BASELINE_FUNCTION:   // No baseline code compiled yet.
       case Code::HANDLER:             // No handlers patched in yet.
       case Code::REGEXP:              // No regexp literals initialized yet.
       case Code::NUMBER_OF_KINDS:     // Pseudo enum value.
@@ -303,7 +304,7 @@ SerializedCodeData::SerializedCodeData(const List<byte>& payload,
 }
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
-    Isolate* isolate, String* source) const {
+    Isolate* isolate, String* source, bool checksum_verified) const {
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != ComputeMagicNumber(isolate)) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
@@ -318,10 +319,26 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     return CPU_FEATURES_MISMATCH;
   }
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
-  if (!Checksum(Payload()).Check(c1, c2)) return CHECKSUM_MISMATCH;
+  if (!checksum_verified && !Checksum(Payload()).Check(c1, c2)) {
+    return CHECKSUM_MISMATCH;
+  }
   return CHECK_SUCCESS;
 }
 
+bool SerializedCodeData::HasValidLayout() const {
+  if (size_ < kHeaderSize) return false;
+  // Computed in 64 bits so that corrupted counts cannot overflow.
+  uint64_t num_entries =
+      static_cast<uint64_t>(GetHeaderValue(kNumReservationsOffset)) +
+      GetHeaderValue(kNumCodeStubKeysOffset);
+  uint64_t payload_offset = kHeaderSize + num_entries * kInt32Size;
+  uint64_t padded_payload_offset =
+      (payload_offset + kPointerAlignmentMask) & ~kPointerAlignmentMask;
+  uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
+  return IsAligned(payload_length, kIntptrSize) &&
+         padded_payload_offset + payload_length == static_cast<uint64_t>(size_);
+}
+
 uint32_t SerializedCodeData::SourceHash(String* source) const {
   return source->length();
 }
@@ -370,7 +387,8 @@ SerializedCodeData* SerializedCodeData::FromCachedData(Isolate* isolate,
                                                        String* source) {
   DisallowHeapAllocation no_gc;
   SerializedCodeData* scd = new SerializedCodeData(cached_data);
-  SanityCheckResult r = scd->SanityCheck(isolate, source);
+  SanityCheckResult r =
+      scd->SanityCheck(isolate, source, cached_data->checksum_verified());
   if (r == CHECK_SUCCESS) return scd;
   cached_data->Reject();
   source->GetIsolate()->counters()->code_cache_reject_reason()->AddSample(r);
@@ -378,5 +396,41 @@ SerializedCodeData* SerializedCodeData::FromCachedData(Isolate* isolate,
   return NULL;
 }
 
+void SerializedCodeData::VerifyChecksum(ScriptData* cached_data) {
+  DisallowHeapAllocation no_gc;
+  SerializedCodeData scd(cached_data);
+  if (!scd.HasValidLayout()) return;
+  uint32_t c1 = scd.GetHeaderValue(kChecksum1Offset);
+  uint32_t c2 = scd.GetHeaderValue(kChecksum2Offset);
+  if (Checksum(scd.Payload()).Check(c1, c2)) {
+    cached_data->MarkChecksumVerified();
+  }
+}
+
+BackgroundCodeCacheTask::BackgroundCodeCacheTask(const byte* data, int length)
+    : data_(data), length_(length), script_data_(NULL), done_(false) {}
+
+BackgroundCodeCacheTask::~BackgroundCodeCacheTask() { delete script_data_; }
+
+void BackgroundCodeCacheTask::Run() {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+
+  DCHECK_NULL(script_data_);
+  // ScriptData takes care of pointer-aligning the data.
+  script_data_ = new ScriptData(data_, length_);
+  SerializedCodeData::VerifyChecksum(script_data_);
+  done_.SetValue(true);
+}
+
+ScriptData* BackgroundCodeCacheTask::ReleaseScriptData() {
+  // The task may still be running, or not have been started at all.
+  if (!done_.Value()) return NULL;
+  ScriptData* result = script_data_;
+  script_data_ = NULL;
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include "src/atomic-utils.h"
 #include "src/parsing/preparse-data.h"
 #include "src/snapshot/serializer.h"
 
@@ -65,6 +66,11 @@ class SerializedCodeData : public SerializedData {
                                             ScriptData* cached_data,
                                             String* source);
 
+  // Used before consuming, possibly on a background thread. Verifies the
+  // layout and payload checksum of |cached_data| without touching the heap,
+  // and marks the data as verified if both are valid.
+  static void VerifyChecksum(ScriptData* cached_data);
+
   // Used when producing.
   SerializedCodeData(const List<byte>& payload, const CodeSerializer& cs);
 
@@ -89,7 +95,11 @@ class SerializedCodeData : public SerializedData {
     CHECKSUM_MISMATCH = 6
   };
 
-  SanityCheckResult SanityCheck(Isolate* isolate, String* source) const;
+  SanityCheckResult SanityCheck(Isolate* isolate, String* source,
+                                bool checksum_verified) const;
+
+  // Whether the header counts and payload length add up to the data size.
+  bool HasValidLayout() const;
 
   uint32_t SourceHash(String* source) const;
 
@@ -119,6 +129,30 @@ class SerializedCodeData : public SerializedData {
   static const int kHeaderSize = kChecksum2Offset + kInt32Size;
 };
 
+// Implementation of v8::ScriptCompiler::ConsumeCodeCacheTask. Does the part of
+// consuming code cache data that does not need the heap, so that only the
+// deserialization itself is left to the main thread.
+class BackgroundCodeCacheTask : public ScriptCompiler::ConsumeCodeCacheTask {
+ public:
+  BackgroundCodeCacheTask(const byte* data, int length);
+  ~BackgroundCodeCacheTask() override;
+
+  void Run() override;
+
+  // Returns the prepared data and relinquishes ownership over it to the
+  // caller, or returns NULL if Run() has not returned yet.
+  ScriptData* ReleaseScriptData();
+
+ private:
+  const byte* data_;  // Not owned.
+  int length_;
+  ScriptData* script_data_;
+  // Set by Run() once script_data_ has been prepared.
+  AtomicValue<bool> done_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundCodeCacheTask);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -0,0 +1,183 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/shared-code-cache.h"
+
+#include "src/base/lazy-instance.h"
+#include "src/debug/debug.h"
+#include "src/objects-inl.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+base::LazyInstance<SharedCodeCache>::type shared_code_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+SharedCodeCache::Entry::Entry(uint64_t hash, Vector<const byte> source,
+                              bool is_one_byte, ScriptData* data)
+    : hash(hash),
+      source(Vector<byte>::New(source.length())),
+      is_one_byte(is_one_byte),
+      data(data),
+      prev(NULL),
+      next(NULL) {
+  CopyBytes(this->source.start(), source.start(), source.length());
+}
+
+SharedCodeCache::Entry::~Entry() {
+  source.Dispose();
+  delete data;
+}
+
+size_t SharedCodeCache::Entry::size() const {
+  return sizeof(*this) + source.length() + data->length();
+}
+
+bool SharedCodeCache::Entry::Matches(Vector<const byte> other_source,
+                                     bool other_is_one_byte) const {
+  return is_one_byte == other_is_one_byte &&
+         source.length() == other_source.length() &&
+         memcmp(source.start(), other_source.start(), source.length()) == 0;
+}
+
+SharedCodeCache::SharedCodeCache()
+    : most_recently_used_(NULL), least_recently_used_(NULL), size_(0) {}
+
+SharedCodeCache::~SharedCodeCache() { Clear(); }
+
+SharedCodeCache* SharedCodeCache::Get() { return shared_code_cache.Pointer(); }
+
+bool SharedCodeCache::IsEligible(Isolate* isolate, Handle<String> source) {
+  return FLAG_shared_code_cache && FLAG_serialize_toplevel &&
+         source->length() >= FLAG_shared_code_cache_min_source_size &&
+         !isolate->debug()->is_loaded();
+}
+
+MaybeHandle<SharedFunctionInfo> SharedCodeCache::Lookup(Isolate* isolate,
+                                                        Handle<String> source) {
+  source = String::Flatten(source);
+  ScriptData* cached_data;
+  {
+    DisallowHeapAllocation no_gc;
+    bool is_one_byte;
+    Vector<const byte> bytes = SourceBytes(*source, &is_one_byte);
+    uint64_t hash = Hash(bytes, is_one_byte);
+
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    EntryMap::iterator it = entries_.find(hash);
+    if (it == entries_.end() || !it->second->Matches(bytes, is_one_byte)) {
+      return MaybeHandle<SharedFunctionInfo>();
+    }
+    Entry* entry = it->second;
+    Unlink(entry);
+    Link(entry);
+
+    // Deserialize from a copy, as other threads may evict the entry.
+    int length = entry->data->length();
+    byte* copy = NewArray<byte>(length);
+    CopyBytes(copy, entry->data->data(), length);
+    cached_data = new ScriptData(copy, length);
+    cached_data->AcquireDataOwnership();
+  }
+
+  // A rejected entry, e.g. after a flag change, is replaced once the script
+  // has been compiled again.
+  MaybeHandle<SharedFunctionInfo> result =
+      CodeSerializer::Deserialize(isolate, cached_data, source);
+  delete cached_data;
+  return result;
+}
+
+void SharedCodeCache::Put(Isolate* isolate, Handle<String> source,
+                          Handle<SharedFunctionInfo> info) {
+  source = String::Flatten(source);
+  ScriptData* data = CodeSerializer::Serialize(isolate, info, source);
+
+  DisallowHeapAllocation no_gc;
+  bool is_one_byte;
+  Vector<const byte> bytes = SourceBytes(*source, &is_one_byte);
+  Entry* entry = new Entry(Hash(bytes, is_one_byte), bytes, is_one_byte, data);
+  size_t max_size = static_cast<size_t>(FLAG_shared_code_cache_max_size) * MB;
+  if (entry->size() > max_size) {
+    delete entry;
+    return;
+  }
+
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  EntryMap::iterator it = entries_.find(entry->hash);
+  if (it != entries_.end()) Remove(it->second);
+  entries_.insert(std::make_pair(entry->hash, entry));
+  Link(entry);
+  size_ += entry->size();
+  while (size_ > max_size) Remove(least_recently_used_);
+}
+
+void SharedCodeCache::Clear() {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  while (least_recently_used_ != NULL) Remove(least_recently_used_);
+  DCHECK(entries_.empty());
+  DCHECK_EQ(0u, size_);
+}
+
+size_t SharedCodeCache::size() {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  return size_;
+}
+
+Vector<const byte> SharedCodeCache::SourceBytes(String* source,
+                                                bool* is_one_byte) {
+  String::FlatContent content = source->GetFlatContent();
+  DCHECK(content.IsFlat());
+  *is_one_byte = content.IsOneByte();
+  if (content.IsOneByte()) return content.ToOneByteVector();
+  return Vector<const byte>::cast(content.ToUC16Vector());
+}
+
+uint64_t SharedCodeCache::Hash(Vector<const byte> source, bool is_one_byte) {
+  // 64-bit FNV-1a. Collisions only cost a cache miss, as entries compare the
+  // whole source.
+  uint64_t hash = V8_UINT64_C(0xCBF29CE484222325) ^ (is_one_byte ? 1 : 0);
+  for (int i = 0; i < source.length(); i++) {
+    hash ^= source[i];
+    hash *= V8_UINT64_C(0x100000001B3);
+  }
+  return hash;
+}
+
+void SharedCodeCache::Link(Entry* entry) {
+  entry->prev = NULL;
+  entry->next = most_recently_used_;
+  if (most_recently_used_ != NULL) most_recently_used_->prev = entry;
+  most_recently_used_ = entry;
+  if (least_recently_used_ == NULL) least_recently_used_ = entry;
+}
+
+void SharedCodeCache::Unlink(Entry* entry) {
+  if (entry->prev != NULL) {
+    entry->prev->next = entry->next;
+  } else {
+    most_recently_used_ = entry->next;
+  }
+  if (entry->next != NULL) {
+    entry->next->prev = entry->prev;
+  } else {
+    least_recently_used_ = entry->prev;
+  }
+  entry->prev = entry->next = NULL;
+}
+
+void SharedCodeCache::Remove(Entry* entry) {
+  Unlink(entry);
+  entries_.erase(entry->hash);
+  size_ -= entry->size();
+  delete entry;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,96 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_SHARED_CODE_CACHE_H_
+#define V8_SNAPSHOT_SHARED_CODE_CACHE_H_
+
+#include <map>
+
+#include "src/base/platform/mutex.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class ScriptData;
+class SharedFunctionInfo;
+class String;
+
+// A process-wide cache of the code of top-level scripts, shared by all
+// isolates. Scripts are keyed by a hash of their source and stored as code
+// cache data (see CodeSerializer), from which any isolate can deserialize the
+// script's SharedFunctionInfo. The source is kept as well so that a hash
+// collision cannot hand out the code of another script. The least recently
+// used scripts are evicted once the cache exceeds
+// --shared-code-cache-max-size.
+class SharedCodeCache {
+ public:
+  SharedCodeCache();
+  ~SharedCodeCache();
+
+  // Returns the cache of the process.
+  static SharedCodeCache* Get();
+
+  // Returns true if the code of |source| may be shared between isolates.
+  static bool IsEligible(Isolate* isolate, Handle<String> source);
+
+  // Deserializes the code cached for |source| into |isolate|. The returned
+  // function's script still has the origin it was compiled with.
+  MaybeHandle<SharedFunctionInfo> Lookup(Isolate* isolate,
+                                         Handle<String> source);
+
+  // Serializes |info|, which has been compiled for |source| in |isolate|, and
+  // caches it for other isolates.
+  void Put(Isolate* isolate, Handle<String> source,
+           Handle<SharedFunctionInfo> info);
+
+  void Clear();
+
+  // The number of bytes held by the cache.
+  size_t size();
+
+ private:
+  // A cached script. Entries form a list from the most to the least recently
+  // used one.
+  struct Entry : public Malloced {
+    Entry(uint64_t hash, Vector<const byte> source, bool is_one_byte,
+          ScriptData* data);
+    ~Entry();
+
+    size_t size() const;
+    bool Matches(Vector<const byte> source, bool is_one_byte) const;
+
+    uint64_t hash;
+    Vector<byte> source;
+    bool is_one_byte;
+    ScriptData* data;
+    Entry* prev;
+    Entry* next;
+  };
+
+  typedef std::map<uint64_t, Entry*> EntryMap;
+
+  // Returns the raw characters of the flat string |source|. Must be called
+  // with heap allocation disallowed.
+  static Vector<const byte> SourceBytes(String* source, bool* is_one_byte);
+  static uint64_t Hash(Vector<const byte> source, bool is_one_byte);
+
+  void Link(Entry* entry);
+  void Unlink(Entry* entry);
+  void Remove(Entry* entry);
+
+  // Guards the entries, which can be looked up by any isolate.
+  base::Mutex mutex_;
+  EntryMap entries_;
+  Entry* most_recently_used_;
+  Entry* least_recently_used_;
+  size_t size_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedCodeCache);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_SHARED_CODE_CACHE_H_
@@ -9,6 +9,7 @@
 #include "src/char-predicates.h"
 #include "src/unicode.h"
 #include "src/unicode-decoder.h"
+#include "src/vector.h"
 
 namespace v8 {
 namespace internal {
@@ -16,11 +17,35 @@ namespace internal {
 // Caching predicates used by scanners.
 class UnicodeCache {
  public:
-  UnicodeCache() {}
+  UnicodeCache() : literal_buffer_store_count_(0) {}
+  ~UnicodeCache() {
+    for (int i = 0; i < literal_buffer_store_count_; i++) {
+      literal_buffer_stores_[i].Dispose();
+    }
+  }
   typedef unibrow::Utf8Decoder<512> Utf8Decoder;
 
   StaticResource<Utf8Decoder>* utf8_decoder() { return &utf8_decoder_; }
 
+  // Scanners take the backing stores of their literal buffers from here and
+  // return them when they are destroyed, so that parsing many small scripts
+  // doesn't allocate the stores over and over. Returns an empty vector if
+  // there is no store to reuse.
+  Vector<byte> TakeLiteralBufferStore() {
+    if (literal_buffer_store_count_ == 0) return Vector<byte>();
+    return literal_buffer_stores_[--literal_buffer_store_count_];
+  }
+
+  void ReturnLiteralBufferStore(Vector<byte> store) {
+    if (store.is_empty()) return;
+    if (literal_buffer_store_count_ == kMaxLiteralBufferStores ||
+        store.length() > kMaxLiteralBufferStoreSize) {
+      store.Dispose();
+      return;
+    }
+    literal_buffer_stores_[literal_buffer_store_count_++] = store;
+  }
+
   inline bool IsIdentifierStart(unibrow::uchar c);
   inline bool IsIdentifierPart(unibrow::uchar c);
   inline bool IsLineTerminator(unibrow::uchar c);
@@ -38,6 +63,11 @@ class UnicodeCache {
       kIsWhiteSpaceOrLineTerminator;
   StaticResource<Utf8Decoder> utf8_decoder_;
 
+  static const int kMaxLiteralBufferStores = 6;
+  static const int kMaxLiteralBufferStoreSize = 16 * KB;
+  Vector<byte> literal_buffer_stores_[kMaxLiteralBufferStores];
+  int literal_buffer_store_count_;
+
   DISALLOW_COPY_AND_ASSIGN(UnicodeCache);
 };
 
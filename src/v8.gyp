@@ -449,6 +449,8 @@
         'background-parsing-task.h',
         'bailout-reason.cc',
         'bailout-reason.h',
+        'baseline/baseline-compiler.cc',
+        'baseline/baseline-compiler.h',
         'basic-block-profiler.cc',
         'basic-block-profiler.h',
         'bignum-dtoa.cc',
@@ -491,12 +493,16 @@
         'compiler/access-info.h',
         'compiler/all-nodes.cc',
         'compiler/all-nodes.h',
+        'compiler/allocation-folding.cc',
+        'compiler/allocation-folding.h',
         'compiler/ast-graph-builder.cc',
         'compiler/ast-graph-builder.h',
         'compiler/ast-loop-assignment-analyzer.cc',
         'compiler/ast-loop-assignment-analyzer.h',
         'compiler/basic-block-instrumentor.cc',
         'compiler/basic-block-instrumentor.h',
+        'compiler/bounds-check-elimination.cc',
+        'compiler/bounds-check-elimination.h',
         'compiler/branch-elimination.cc',
         'compiler/branch-elimination.h',
         'compiler/bytecode-branch-analysis.cc',
@@ -513,6 +519,8 @@
         'compiler/code-generator.h',
         'compiler/code-assembler.cc',
         'compiler/code-assembler.h',
+        'compiler/coloring-allocator.cc',
+        'compiler/coloring-allocator.h',
         'compiler/common-node-cache.cc',
         'compiler/common-node-cache.h',
         'compiler/common-operator-reducer.cc',
@@ -604,8 +612,12 @@
         'compiler/load-elimination.h',
         'compiler/loop-analysis.cc',
         'compiler/loop-analysis.h',
+        'compiler/loop-invariant-code-motion.cc',
+        'compiler/loop-invariant-code-motion.h',
         'compiler/loop-peeling.cc',
         'compiler/loop-peeling.h',
+        'compiler/loop-vectorizer.cc',
+        'compiler/loop-vectorizer.h',
         'compiler/machine-operator-reducer.cc',
         'compiler/machine-operator-reducer.h',
         'compiler/machine-operator.cc',
@@ -894,6 +906,14 @@
         'interpreter/bytecode-array-builder.h',
         'interpreter/bytecode-array-iterator.cc',
         'interpreter/bytecode-array-iterator.h',
+        'interpreter/bytecode-array-writer.cc',
+        'interpreter/bytecode-array-writer.h',
+        'interpreter/bytecode-peephole-optimizer.cc',
+        'interpreter/bytecode-peephole-optimizer.h',
+        'interpreter/bytecode-pipeline.cc',
+        'interpreter/bytecode-pipeline.h',
+        'interpreter/bytecode-register-optimizer.cc',
+        'interpreter/bytecode-register-optimizer.h',
         'interpreter/bytecode-register-allocator.cc',
         'interpreter/bytecode-register-allocator.h',
         'interpreter/bytecode-generator.cc',
@@ -951,9 +971,15 @@
         'optimizing-compile-dispatcher.h',
         'ostreams.cc',
         'ostreams.h',
+        'parsing/character-runs.cc',
+        'parsing/character-runs.h',
         'parsing/expression-classifier.h',
         'parsing/func-name-inferrer.cc',
         'parsing/func-name-inferrer.h',
+        'parsing/keyword-table.cc',
+        'parsing/keyword-table.h',
+        'parsing/parallel-preparser.cc',
+        'parsing/parallel-preparser.h',
         'parsing/parameter-initializer-rewriter.cc',
         'parsing/parameter-initializer-rewriter.h',
         'parsing/parser-base.h',
@@ -1079,6 +1105,8 @@
         'snapshot/serializer.h',
         'snapshot/serializer-common.cc',
         'snapshot/serializer-common.h',
+        'snapshot/shared-code-cache.cc',
+        'snapshot/shared-code-cache.h',
         'snapshot/snapshot.h',
         'snapshot/snapshot-common.cc',
         'snapshot/snapshot-source-sink.cc',
@@ -1464,6 +1492,7 @@
             'x64/interface-descriptors-x64.cc',
             'x64/macro-assembler-x64.cc',
             'x64/macro-assembler-x64.h',
+            'baseline/x64/baseline-compiler-x64.cc',
             'debug/x64/debug-x64.cc',
             'full-codegen/x64/full-codegen-x64.cc',
             'ic/x64/access-compiler-x64.cc',
@@ -1063,6 +1063,9 @@ class Assembler : public AssemblerBase {
   void divps(XMMRegister dst, XMMRegister src);
   void divps(XMMRegister dst, const Operand& src);
 
+  void movups(XMMRegister dst, const Operand& src);
+  void movups(const Operand& dst, XMMRegister src);
+
   void movmskps(Register dst, XMMRegister src);
 
   // SSE2 instructions
@@ -1090,6 +1093,13 @@ class Assembler : public AssemblerBase {
 
   void movapd(XMMRegister dst, XMMRegister src);
 
+  void addpd(XMMRegister dst, XMMRegister src);
+  void subpd(XMMRegister dst, XMMRegister src);
+  void mulpd(XMMRegister dst, XMMRegister src);
+  void divpd(XMMRegister dst, XMMRegister src);
+  void paddd(XMMRegister dst, XMMRegister src);
+  void psubd(XMMRegister dst, XMMRegister src);
+
   void psllq(XMMRegister reg, byte imm8);
   void psrlq(XMMRegister reg, byte imm8);
   void pslld(XMMRegister reg, byte imm8);
@@ -1367,6 +1377,33 @@ class Assembler : public AssemblerBase {
 #undef AVX_P_3
 #undef AVX_SP_3
 
+  // Packed arithmetic with an explicit vector length; kL256 operates on the
+  // ymm registers aliasing the given xmm registers.
+#define AVX_P_3_L(instr, opcode)                                         \
+  void instr##ps(XMMRegister dst, XMMRegister src1, const Operand& src2, \
+                 VectorLength l) {                                       \
+    vps(opcode, dst, src1, src2, l);                                     \
+  }                                                                      \
+  void instr##pd(XMMRegister dst, XMMRegister src1, const Operand& src2, \
+                 VectorLength l) {                                       \
+    vpd(opcode, dst, src1, src2, l);                                     \
+  }
+
+  AVX_P_3_L(vadd, 0x58);
+  AVX_P_3_L(vsub, 0x5c);
+  AVX_P_3_L(vmul, 0x59);
+  AVX_P_3_L(vdiv, 0x5e);
+
+#undef AVX_P_3_L
+
+  void vmovups(XMMRegister dst, const Operand& src, VectorLength l = kL128) {
+    vps(0x10, dst, xmm0, src, l);
+  }
+  void vmovups(const Operand& dst, XMMRegister src, VectorLength l = kL128) {
+    vps(0x11, src, xmm0, dst, l);
+  }
+  void vzeroupper();
+
   void vpsrlq(XMMRegister dst, XMMRegister src, byte imm8) {
     XMMRegister iop = {2};
     vpd(0x73, iop, dst, src);
@@ -1497,9 +1534,11 @@ class Assembler : public AssemblerBase {
   }
 
   void vps(byte op, XMMRegister dst, XMMRegister src1, XMMRegister src2);
-  void vps(byte op, XMMRegister dst, XMMRegister src1, const Operand& src2);
+  void vps(byte op, XMMRegister dst, XMMRegister src1, const Operand& src2,
+           VectorLength l = kL128);
   void vpd(byte op, XMMRegister dst, XMMRegister src1, XMMRegister src2);
-  void vpd(byte op, XMMRegister dst, XMMRegister src1, const Operand& src2);
+  void vpd(byte op, XMMRegister dst, XMMRegister src1, const Operand& src2,
+           VectorLength l = kL128);
 
   // BMI instruction
   void andnq(Register dst, Register src1, Register src2) {
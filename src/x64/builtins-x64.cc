@@ -649,6 +649,11 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ Assert(equal, kFunctionDataShouldBeBytecodeArrayOnInterpreterEntry);
   }
 
+  // Reset code age.
+  __ movb(FieldOperand(kInterpreterBytecodeArrayRegister,
+                       BytecodeArray::kBytecodeAgeOffset),
+          Immediate(BytecodeArray::kNoAgeBytecodeAge));
+
   // Push bytecode array.
   __ Push(kInterpreterBytecodeArrayRegister);
   // Push zero for bytecode array offset.
@@ -690,6 +695,21 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   __ addp(r11, Immediate(InterpreterFrameConstants::kRegisterFileFromFp));
   __ movp(kInterpreterBytecodeOffsetRegister,
           Immediate(BytecodeArray::kHeaderSize - kHeapObjectTag));
+
+  // Run the baseline code if the function is hot enough to have some.
+  Label run_baseline_code;
+  __ movp(rbx, FieldOperand(kInterpreterBytecodeArrayRegister,
+                            BytecodeArray::kBaselineCodeOffset));
+  __ CompareRoot(rbx, Heap::kUndefinedValueRootIndex);
+  __ j(not_equal, &run_baseline_code);
+
+  // Dispatch through the threaded code if the function is hot enough to have
+  // some.
+  Label threaded_dispatch;
+  __ movp(rbx, FieldOperand(kInterpreterBytecodeArrayRegister,
+                            BytecodeArray::kThreadedCodeOffset));
+  __ CompareRoot(rbx, Heap::kUndefinedValueRootIndex);
+  __ j(not_equal, &threaded_dispatch);
   __ Move(
       kInterpreterDispatchTableRegister,
       ExternalReference::interpreter_dispatch_table_address(masm->isolate()));
@@ -704,6 +724,24 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   // Even though the first bytecode handler was called, we will never return.
   __ Abort(kUnexpectedReturnFromBytecodeHandler);
 
+  // The threaded code holds the handler for each bytecode offset. The dispatch
+  // table register points into it such that it is indexed by bytecode offset.
+  __ bind(&threaded_dispatch);
+  __ leap(kInterpreterDispatchTableRegister,
+          Operand(rbx, BytecodeArray::kThreadedDispatchTableBias));
+  __ movp(rbx, Operand(kInterpreterDispatchTableRegister,
+                       kInterpreterBytecodeOffsetRegister, times_pointer_size,
+                       0));
+  __ leap(rbx, FieldOperand(rbx, Code::kHeaderSize));
+  __ call(rbx);
+  __ Abort(kUnexpectedReturnFromBytecodeHandler);
+
+  // The baseline code runs on the frame built above. Jump rather than call
+  // into it, so that its return addresses identify the frame as interpreted.
+  __ bind(&run_baseline_code);
+  __ leap(rbx, FieldOperand(rbx, Code::kHeaderSize));
+  __ jmp(rbx);
+
   // Load debug copy of the bytecode array.
   __ bind(&load_debug_bytecode_array);
   Register debug_info = kInterpreterBytecodeArrayRegister;
@@ -784,6 +822,62 @@ void Builtins::Generate_InterpreterPushArgsAndCallImpl(
   //  -- rdi : the target to call (can be any Object).
   // -----------------------------------
 
+  if (tail_call_mode == TailCallMode::kDisallow) {
+    // Calls from interpreted code mostly target other interpreted functions.
+    // If the callee needs neither receiver conversion nor argument adaption,
+    // enter the interpreter directly instead of dispatching through the Call
+    // builtin. The checks only read the caller's registers, so that the
+    // arguments are copied once, after the path has been chosen.
+    Label call_generic, receiver_ok;
+    __ JumpIfSmi(rdi, &call_generic);
+    __ CmpObjectType(rdi, JS_FUNCTION_TYPE, rcx);
+    __ j(not_equal, &call_generic);
+    __ Move(rcx, masm->isolate()->builtins()->InterpreterEntryTrampoline());
+    __ leap(rcx, FieldOperand(rcx, Code::kHeaderSize));
+    __ cmpp(rcx, FieldOperand(rdi, JSFunction::kCodeEntryOffset));
+    __ j(not_equal, &call_generic);
+    __ movp(rdx, FieldOperand(rdi, JSFunction::kSharedFunctionInfoOffset));
+    __ testb(FieldOperand(rdx, SharedFunctionInfo::kFunctionKindByteOffset),
+             Immediate(SharedFunctionInfo::kClassConstructorBitsWithinByte));
+    __ j(not_zero, &call_generic);
+    __ LoadSharedFunctionInfoSpecialField(
+        rcx, rdx, SharedFunctionInfo::kFormalParameterCountOffset);
+    __ cmpp(rax, rcx);
+    __ j(not_equal, &call_generic);
+    STATIC_ASSERT(SharedFunctionInfo::kNativeByteOffset ==
+                  SharedFunctionInfo::kStrictModeByteOffset);
+    __ testb(FieldOperand(rdx, SharedFunctionInfo::kNativeByteOffset),
+             Immediate((1 << SharedFunctionInfo::kNativeBitWithinByte) |
+                       (1 << SharedFunctionInfo::kStrictModeBitWithinByte)));
+    __ j(not_zero, &receiver_ok, Label::kNear);
+    // The receiver is the first of the registers to be pushed.
+    __ movp(rcx, Operand(rbx, 0));
+    __ JumpIfSmi(rcx, &call_generic);
+    STATIC_ASSERT(LAST_JS_RECEIVER_TYPE == LAST_TYPE);
+    __ CmpObjectType(rcx, FIRST_JS_RECEIVER_TYPE, rcx);
+    __ j(below, &call_generic);
+    __ bind(&receiver_ok);
+
+    // Leave stepping into the callee to the generic path.
+    ExternalReference step_in_enabled =
+        ExternalReference::debug_step_in_enabled_address(masm->isolate());
+    __ cmpb(__ ExternalOperand(step_in_enabled), Immediate(0));
+    __ j(not_equal, &call_generic);
+
+    // The callee addresses its parameters relative to its own frame, and the
+    // interpreter exit trampoline drops them, so they have to be copied.
+    __ PopReturnAddressTo(kScratchRegister);
+    Generate_InterpreterPushArgs(masm, true);
+    __ PushReturnAddressFrom(kScratchRegister);
+    __ IncrementCounter(masm->isolate()->counters()->interpreter_direct_calls(),
+                        1);
+    __ movp(rsi, FieldOperand(rdi, JSFunction::kContextOffset));
+    __ LoadRoot(rdx, Heap::kUndefinedValueRootIndex);
+    __ jmp(FieldOperand(rdi, JSFunction::kCodeEntryOffset));
+
+    __ bind(&call_generic);
+  }
+
   // Pop return address to allow tail-call after pushing arguments.
   __ PopReturnAddressTo(kScratchRegister);
 
@@ -2931,9 +3025,15 @@ void Builtins::Generate_HandleFastApiCall(MacroAssembler* masm) {
 }
 
 
-void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
+static void Generate_OnStackReplacementHelper(MacroAssembler* masm,
+                                              bool has_handler_frame) {
   // Lookup the function in the JavaScript frame.
-  __ movp(rax, Operand(rbp, JavaScriptFrameConstants::kFunctionOffset));
+  if (has_handler_frame) {
+    __ movp(rax, Operand(rbp, StandardFrameConstants::kCallerFPOffset));
+    __ movp(rax, Operand(rax, JavaScriptFrameConstants::kFunctionOffset));
+  } else {
+    __ movp(rax, Operand(rbp, JavaScriptFrameConstants::kFunctionOffset));
+  }
   {
     FrameScope scope(masm, StackFrame::INTERNAL);
     // Pass function as argument.
@@ -2949,6 +3049,12 @@ void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
 
   __ bind(&skip);
 
+  // Drop the handler frame that is sitting on top of the actual JavaScript
+  // frame. This is the case when OSR is triggered from bytecode.
+  if (has_handler_frame) {
+    __ leave();
+  }
+
   // Load deoptimization data from the code object.
   __ movp(rbx, Operand(rax, Code::kDeoptimizationDataOffset - kHeapObjectTag));
 
@@ -2966,6 +3072,14 @@ void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
   __ ret(0);
 }
 
+void Builtins::Generate_OnStackReplacement(MacroAssembler* masm) {
+  Generate_OnStackReplacementHelper(masm, false);
+}
+
+void Builtins::Generate_InterpreterOnStackReplacement(MacroAssembler* masm) {
+  Generate_OnStackReplacementHelper(masm, true);
+}
+
 
 #undef __
 
@@ -45,8 +45,8 @@ const size_t kASanRedzoneBytes = 0;
 // Segments represent chunks of memory: They have starting address
 // (encoded in the this pointer) and a size in bytes. Segments are
 // chained together forming a LIFO structure with the newest segment
-// available as segment_head_. Segments are allocated using malloc()
-// and de-allocated using free().
+// available as segment_head_. Segments are allocated and de-allocated
+// through the zone's AccountingAllocator, which may recycle them.
 
 class Segment {
  public:
@@ -203,7 +203,8 @@ void Zone::DeleteKeptSegment() {
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(size_t size) {
-  Segment* result = reinterpret_cast<Segment*>(allocator_->Allocate(size));
+  Segment* result =
+      reinterpret_cast<Segment*>(allocator_->AllocateSegment(size));
   segment_bytes_allocated_ += size;
   if (result != nullptr) {
     result->Initialize(segment_head_, size);
@@ -216,7 +217,9 @@ Segment* Zone::NewSegment(size_t size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, size_t size) {
   segment_bytes_allocated_ -= size;
-  allocator_->Free(segment, size);
+  // The segment may be handed to another zone by the allocator.
+  ASAN_UNPOISON_MEMORY_REGION(segment, size);
+  allocator_->FreeSegment(segment, size);
 }
 
 
@@ -253,6 +256,10 @@ Address Zone::NewExpand(size_t size) {
     // requested size.
     new_size = Max(min_new_size, kMaximumSegmentSize);
   }
+  if (allocator_->segment_pool_enabled()) {
+    // Use the sizes the allocator recycles.
+    new_size = base::AccountingAllocator::RoundUpToPooledSize(new_size);
+  }
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory("Zone");
     return nullptr;
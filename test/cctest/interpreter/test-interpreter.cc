@@ -776,6 +776,35 @@ TEST(InterpreterStoreKeyedProperty) {
   CHECK_EQ(Smi::cast(*result), Smi::FromInt(999));
 }
 
+TEST(InterpreterMonomorphicPropertyAccess) {
+  HandleAndZoneScope handles;
+  i::Isolate* isolate = handles.main_isolate();
+  i::Factory* factory = isolate->factory();
+
+  // Loops make the property accesses monomorphic before the receivers
+  // change map or turn out to be Smis.
+  std::pair<const char*, Handle<Object>> tests[] = {
+      {"var o = { x : 1 }; var p = { y : 2, x : 3 }; var s = 0;"
+       "for (var i = 0; i < 10; i++) { s += o.x; o.x = i; }"
+       "s += p.x; p.x = 4; return s + p.x + (1).valueOf();",
+       factory->NewNumberFromInt(45)},
+      {"var a = [1, 2, 3]; var b = ['a', 'b']; var s = 0;"
+       "for (var i = 0; i < 10; i++) { s += a[i % 3]; a[i % 3] = 1; }"
+       "b[0] = 7; return s + b[0] + a[2];",
+       factory->NewNumberFromInt(21)},
+  };
+
+  for (size_t i = 0; i < arraysize(tests); i++) {
+    std::string source(InterpreterTester::SourceForBody(tests[i].first));
+    InterpreterTester tester(handles.main_isolate(), source.c_str());
+    auto callable = tester.GetCallable<>();
+
+    Handle<i::Object> return_value = callable().ToHandleChecked();
+    CHECK(return_value->SameValue(*tests[i].second));
+  }
+}
+
+
 static void TestInterpreterCall(TailCallMode tail_call_mode) {
   HandleAndZoneScope handles;
   i::Isolate* isolate = handles.main_isolate();
@@ -4171,6 +4200,79 @@ TEST(InterpreterGenerators) {
   FLAG_ignition_generators = old_flag;
 }
 
+TEST(InterpreterRegisterLoads) {
+  bool old_flag = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = true;
+  HandleAndZoneScope handles;
+  i::Isolate* isolate = handles.main_isolate();
+  i::Factory* factory = isolate->factory();
+
+  std::pair<const char*, Handle<Object>> tests[] = {
+      {"var o = { a : 7 }; var b = o.a; return b + o.a;",
+       factory->NewNumberFromInt(14)},
+      {"var o = [1, 2, 3]; var k = 2; var v = o[k]; return v + o[0];",
+       factory->NewNumberFromInt(4)},
+      {"var x; var y = x; return typeof y;",
+       factory->NewStringFromStaticChars("undefined")},
+      {"var a = 5; function g() { var b = a; var c = a; return b * c; }"
+       "return g();",
+       factory->NewNumberFromInt(25)},
+      {"var r = Math; var m = r.max(3, 4); return m;",
+       factory->NewNumberFromInt(4)},
+      {"var o = { a : { b : 3 } }; var c = o.a.b; var d = o.a; return c + d.b;",
+       factory->NewNumberFromInt(6)},
+  };
+
+  for (size_t i = 0; i < arraysize(tests); i++) {
+    std::string source(InterpreterTester::SourceForBody(tests[i].first));
+    InterpreterTester tester(handles.main_isolate(), source.c_str());
+    auto callable = tester.GetCallable<>();
+
+    Handle<i::Object> return_value = callable().ToHandleChecked();
+    CHECK(return_value->SameValue(*tests[i].second));
+  }
+
+  FLAG_ignition_superinstructions = old_flag;
+}
+
+TEST(InterpreterRegisterOptimizer) {
+  bool old_flag = FLAG_ignition_reo;
+  FLAG_ignition_reo = true;
+  HandleAndZoneScope handles;
+  i::Isolate* isolate = handles.main_isolate();
+  i::Factory* factory = isolate->factory();
+
+  std::pair<const char*, Handle<Object>> tests[] = {
+      {"var a = 1; var b = a; var c = b; return c;",
+       factory->NewNumberFromInt(1)},
+      {"var a = 1; var b = a; a = 2; return a + b;",
+       factory->NewNumberFromInt(3)},
+      {"var a = 3; var b = a; var c = b; b = 5; return a * b + c;",
+       factory->NewNumberFromInt(18)},
+      {"var a = 1; var b = a; if (b) { a = 7; } return a + b;",
+       factory->NewNumberFromInt(8)},
+      {"var s = 0; for (var i = 0; i < 4; i++) { var t = i; s += t; }"
+       "return s;",
+       factory->NewNumberFromInt(6)},
+      {"var o = { x : 4 }; var p = o; var q = p; return q.x + p.x;",
+       factory->NewNumberFromInt(8)},
+      {"var a = 2; function g(x, y) { return x - y; } var b = a;"
+       "return g(b, a + 1);",
+       factory->NewNumberFromInt(-1)},
+  };
+
+  for (size_t i = 0; i < arraysize(tests); i++) {
+    std::string source(InterpreterTester::SourceForBody(tests[i].first));
+    InterpreterTester tester(handles.main_isolate(), source.c_str());
+    auto callable = tester.GetCallable<>();
+
+    Handle<i::Object> return_value = callable().ToHandleChecked();
+    CHECK(return_value->SameValue(*tests[i].second));
+  }
+
+  FLAG_ignition_reo = old_flag;
+}
+
 
 }  // namespace interpreter
 }  // namespace internal
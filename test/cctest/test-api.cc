@@ -39,6 +39,7 @@
 #include "include/v8-util.h"
 #include "src/api.h"
 #include "src/arguments.h"
+#include "src/background-parsing-task.h"
 #include "src/base/platform/platform.h"
 #include "src/base/smart-pointers.h"
 #include "src/compilation-cache.h"
@@ -23942,6 +23943,96 @@ TEST(StreamingWithHarmonyScopes) {
 }
 
 
+TEST(StreamingWithBackgroundAnalysis) {
+  i::FLAG_streaming_analysis = true;
+  // The completion value, closures, 'arguments' and sloppy eval all depend on
+  // the rewriting and scope analysis done on the background thread.
+  const char* chunks[] = {
+      "var result = (function(a, b) {\n"
+      "  var c = 3;\n"
+      "  function inner() { return a + c; }\n"
+      "  return inner() + arguments[1];\n"
+      "})(1, 2);\n",
+      "(function() {\n"
+      "  var d = 7;\n"
+      "  result += eval('d');\n"
+      "})();\n"
+      "if (result == 13) { result; } else { -1; }",
+      NULL};
+  RunStreamingTest(chunks);
+
+  const char* error_chunks[] = {"(function() { retu", "rn 13 })(", NULL};
+  RunStreamingTest(error_chunks, v8::ScriptCompiler::StreamedSource::ONE_BYTE,
+                   false);
+
+  // Check that the scopes were in fact analyzed by the streaming task.
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  task->Run();
+  delete task;
+  CHECK_NOT_NULL(source.impl()->info->literal());
+  CHECK_NOT_NULL(source.impl()->info->scope());
+
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  v8::ScriptOrigin(v8_str("http://foo.com")))
+          .ToLocalChecked();
+  CHECK_EQ(13, script->Run(env.local())
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  delete[] full_source;
+}
+
+
+TEST(StreamingBackgroundAnalysisStackOverflow) {
+  // A stack overflow in the rewriter on the background thread must surface as
+  // a RangeError when the script is compiled.
+  i::FLAG_streaming_analysis = false;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  const char* chunks[] = {"var result = 13; ", "result;", NULL};
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  task->Run();
+  delete task;
+
+  // Redo the analysis as the task would have, with a stack limit that every
+  // stack check fails.
+  i::StreamedSource* impl = source.impl();
+  CHECK_NOT_NULL(impl->info->literal());
+  CHECK_NULL(impl->info->scope());
+  impl->parser->set_stack_limit(std::numeric_limits<uintptr_t>::max());
+  impl->parser->AnalyzeOnBackground(impl->info.get());
+  CHECK_NULL(impl->info->literal());
+  CHECK(!try_catch.HasCaught());
+
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::MaybeLocal<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  v8::ScriptOrigin(v8_str("http://foo.com")));
+  CHECK(script.IsEmpty());
+  CHECK(try_catch.HasCaught());
+  CHECK(try_catch.Exception()->IsNativeError());
+  v8::String::Utf8Value message(try_catch.Message()->Get());
+  CHECK_NOT_NULL(strstr(*message, "RangeError"));
+  delete[] full_source;
+}
+
+
 TEST(CodeCache) {
   v8::Isolate::CreateParams create_params;
   create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
@@ -24996,3 +25087,67 @@ TEST(PrivateForApiIsNumber) {
   // Shouldn't crash.
   v8::Private::ForApi(isolate, v8_str("42"));
 }
+
+UNINITIALIZED_TEST(BytecodeHandlerStatistics) {
+  i::FLAG_ignition = true;
+  i::FLAG_ignition_handler_statistics = true;
+  i::FLAG_ignition_handler_sample_interval = 10;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope scope(isolate);
+    LocalContext context(isolate);
+    const char* source =
+        "(function() {"
+        "  var sum = 0;"
+        "  for (var i = 0; i < 1000; i++) sum += i;"
+        "  return sum;"
+        "})();";
+
+    // Nothing is recorded until collection is started.
+    CompileRun(source);
+    v8::BytecodeHandlerStatistics statistics;
+    size_t total_executions = 0;
+    for (size_t i = 0; i < isolate->NumberOfBytecodeHandlers(); i++) {
+      CHECK(isolate->GetBytecodeHandlerStatistics(&statistics, i));
+      CHECK_NOT_NULL(statistics.bytecode_name());
+      total_executions += statistics.execution_count();
+    }
+    CHECK_EQ(0u, total_executions);
+
+    isolate->StartBytecodeHandlerStatistics();
+    CompileRun(source);
+    isolate->StopBytecodeHandlerStatistics();
+    size_t total_samples = 0;
+    for (size_t i = 0; i < isolate->NumberOfBytecodeHandlers(); i++) {
+      CHECK(isolate->GetBytecodeHandlerStatistics(&statistics, i));
+      total_executions += statistics.execution_count();
+      total_samples += statistics.sample_count();
+      CHECK_LE(statistics.sample_count(), statistics.execution_count());
+    }
+    CHECK_LT(1000u, total_executions);
+    CHECK_LT(0u, total_samples);
+
+    // Statistics are kept while stopped, until they are reset.
+    CompileRun(source);
+    size_t stopped_executions = 0;
+    for (size_t i = 0; i < isolate->NumberOfBytecodeHandlers(); i++) {
+      CHECK(isolate->GetBytecodeHandlerStatistics(&statistics, i));
+      stopped_executions += statistics.execution_count();
+    }
+    CHECK_EQ(total_executions, stopped_executions);
+
+    isolate->ResetBytecodeHandlerStatistics();
+    for (size_t i = 0; i < isolate->NumberOfBytecodeHandlers(); i++) {
+      CHECK(isolate->GetBytecodeHandlerStatistics(&statistics, i));
+      CHECK_EQ(0u, statistics.execution_count());
+      CHECK_EQ(0u, statistics.sample_count());
+      CHECK_EQ(0u, statistics.sampled_cycles());
+    }
+    CHECK(!isolate->GetBytecodeHandlerStatistics(
+        &statistics, isolate->NumberOfBytecodeHandlers()));
+  }
+  isolate->Dispose();
+}
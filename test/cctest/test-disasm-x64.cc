@@ -416,6 +416,8 @@ TEST(DisasmX64) {
     __ mulps(xmm1, Operand(rbx, rcx, times_4, 10000));
     __ divps(xmm1, xmm0);
     __ divps(xmm1, Operand(rbx, rcx, times_4, 10000));
+    __ movups(xmm1, Operand(rbx, rcx, times_4, 10000));
+    __ movups(Operand(rbx, rcx, times_4, 10000), xmm1);
 
     __ ucomiss(xmm0, xmm1);
     __ ucomiss(xmm0, Operand(rbx, rcx, times_4, 10000));
@@ -450,6 +452,13 @@ TEST(DisasmX64) {
 
     __ andpd(xmm0, xmm1);
 
+    __ addpd(xmm1, xmm0);
+    __ subpd(xmm1, xmm0);
+    __ mulpd(xmm1, xmm0);
+    __ divpd(xmm1, xmm0);
+    __ paddd(xmm1, xmm9);
+    __ psubd(xmm9, xmm1);
+
     __ pslld(xmm0, 6);
     __ psrld(xmm0, 6);
     __ psllq(xmm0, 6);
@@ -579,6 +588,14 @@ TEST(DisasmX64) {
       __ vpcmpeqd(xmm15, xmm0, Operand(rbx, rcx, times_4, 10000));
       __ vpsllq(xmm0, xmm15, 21);
       __ vpsrlq(xmm15, xmm0, 21);
+
+      __ vmovups(xmm0, Operand(rbx, rcx, times_4, 10000), Assembler::kL256);
+      __ vmovups(Operand(rbx, rcx, times_4, 10000), xmm9, Assembler::kL256);
+      __ vaddps(xmm0, xmm1, Operand(rbx, rcx, times_4, 10000),
+                Assembler::kL256);
+      __ vmulpd(xmm9, xmm1, Operand(rbx, rcx, times_4, 10000),
+                Assembler::kL256);
+      __ vzeroupper();
     }
   }
 
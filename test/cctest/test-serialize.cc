@@ -43,6 +43,7 @@
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/partial-serializer.h"
+#include "src/snapshot/shared-code-cache.h"
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/startup-serializer.h"
 #include "test/cctest/cctest.h"
@@ -1586,6 +1587,159 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+class ConsumeCodeCacheThread : public v8::base::Thread {
+ public:
+  explicit ConsumeCodeCacheThread(
+      v8::ScriptCompiler::ConsumeCodeCacheTask* task)
+      : Thread(Options("ConsumeCodeCacheThread")), task_(task) {}
+
+  void Run() override { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task_;
+};
+
+// Consumes |cache| for |source| with the checks done on a background thread,
+// unless |run_task| is false, and returns whether the cache was accepted.
+bool ConsumeCacheInBackground(const char* source,
+                              v8::ScriptCompiler::CachedData* cache,
+                              bool run_task = true) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  bool accepted;
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::base::SmartPointer<v8::ScriptCompiler::ConsumeCodeCacheTask> task(
+        v8::ScriptCompiler::StartConsumingCodeCache(isolate2, &source));
+    if (run_task) {
+      ConsumeCodeCacheThread thread(task.get());
+      thread.Start();
+      thread.Join();
+    }
+
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    accepted = !cache->rejected;
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  return accepted;
+}
+
+TEST(CodeSerializerConsumeInBackground) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+  CHECK(ConsumeCacheInBackground(source, cache));
+}
+
+TEST(CodeSerializerConsumeInBackgroundBitFlip) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  // Random bit flip, which the background task must not let through.
+  const_cast<uint8_t*>(cache->data)[337] ^= 0x40;
+  CHECK(!ConsumeCacheInBackground(source, cache));
+}
+
+TEST(CodeSerializerConsumeWithoutRunningTask) {
+  FLAG_serialize_toplevel = true;
+
+  // If the task has not been run, the main thread does all the checks.
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+  CHECK(ConsumeCacheInBackground(source, cache, false));
+
+  v8::ScriptCompiler::CachedData* flipped = ProduceCache(source);
+  const_cast<uint8_t*>(flipped->data)[337] ^= 0x40;
+  CHECK(!ConsumeCacheInBackground(source, flipped, false));
+}
+
+// Compiles and runs |source| as the script |name| in a new isolate.
+void RunWithSharedCodeCache(const char* source, const char* name,
+                            bool expect_cache_hit) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str(name));
+    v8::ScriptCompiler::Source script_source(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script;
+    if (expect_cache_hit) {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate));
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    } else {
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    }
+    // The script has the origin it was compiled with in this isolate.
+    CHECK(script->GetScriptName()->Equals(context, v8_str(name)).FromJust());
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate->Dispose();
+}
+
+TEST(SharedCodeCacheIsolates) {
+  FLAG_shared_code_cache = true;
+  FLAG_shared_code_cache_min_source_size = 0;
+  SharedCodeCache* cache = SharedCodeCache::Get();
+  cache->Clear();
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  RunWithSharedCodeCache(source, "first", false);
+  CHECK_LT(0u, cache->size());
+  RunWithSharedCodeCache(source, "second", true);
+
+  // Scripts with a different source miss the cache.
+  RunWithSharedCodeCache("function g() { return 'abc'; }; g() + 'def'",
+                         "third", false);
+  cache->Clear();
+  CHECK_EQ(0u, cache->size());
+}
+
+TEST(SharedCodeCacheMaxSize) {
+  FLAG_shared_code_cache = true;
+  FLAG_shared_code_cache_min_source_size = 0;
+  FLAG_shared_code_cache_max_size = 0;
+  SharedCodeCache* cache = SharedCodeCache::Get();
+  cache->Clear();
+
+  // Scripts that do not fit into the cache are not kept.
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  RunWithSharedCodeCache(source, "first", false);
+  CHECK_EQ(0u, cache->size());
+  RunWithSharedCodeCache(source, "second", false);
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   FLAG_serialize_toplevel = true;
 
@@ -0,0 +1,71 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the overhead of calling small interpreted functions from
+// interpreted code.
+
+new BenchmarkSuite('Call', [1000], [
+  new Benchmark('Call-Small', false, false, 0, CallSmall, Setup, TearDown),
+]);
+
+new BenchmarkSuite('CallMethod', [1000], [
+  new Benchmark('CallMethod-Small', false, false, 0, CallMethodSmall, Setup,
+                TearDown),
+]);
+
+new BenchmarkSuite('CallAdapted', [1000], [
+  new Benchmark('CallAdapted-Small', false, false, 0, CallAdaptedSmall, Setup,
+                TearDown),
+]);
+
+new BenchmarkSuite('CallStrict', [1000], [
+  new Benchmark('CallStrict-Small', false, false, 0, CallStrictSmall, Setup,
+                TearDown),
+]);
+
+var kIterations = 1000;
+var result;
+
+function add(a, b) { return a + b; }
+
+function addStrict(a, b) { 'use strict'; return a + b; }
+
+var object = {
+  add: function(a, b) { return a + b; }
+};
+
+function Setup() {
+  result = 0;
+}
+
+function CallSmall() {
+  for (var i = 0; i < kIterations; i++) {
+    result = add(result, 1);
+  }
+}
+
+function CallMethodSmall() {
+  for (var i = 0; i < kIterations; i++) {
+    result = object.add(result, 1);
+  }
+}
+
+function CallAdaptedSmall() {
+  // Passing more arguments than declared goes through the arguments adaptor.
+  for (var i = 0; i < kIterations; i++) {
+    result = add(result, 1, 2);
+  }
+}
+
+function CallStrictSmall() {
+  for (var i = 0; i < kIterations; i++) {
+    result = addStrict(result, 1);
+  }
+}
+
+function TearDown() {
+  if (result == 0 || result % kIterations != 0) {
+    throw new Error('Unexpected result: ' + result);
+  }
+}
@@ -0,0 +1,75 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures scanning throughput on sources dominated by one kind of token.
+// The functions are only compiled, never run, and their bodies are parsed
+// lazily, so the time is spent in the scanner and preparser.
+
+new BenchmarkSuite('WhiteSpace', [1000], [
+  new Benchmark('WhiteSpace', false, false, 0, WhiteSpace, WhiteSpaceSetup),
+]);
+
+new BenchmarkSuite('Comments', [1000], [
+  new Benchmark('Comments', false, false, 0, Comments, CommentsSetup),
+]);
+
+new BenchmarkSuite('Identifiers', [1000], [
+  new Benchmark('Identifiers', false, false, 0, Identifiers,
+                IdentifiersSetup),
+]);
+
+new BenchmarkSuite('Strings', [1000], [
+  new Benchmark('Strings', false, false, 0, Strings, StringsSetup),
+]);
+
+var kLines = 1000;
+var source;
+var counter = 0;
+
+function Repeat(line) {
+  var lines = [];
+  for (var i = 0; i < kLines; i++) lines.push(line);
+  return lines.join('\n');
+}
+
+// Every run compiles a different source so the compilation cache is not hit.
+function Compile() {
+  return new Function('/* ' + counter++ + ' */ function f() {\n' + source +
+                      '\n}');
+}
+
+function WhiteSpaceSetup() {
+  source = Repeat('                            x;            \t\t\t    ');
+}
+
+function WhiteSpace() {
+  Compile();
+}
+
+function CommentsSetup() {
+  source = Repeat('// A single-line comment with some text in it.\n' +
+                  '/* A multi-line comment\n * spanning two lines. */');
+}
+
+function Comments() {
+  Compile();
+}
+
+function IdentifiersSetup() {
+  source = Repeat('someVeryLongIdentifier_withMoreParts$ = ' +
+                  'AnotherQuiteLongIdentifierName123 + shortName;');
+}
+
+function Identifiers() {
+  Compile();
+}
+
+function StringsSetup() {
+  source = Repeat('x = "a string literal without any escape sequences" + ' +
+                  '\'and another one using single quotes\';');
+}
+
+function Strings() {
+  Compile();
+}
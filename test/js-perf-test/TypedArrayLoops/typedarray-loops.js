@@ -0,0 +1,93 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Float64Multiply', [1000], [
+  new Benchmark('Float64Multiply', false, false, 0,
+                Float64Multiply, Float64Setup, Float64MultiplyTearDown)
+]);
+
+new BenchmarkSuite('Float32Add', [1000], [
+  new Benchmark('Float32Add', false, false, 0,
+                Float32Add, Float32Setup, Float32AddTearDown)
+]);
+
+new BenchmarkSuite('Int32Add', [1000], [
+  new Benchmark('Int32Add', false, false, 0,
+                Int32Add, Int32Setup, Int32AddTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// The arrays are never reassigned, so that optimized code can embed their
+// backing stores as constants.
+var kLength = 4096;
+var f64a = new Float64Array(kLength);
+var f64b = new Float64Array(kLength);
+var f64c = new Float64Array(kLength);
+var f32a = new Float32Array(kLength);
+var f32b = new Float32Array(kLength);
+var f32c = new Float32Array(kLength);
+var i32a = new Int32Array(kLength);
+var i32b = new Int32Array(kLength);
+var i32c = new Int32Array(kLength);
+
+function Float64Setup() {
+  for (var i = 0; i < kLength; ++i) {
+    f64a[i] = i;
+    f64b[i] = 0.5;
+  }
+}
+
+function Float64Multiply() {
+  for (var i = 0; i < kLength; ++i) {
+    f64c[i] = f64a[i] * f64b[i];
+  }
+}
+
+function Float64MultiplyTearDown() {
+  for (var i = 0; i < kLength; ++i) {
+    if (f64c[i] != i * 0.5) return false;
+  }
+  return true;
+}
+
+function Float32Setup() {
+  for (var i = 0; i < kLength; ++i) {
+    f32a[i] = i;
+    f32b[i] = 1;
+  }
+}
+
+function Float32Add() {
+  for (var i = 0; i < kLength; ++i) {
+    f32c[i] = f32a[i] + f32b[i];
+  }
+}
+
+function Float32AddTearDown() {
+  for (var i = 0; i < kLength; ++i) {
+    if (f32c[i] != i + 1) return false;
+  }
+  return true;
+}
+
+function Int32Setup() {
+  for (var i = 0; i < kLength; ++i) {
+    i32a[i] = i;
+    i32b[i] = -i;
+  }
+}
+
+function Int32Add() {
+  for (var i = 0; i < kLength; ++i) {
+    i32c[i] = i32a[i] + i32b[i];
+  }
+}
+
+function Int32AddTearDown() {
+  for (var i = 0; i < kLength; ++i) {
+    if (i32c[i] != 0) return false;
+  }
+  return true;
+}
@@ -0,0 +1,74 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape --turbo-allocation-folding
+// Flags: --expose-gc
+
+// Test objects flowing through inlined functions, with deoptimization in
+// the innermost inlined frame.
+(function testInlinedFlow() {
+  "use strict";
+  function Point(x, y) {
+    this.x = x;
+    this.y = y;
+  }
+  function make(x, y) {
+    return new Point(x, y);
+  }
+  function length2(p, deopt) {
+    if (deopt) { %DeoptimizeNow(); }
+    return p.x * p.x + p.y * p.y;
+  }
+  function func(a, deopt) {
+    var p = make(a, a + 1);
+    var q = make(p.y, p.x);
+    return length2(p, deopt) + length2(q, false);
+  }
+  assertEquals(10, func(1, false));
+  assertEquals(26, func(2, false));
+  %OptimizeFunctionOnNextCall(func);
+  assertEquals(50, func(3, false));
+  assertEquals(82, func(4, true));
+})();
+
+
+// Test that folded allocations are properly initialized when they escape.
+(function testEscapingPair() {
+  function pair(a, b) {
+    return { first: { value: a }, second: { value: b } };
+  }
+  function func(a, b) {
+    return pair(a, b);
+  }
+  func(1, 2);
+  func(3, 4);
+  %OptimizeFunctionOnNextCall(func);
+  var p = func(5, 6);
+  gc();
+  assertEquals(5, p.first.value);
+  assertEquals(6, p.second.value);
+})();
+
+
+// Test that allocations are not folded across a call that triggers a GC
+// before the second object is initialized.
+(function testGCBetweenAllocations() {
+  function pair(a, b, f) {
+    var first = { value: a };
+    var second = { value: f(b) };
+    return { first: first, second: second };
+  }
+  function func(a, b, f) {
+    return pair(a, b, f);
+  }
+  function id(x) { return x; }
+  function collect(x) { gc(); return x; }
+  func(1, 2, id);
+  func(3, 4, id);
+  %OptimizeFunctionOnNextCall(func);
+  var p = func(5, 6, collect);
+  gc();
+  assertEquals(5, p.first.value);
+  assertEquals(6, p.second.value);
+})();
@@ -0,0 +1,44 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-vectorization
+
+var kLength = 37;
+var a = new Float64Array(kLength);
+var b = new Float64Array(kLength);
+var c = new Float64Array(kLength);
+
+function Add(start, end) {
+  start = start | 0;
+  end = Math.min(end | 0, kLength);
+  for (var i = start; i < end; ++i) {
+    c[i] = a[i] + b[i];
+  }
+}
+
+function Check(start, end) {
+  for (var i = 0; i < kLength; ++i) {
+    c[i] = -1;
+    a[i] = i;
+    b[i] = 0.5;
+  }
+  Add(start, end);
+  for (var i = 0; i < kLength; ++i) {
+    var expected = (i >= start && i < Math.min(end, kLength)) ? i + 0.5 : -1;
+    assertEquals(expected, c[i]);
+  }
+}
+
+Check(0, kLength);
+Check(3, kLength);
+%OptimizeFunctionOnNextCall(Add);
+Check(0, kLength);
+Check(1, 2);
+Check(5, 5);
+Check(0, 3);
+// An end close to the int32 range limits must not wrap the vector loop
+// bound.
+Check(0, -2147483648);
+Check(0, -2147483645);
+Check(30, 2147483647);
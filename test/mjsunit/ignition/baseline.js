@@ -0,0 +1,154 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-baseline --interrupt-budget=1000
+// Flags: --allow-natives-syntax
+
+// Test that functions keep computing the same results once their bytecode is
+// compiled to baseline code.
+
+// Calls |f| with |args| in the interpreter, compiles it to baseline code and
+// checks that the result stays the same.
+function assertBaseline(expected, f, args) {
+  assertEquals(expected, f.apply(null, args));
+  %BaselineFunctionOnNextCall(f);
+  for (var i = 0; i < 10; i++) {
+    assertEquals(expected, f.apply(null, args));
+  }
+  assertTrue(%HasBaselineCode(f));
+}
+
+function sum(n) {
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    if (i % 2 == 0) {
+      result += i;
+    } else {
+      result -= 1;
+    }
+  }
+  return result;
+}
+assertBaseline(2400, sum, [100]);
+
+// Overflowing the small integer fast paths.
+function add(a, b) { return a + b; }
+assertBaseline(0x7fffffff + 1, add, [0x7fffffff, 1]);
+assertEquals("ab", add("a", "b"));
+assertEquals(3, add(1, 2));
+
+// Postfix counts on values which are not small integers.
+function postfix(x) {
+  var old = x++;
+  return old + x;
+}
+assertBaseline(3, postfix, [1]);
+assertEquals(4.5, postfix(1.75));
+assertEquals(3, postfix("1"));
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function length(points) {
+  var result = 0;
+  for (var i = 0; i < points.length; i++) {
+    var p = points[i];
+    result += Math.abs(p.x) + Math.abs(p.y);
+  }
+  return result;
+}
+var points = [];
+for (var i = 0; i < 10; i++) points.push(new Point(i, -i));
+assertBaseline(90, length, [points]);
+
+function counter(n) {
+  var count = 0;
+  var next = function() { return ++count; };
+  for (var i = 0; i < n; i++) next();
+  return count;
+}
+assertBaseline(10, counter, [10]);
+
+function thrower(x) {
+  if (x > 5) throw x;
+  return x;
+}
+
+function catcher(n) {
+  var caught = 0;
+  for (var i = 0; i < n; i++) {
+    try {
+      caught += thrower(i);
+    } catch (e) {
+      caught -= e;
+    }
+  }
+  return caught;
+}
+assertBaseline(-15, catcher, [10]);
+
+function truthy(values) {
+  var count = 0;
+  for (var i = 0; i < values.length; i++) {
+    if (values[i]) count++;
+    if (!values[i]) count--;
+  }
+  return count;
+}
+assertBaseline(0, truthy, [[0, 1, "", "a", null, {}, undefined, true]]);
+
+function literals(x) {
+  var a = [1, x];
+  var o = {a: x, b: [x]};
+  var r = /a+/g;
+  return a[1] + o.b[0] + r.exec("baab")[0];
+}
+assertBaseline("xxaa", literals, ["x"]);
+
+function tests(o, key) {
+  return (key in o) + "," + (o instanceof Point);
+}
+assertBaseline("true,true", tests, [new Point(1, 2), "x"]);
+assertEquals("false,false", tests({}, "x"));
+assertThrows(function() { tests(1, "x"); }, TypeError);
+
+function computed(key) {
+  var o = {[key]: 1};
+  return Object.keys(o)[0];
+}
+assertBaseline("1", computed, [1]);
+assertEquals("a", computed("a"));
+
+function keys(o) {
+  var result = [];
+  for (var key in o) result.push(key);
+  return result.join();
+}
+assertBaseline("a,b", keys, [{a: 1, b: 2}]);
+assertEquals("", keys(null));
+
+// Changing the map of the receiver during the enumeration takes the slow path,
+// which filters the keys.
+function filtered() {
+  var o = {a: 1, b: 2};
+  var result = [];
+  for (var key in o) {
+    o.c = 1;
+    result.push(key);
+  }
+  return result.join();
+}
+assertBaseline("a,b", filtered, []);
+
+// Functions with bytecodes the baseline compiler does not support do not get
+// baseline code for their bytecode.
+function args() {
+  return arguments.length;
+}
+assertEquals(2, args(1, 2));
+%BaselineFunctionOnNextCall(args);
+assertEquals(2, args(1, 2));
+assertFalse(%HasBaselineCode(args));
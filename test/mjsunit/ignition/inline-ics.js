@@ -0,0 +1,44 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-inline-ics
+
+// Test that load and store sites only call the cached handler directly for
+// monomorphic feedback, and leave every other kind of feedback to the IC.
+
+(function testLoad() {
+  function load(o) { return o.x; }
+  function Make(i) {
+    var o = {};
+    o["p" + i] = i;
+    o.x = i;
+    return o;
+  }
+
+  // Uninitialized, monomorphic, polymorphic and megamorphic feedback.
+  for (var i = 0; i < 20; i++) {
+    var o = Make(i);
+    assertEquals(i, load(o));
+    assertEquals(i, load(o));
+  }
+  assertEquals(undefined, load(1));
+  assertEquals(undefined, load("str"));
+})();
+
+
+(function testStore() {
+  function store(o, v) { o.x = v; }
+  function Make(i) {
+    var o = {};
+    o["p" + i] = i;
+    return o;
+  }
+
+  for (var i = 0; i < 20; i++) {
+    var o = Make(i);
+    store(o, i);
+    store(o, i + 1);
+    assertEquals(i + 1, o.x);
+  }
+})();
@@ -0,0 +1,37 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition
+
+// Calls between interpreted functions take a shortcut when the callee needs
+// neither receiver conversion nor argument adaption. Check that the cases
+// which do need them still behave correctly.
+
+var global = this;
+
+function sloppyThis() { return this; }
+function strictThis() { 'use strict'; return this; }
+function add(a, b) { return a + b; }
+function count() { return arguments.length; }
+class C {}
+
+function test() {
+  assertSame(global, sloppyThis());
+  assertSame(undefined, strictThis());
+  assertEquals("object", typeof sloppyThis.call(1));
+  assertSame(1, strictThis.call(1));
+
+  var o = { f: sloppyThis };
+  assertSame(o, o.f());
+
+  assertEquals(3, add(1, 2));
+  assertEquals(3, add(1, 2, 3));
+  assertTrue(isNaN(add(1)));
+  assertEquals(0, count());
+  assertEquals(2, count(1, 2));
+
+  assertThrows(function() { C(); }, TypeError);
+}
+
+for (var i = 0; i < 10; i++) test();
@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-lazy-source-positions --no-turbo
+
+function f(x) {
+  if (x == 0) {
+    return new Error().stack;
+  }
+  return f(x - 1);
+}
+
+function g(x) {
+  var y = x + 1;
+  return y.foo.bar;
+}
+
+var stack_lines = f(2).split("\n");
+
+assertTrue(/at f \(.*?:9:12\)/.test(stack_lines[1]));
+assertTrue(/at f \(.*?:11:10\)/.test(stack_lines[2]));
+assertTrue(/at f \(.*?:11:10\)/.test(stack_lines[3]));
+
+// Later stack traces reuse the collected source position table.
+stack_lines = f(0).split("\n");
+assertTrue(/at f \(.*?:9:12\)/.test(stack_lines[1]));
+
+try {
+  g(1);
+  assertUnreachable();
+} catch (e) {
+  assertInstanceof(e, TypeError);
+  assertTrue(/at g \(.*?:16:15\)/.test(e.stack.split("\n")[1]));
+}
+
+// Stack overflows are thrown without collecting source positions, and the
+// positions are collected when the stack trace is formatted.
+function overflow() {
+  return overflow() + 1;
+}
+
+try {
+  overflow();
+  assertUnreachable();
+} catch (e) {
+  assertInstanceof(e, RangeError);
+  assertTrue(/at overflow \(.*?:40:10\)/.test(e.stack.split("\n")[1]));
+}
+
+// Errors created close to the stack limit only record the bytecode offset.
+function deep() {
+  try {
+    return deep();
+  } catch (e) {
+    return new Error();
+  }
+}
+
+var error = deep();
+assertTrue(/at deep \(.*?:56:12\)/.test(error.stack.split("\n")[1]));
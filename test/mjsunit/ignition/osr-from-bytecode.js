@@ -0,0 +1,48 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-osr --turbo-from-bytecode --allow-natives-syntax
+
+// Test on-stack replacement from interpreted frames into code optimized
+// from bytecode, with the loop state carried over through registers. OSR
+// code is not installed on the function, but counts as an optimization.
+
+function f() {
+  var sum = 0;
+  for (var i = 0; i < 10; i++) {
+    if (i == 5) %OptimizeOsr();
+    sum += i;
+  }
+  return sum;
+}
+var count = %GetOptimizationCount(f);
+assertEquals(45, f());
+assertTrue(%GetOptimizationCount(f) > count);
+
+function g(n) {
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    for (var j = 0; j < n; j++) {
+      if (i == 2 && j == 3) %OptimizeOsr();
+      result += i * j;
+    }
+  }
+  return result;
+}
+count = %GetOptimizationCount(g);
+assertEquals(100, g(5));
+assertTrue(%GetOptimizationCount(g) > count);
+assertEquals(100, g(5));
+
+function h(o) {
+  var k = 0;
+  while (k < o.limit) {
+    if (k == 7) %OptimizeOsr();
+    k = k + o.step;
+  }
+  return k;
+}
+count = %GetOptimizationCount(h);
+assertEquals(20, h({limit: 20, step: 1}));
+assertTrue(%GetOptimizationCount(h) > count);
@@ -0,0 +1,55 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-threaded-dispatch
+// Flags: --ignition-threaded-dispatch-ticks=0 --interrupt-budget=1000
+
+// Test that functions keep computing the same results once their bytecode is
+// dispatched through threaded code.
+
+function sum(n) {
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    if (i % 2 == 0) {
+      result += i;
+    } else {
+      result -= 1;
+    }
+  }
+  return result;
+}
+for (var i = 0; i < 100; i++) {
+  assertEquals(2400, sum(100));
+}
+
+function thrower(x) {
+  if (x > 5) throw x;
+  return x;
+}
+
+function catcher(n) {
+  var caught = 0;
+  for (var i = 0; i < n; i++) {
+    try {
+      caught += thrower(i);
+    } catch (e) {
+      caught -= e;
+    }
+  }
+  return caught;
+}
+for (var i = 0; i < 100; i++) {
+  assertEquals(-15, catcher(10));
+}
+
+// Constant pool indices beyond a byte need wide prefixed bytecodes.
+var source = "var a = 0;";
+for (var i = 0; i < 300; i++) {
+  source += "a += " + (i + 0.5) + ";";
+}
+source += "return a;";
+var wide = new Function(source);
+for (var i = 0; i < 20; i++) {
+  assertEquals(45000, wide());
+}
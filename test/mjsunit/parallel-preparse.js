@@ -0,0 +1,75 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-preparse --parallel-preparse-min-source-size=0
+
+// Test that lazily compiled functions behave the same when their bodies were
+// preparsed on background threads.
+
+function Script(parts) {
+  var source = "";
+  for (var i = 0; i < 200; i++) source += parts(i);
+  return source;
+}
+
+function Evaluate(source) {
+  return Realm.eval(Realm.current(), source);
+}
+
+// Top-level functions, surrounded by code the skimmer has to see through.
+Evaluate(Script(function(i) {
+  return "function f" + i + "(a, b) { return a + b + " + i + "; }\n" +
+         "var r" + i + " = /[{(]\\/}/g, s" + i + " = '{', d" + i + " = 4 / 2;\n" +
+         "// }\n/* { */\n" +
+         "var t" + i + " = `${ {a: '}'}.a }${ function() { return '{'; }() }`;\n" +
+         "var o" + i + " = { m: function(x) { return x * " + i + "; } };\n" +
+         "var g" + i + " = (x) => { return function() { return x; }; };\n";
+}));
+for (var i = 0; i < 200; i += 17) {
+  assertEquals(3 + i, this["f" + i](1, 2));
+  assertEquals(2 * i, this["o" + i].m(2));
+  assertEquals(i, this["g" + i](i)());
+  assertEquals("}{", this["t" + i]);
+  assertEquals(2, this["d" + i]);
+  assertTrue(this["r" + i].test("{/}"));
+}
+
+// Functions in parenthesized functions, which are parsed eagerly.
+var exported = Evaluate("(function() { 'use strict'; var exports = {};\n" +
+    Script(function(i) {
+      return "exports.h" + i + " = function() { return this; };\n" +
+             "function k" + i + "() { return typeof this; }\n" +
+             "exports.k" + i + " = k" + i + ";\n";
+    }) + "return exports; })()");
+for (var i = 0; i < 200; i += 17) {
+  assertEquals(undefined, exported["h" + i].call(undefined));
+  assertEquals("undefined", (0, exported["k" + i])());
+}
+
+// Functions with non-simple parameters and generators.
+Evaluate(Script(function(i) {
+  return "function p" + i + "(a = {b: " + i + "}, ...c) { return a.b; }\n" +
+         "function* q" + i + "() { yield function() { return " + i + "; }; }\n";
+}));
+for (var i = 0; i < 200; i += 17) {
+  assertEquals(i, this["p" + i]());
+  assertEquals(i, this["q" + i]().next().value());
+}
+
+// Errors in lazily parsed functions are still reported.
+assertThrows(function() {
+  Evaluate(Script(function(i) {
+    return "function e" + i + "() { return " + (i == 150 ? "}" : i) + "; }\n";
+  }));
+}, SyntaxError);
+assertThrows(function() {
+  Evaluate("'use strict';\n" + Script(function(i) {
+    return "function e" + i + "() { return " + (i == 150 ? "010" : i) + "; }\n";
+  }));
+}, SyntaxError);
+assertThrows(function() {
+  Evaluate(Script(function(i) {
+    return "function e" + i + "() { 'use strict'; with ({}) {} }\n";
+  }));
+}, SyntaxError);
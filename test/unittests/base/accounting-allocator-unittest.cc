@@ -0,0 +1,83 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/accounting-allocator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace base {
+
+namespace {
+
+const size_t kSegmentSize = AccountingAllocator::kMinPooledSegmentSize;
+
+}  // namespace
+
+TEST(AccountingAllocatorTest, SegmentPoolDisabledByDefault) {
+  AccountingAllocator allocator;
+  EXPECT_FALSE(allocator.segment_pool_enabled());
+  void* segment = allocator.AllocateSegment(kSegmentSize);
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentMemoryUsage());
+  allocator.FreeSegment(segment, kSegmentSize);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+
+TEST(AccountingAllocatorTest, SegmentPoolReusesSegments) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(4 * kSegmentSize);
+  void* segment = allocator.AllocateSegment(kSegmentSize);
+  allocator.FreeSegment(segment, kSegmentSize);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentPoolSize());
+
+  // Only a segment of the same size is reused.
+  void* bigger = allocator.AllocateSegment(2 * kSegmentSize);
+  EXPECT_NE(segment, bigger);
+  EXPECT_EQ(segment, allocator.AllocateSegment(kSegmentSize));
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(3 * kSegmentSize, allocator.GetCurrentMemoryUsage());
+
+  allocator.FreeSegment(segment, kSegmentSize);
+  allocator.FreeSegment(bigger, 2 * kSegmentSize);
+  EXPECT_EQ(3 * kSegmentSize, allocator.GetCurrentPoolSize());
+}
+
+
+TEST(AccountingAllocatorTest, SegmentPoolBudget) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(kSegmentSize);
+  void* first = allocator.AllocateSegment(kSegmentSize);
+  void* second = allocator.AllocateSegment(kSegmentSize);
+  allocator.FreeSegment(first, kSegmentSize);
+  allocator.FreeSegment(second, kSegmentSize);
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentPoolSize());
+
+  // Segments of other sizes are never pooled.
+  void* odd = allocator.AllocateSegment(kSegmentSize + 8);
+  allocator.FreeSegment(odd, kSegmentSize + 8);
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+
+  allocator.ConfigureSegmentPool(0);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+
+TEST(AccountingAllocatorTest, RoundUpToPooledSize) {
+  EXPECT_EQ(kSegmentSize, AccountingAllocator::RoundUpToPooledSize(1));
+  EXPECT_EQ(kSegmentSize,
+            AccountingAllocator::RoundUpToPooledSize(kSegmentSize));
+  EXPECT_EQ(2 * kSegmentSize,
+            AccountingAllocator::RoundUpToPooledSize(kSegmentSize + 1));
+  EXPECT_EQ(AccountingAllocator::kMaxPooledSegmentSize,
+            AccountingAllocator::RoundUpToPooledSize(
+                AccountingAllocator::kMaxPooledSegmentSize));
+  size_t large = AccountingAllocator::kMaxPooledSegmentSize + 1;
+  EXPECT_EQ(large, AccountingAllocator::RoundUpToPooledSize(large));
+}
+
+}  // namespace base
+}  // namespace v8
@@ -0,0 +1,172 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/allocation-folding.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class AllocationFoldingTest : public GraphTest {
+ public:
+  AllocationFoldingTest()
+      : GraphTest(3),
+        javascript_(zone()),
+        machine_(zone()),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~AllocationFoldingTest() override {}
+
+ protected:
+  int Fold() {
+    AllocationFolding folding(jsgraph(), zone());
+    folding.Fold();
+    return folding.folded_count();
+  }
+
+  Node* NewAllocate(int size, Node* effect, Node* control,
+                    PretenureFlag pretenure = NOT_TENURED) {
+    return graph()->NewNode(simplified()->Allocate(pretenure),
+                            Int32Constant(size), effect, control);
+  }
+
+  Node* NewStoreMap(Node* object, Node* effect, Node* control) {
+    return graph()->NewNode(simplified()->StoreField(AccessBuilder::ForMap()),
+                            object, Parameter(0), effect, control);
+  }
+
+  // Checks that {value} is the inner pointer {allocation} + {offset}.
+  void ExpectInnerPointer(Node* value, Node* allocation, int offset) {
+    ASSERT_EQ(IrOpcode::kBitcastWordToTagged, value->opcode());
+    Node* add = value->InputAt(0);
+    EXPECT_EQ(machine()->IntAdd(), add->op());
+    EXPECT_EQ(allocation, add->InputAt(0));
+    EXPECT_EQ(jsgraph()->IntPtrConstant(offset), add->InputAt(1));
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+
+TEST_F(AllocationFoldingTest, FoldsAdjacentAllocations) {
+  Node* first = NewAllocate(16, start(), start());
+  Node* store1 = NewStoreMap(first, first, start());
+  Node* second = NewAllocate(24, store1, start());
+  Node* store2 = NewStoreMap(second, second, start());
+  Node* ret = graph()->NewNode(common()->Return(), second, store2, start());
+  graph()->SetEnd(ret);
+
+  EXPECT_EQ(1, Fold());
+  EXPECT_THAT(first, IsAllocate(IsInt32Constant(40), start(), start()));
+  EXPECT_EQ(store1, NodeProperties::GetEffectInput(store2));
+  ExpectInnerPointer(store2->InputAt(0), first, 16);
+  EXPECT_EQ(store2->InputAt(0), ret->InputAt(0));
+}
+
+
+TEST_F(AllocationFoldingTest, FoldsAllocationChain) {
+  Node* first = NewAllocate(16, start(), start());
+  Node* store1 = NewStoreMap(first, first, start());
+  Node* second = NewAllocate(24, store1, start());
+  Node* store2 = NewStoreMap(second, second, start());
+  Node* third = NewAllocate(8, store2, start());
+  Node* store3 = NewStoreMap(third, third, start());
+  graph()->SetEnd(
+      graph()->NewNode(common()->Return(), third, store3, start()));
+
+  EXPECT_EQ(2, Fold());
+  EXPECT_THAT(first, IsAllocate(IsInt32Constant(48), start(), start()));
+  ExpectInnerPointer(store2->InputAt(0), first, 16);
+  ExpectInnerPointer(store3->InputAt(0), first, 40);
+}
+
+
+TEST_F(AllocationFoldingTest, DoesNotFoldAcrossBlocks) {
+  Node* first = NewAllocate(16, start(), start());
+  Node* branch = graph()->NewNode(common()->Branch(), Parameter(1), start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* second = NewAllocate(24, first, if_true);
+  Node* store = NewStoreMap(second, second, if_true);
+  graph()->SetEnd(
+      graph()->NewNode(common()->Return(), second, store, if_true));
+
+  EXPECT_EQ(0, Fold());
+  EXPECT_THAT(first, IsAllocate(IsInt32Constant(16), start(), start()));
+  EXPECT_EQ(second, store->InputAt(0));
+}
+
+
+TEST_F(AllocationFoldingTest, DoesNotFoldPretenuredAllocations) {
+  Node* first = NewAllocate(16, start(), start(), TENURED);
+  Node* second = NewAllocate(24, first, start());
+  Node* store = NewStoreMap(second, second, start());
+  graph()->SetEnd(
+      graph()->NewNode(common()->Return(), second, store, start()));
+
+  EXPECT_EQ(0, Fold());
+  EXPECT_EQ(second, store->InputAt(0));
+}
+
+
+TEST_F(AllocationFoldingTest, DoesNotFoldAcrossPossibleGC) {
+  Node* first = NewAllocate(16, start(), start());
+  Node* store1 = NewStoreMap(first, first, start());
+  Node* gc = NewAllocate(32, store1, start(), TENURED);
+  Node* second = NewAllocate(24, gc, start());
+  Node* store2 = NewStoreMap(second, second, start());
+  graph()->SetEnd(
+      graph()->NewNode(common()->Return(), second, store2, start()));
+
+  EXPECT_EQ(0, Fold());
+  EXPECT_THAT(first, IsAllocate(IsInt32Constant(16), start(), start()));
+  EXPECT_EQ(second, store2->InputAt(0));
+}
+
+
+TEST_F(AllocationFoldingTest, DoesNotFoldIfGCPrecedesInitialization) {
+  Node* first = NewAllocate(16, start(), start());
+  Node* store1 = NewStoreMap(first, first, start());
+  Node* second = NewAllocate(24, store1, start());
+  Node* gc = NewAllocate(32, second, start(), TENURED);
+  Node* store2 = NewStoreMap(second, gc, start());
+  graph()->SetEnd(
+      graph()->NewNode(common()->Return(), second, store2, start()));
+
+  EXPECT_EQ(0, Fold());
+  EXPECT_THAT(first, IsAllocate(IsInt32Constant(16), start(), start()));
+  EXPECT_EQ(second, store2->InputAt(0));
+}
+
+
+TEST_F(AllocationFoldingTest, DoesNotFoldIfMapIsStoredInOtherBlock) {
+  Node* first = NewAllocate(16, start(), start());
+  Node* store1 = NewStoreMap(first, first, start());
+  Node* second = NewAllocate(24, store1, start());
+  Node* branch = graph()->NewNode(common()->Branch(), Parameter(1), start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* store2 = NewStoreMap(second, second, if_true);
+  graph()->SetEnd(
+      graph()->NewNode(common()->Return(), second, store2, if_true));
+
+  EXPECT_EQ(0, Fold());
+  EXPECT_EQ(second, store2->InputAt(0));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,189 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/bounds-check-elimination.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class BoundsCheckEliminationTest : public TypedGraphTest {
+ public:
+  BoundsCheckEliminationTest()
+      : TypedGraphTest(3),
+        javascript_(zone()),
+        machine_(zone()),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~BoundsCheckEliminationTest() override {}
+
+ protected:
+  // A counted loop with an induction variable {phi}, whose body starts at
+  // {body}.
+  struct CountedLoop {
+    Node* loop;
+    Node* effect_phi;
+    Node* phi;
+    Node* body;
+  };
+
+  Reduction Reduce(Node* node) {
+    GraphReducer graph_reducer(zone(), graph());
+    BoundsCheckElimination reducer(&graph_reducer, jsgraph());
+    return reducer.Reduce(node);
+  }
+
+  // Builds the loop for (phi = initial; condition(phi); phi += step).
+  CountedLoop NewCountedLoop(double initial, double step,
+                             const Operator* comparison, Node* lhs,
+                             Node* rhs) {
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* init = NumberConstant(initial);
+    Node* phi = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kTagged, 2), init, init, loop);
+    Node* update = graph()->NewNode(simplified()->NumberAdd(), phi,
+                                    NumberConstant(step));
+    phi->ReplaceInput(1, update);
+    Node* check = graph()->NewNode(comparison, lhs ? lhs : phi,
+                                   rhs ? rhs : phi);
+    Node* branch = graph()->NewNode(common()->Branch(), check, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    loop->ReplaceInput(1, if_true);
+    effect_phi->ReplaceInput(1, effect_phi);
+    return {loop, effect_phi, phi, if_true};
+  }
+
+  CountedLoop NewUpCountingLoop(double initial, double bound) {
+    return NewCountedLoop(initial, 1, simplified()->NumberLessThan(), nullptr,
+                          NumberConstant(bound));
+  }
+
+  Node* NewLoadBuffer(ExternalArrayType type, Node* buffer, Node* index,
+                      double byte_length, Node* effect, Node* control) {
+    BufferAccess const access(type);
+    int const k = ElementSizeLog2Of(access.machine_type().representation());
+    Node* offset = k == 0 ? index
+                          : graph()->NewNode(machine()->Word32Shl(), index,
+                                             Int32Constant(k));
+    return graph()->NewNode(simplified()->LoadBuffer(access), buffer, offset,
+                            NumberConstant(byte_length), effect, control);
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferWithInductionVariable) {
+  CountedLoop l = NewUpCountingLoop(0, 100);
+  Node* buffer = Parameter(0);
+  Node* load = NewLoadBuffer(kExternalFloat64Array, buffer, l.phi, 800,
+                             l.effect_phi, l.body);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(),
+              IsLoadElement(AccessBuilder::ForTypedArrayElement(
+                                kExternalFloat64Array, true),
+                            buffer, l.phi, l.effect_phi, l.body));
+}
+
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferWithTruncatedInductionVariable) {
+  CountedLoop l = NewUpCountingLoop(0, 100);
+  Node* buffer = Parameter(0);
+  Node* index = graph()->NewNode(simplified()->NumberBitwiseOr(), l.phi,
+                                 NumberConstant(0));
+  Node* load = NewLoadBuffer(kExternalInt32Array, buffer, index, 400,
+                             l.effect_phi, l.body);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(),
+              IsLoadElement(AccessBuilder::ForTypedArrayElement(
+                                kExternalInt32Array, true),
+                            buffer, index, l.effect_phi, l.body));
+}
+
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferWithNonStrictCondition) {
+  CountedLoop l = NewCountedLoop(0, 1, simplified()->NumberLessThanOrEqual(),
+                                 nullptr, NumberConstant(99));
+  Node* buffer = Parameter(0);
+  Node* load = NewLoadBuffer(kExternalUint8Array, buffer, l.phi, 100,
+                             l.effect_phi, l.body);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(),
+              IsLoadElement(AccessBuilder::ForTypedArrayElement(
+                                kExternalUint8Array, true),
+                            buffer, l.phi, l.effect_phi, l.body));
+}
+
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferOutOfBounds) {
+  CountedLoop l = NewUpCountingLoop(0, 101);
+  Node* buffer = Parameter(0);
+  Node* load = NewLoadBuffer(kExternalFloat64Array, buffer, l.phi, 800,
+                             l.effect_phi, l.body);
+  Reduction r = Reduce(load);
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferWithNegativeInitialValue) {
+  CountedLoop l = NewUpCountingLoop(-1, 100);
+  Node* buffer = Parameter(0);
+  Node* load = NewLoadBuffer(kExternalFloat64Array, buffer, l.phi, 800,
+                             l.effect_phi, l.body);
+  Reduction r = Reduce(load);
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferWithoutLoopCondition) {
+  CountedLoop l = NewUpCountingLoop(0, 100);
+  Node* buffer = Parameter(0);
+  Node* load = NewLoadBuffer(kExternalFloat64Array, buffer, l.phi, 800,
+                             l.effect_phi, l.loop);
+  Reduction r = Reduce(load);
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(BoundsCheckEliminationTest, StoreBufferWithDecreasingInductionVariable) {
+  // for (phi = 99; 0 <= phi; phi -= 1) a[phi] = value;
+  CountedLoop l = NewCountedLoop(99, -1, simplified()->NumberLessThanOrEqual(),
+                                 NumberConstant(0), nullptr);
+  Node* buffer = Parameter(0);
+  Node* value = Parameter(Type::Number(), 1);
+  Node* offset =
+      graph()->NewNode(machine()->Word32Shl(), l.phi, Int32Constant(2));
+  Node* store = graph()->NewNode(
+      simplified()->StoreBuffer(BufferAccess(kExternalFloat32Array)),
+      buffer, offset, NumberConstant(400), value, l.effect_phi, l.body);
+  Reduction r = Reduce(store);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(),
+              IsStoreElement(AccessBuilder::ForTypedArrayElement(
+                                 kExternalFloat32Array, true),
+                             buffer, l.phi, value, l.effect_phi, l.body));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -275,6 +275,29 @@ TEST_F(EscapeAnalysisTest, StraightEscape) {
 }
 
 
+TEST_F(EscapeAnalysisTest, UnmodeledPureUseEscapes) {
+  Node* object1 = Constant(1);
+  BeginRegion();
+  Node* allocation = Allocate(Constant(kPointerSize));
+  Store(FieldAccessAtIndex(0), allocation, object1);
+  Node* finish = FinishRegion(allocation);
+  Node* check = graph()->NewNode(simplified()->ObjectIsNumber(), finish);
+  Node* load = Load(FieldAccessAtIndex(0), finish);
+  Node* result = Return(load);
+  EndGraph();
+  graph()->end()->AppendInput(zone(), check);
+
+  Analysis();
+
+  ExpectEscaped(allocation);
+
+  Transformation();
+
+  ASSERT_EQ(finish, NodeProperties::GetValueInput(check, 0));
+  ASSERT_EQ(load, NodeProperties::GetValueInput(result, 0));
+}
+
+
 TEST_F(EscapeAnalysisTest, StoreLoadEscape) {
   Node* object1 = Constant(1);
 
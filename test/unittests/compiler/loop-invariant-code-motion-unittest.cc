@@ -0,0 +1,174 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopInvariantCodeMotionTest : public GraphTest {
+ public:
+  LoopInvariantCodeMotionTest() : GraphTest(3), simplified_(zone()) {}
+  ~LoopInvariantCodeMotionTest() override {}
+
+ protected:
+  struct While {
+    Node* loop;
+    Node* effect_phi;
+    Node* if_true;
+    Node* exit;
+  };
+
+  int Optimize() {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+    LoopInvariantCodeMotion licm(loop_tree, zone());
+    licm.Optimize();
+    return licm.hoisted_count();
+  }
+
+  While NewWhile(Node* cond) {
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* exit = graph()->NewNode(common()->IfFalse(), branch);
+    loop->ReplaceInput(1, if_true);
+    return {loop, effect_phi, if_true, exit};
+  }
+
+  // Closes the effect chain of {w} with {effect} and returns the value
+  // {value} after the loop.
+  void Finish(While* w, Node* effect, Node* value) {
+    w->effect_phi->ReplaceInput(1, effect);
+    Node* ret = graph()->NewNode(common()->Return(), value, w->effect_phi,
+                                 w->exit);
+    graph()->SetEnd(ret);
+  }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadFieldInWriteFreeLoop) {
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* object = Parameter(0);
+  While w = NewWhile(Parameter(1));
+  Node* load = graph()->NewNode(simplified()->LoadField(access), object,
+                                w.effect_phi, w.loop);
+  Finish(&w, load, load);
+
+  EXPECT_EQ(1, Optimize());
+  EXPECT_THAT(load, IsLoadField(access, object, start(), start()));
+  EXPECT_THAT(w.effect_phi, IsEffectPhi(load, w.effect_phi, w.loop));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadFieldChainInWriteFreeLoop) {
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* object = Parameter(0);
+  While w = NewWhile(Parameter(1));
+  Node* load1 = graph()->NewNode(simplified()->LoadField(access), object,
+                                 w.effect_phi, w.loop);
+  Node* load2 = graph()->NewNode(simplified()->LoadField(access), load1,
+                                 load1, w.loop);
+  Finish(&w, load2, load2);
+
+  EXPECT_EQ(2, Optimize());
+  EXPECT_THAT(load1, IsLoadField(access, object, start(), start()));
+  EXPECT_THAT(load2, IsLoadField(access, load1, load1, start()));
+  EXPECT_THAT(w.effect_phi, IsEffectPhi(load2, w.effect_phi, w.loop));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadFieldWithStoreElementInLoop) {
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* object = Parameter(0);
+  While w = NewWhile(Parameter(1));
+  Node* load = graph()->NewNode(simplified()->LoadField(access), object,
+                                w.effect_phi, w.loop);
+  Node* store = graph()->NewNode(
+      simplified()->StoreElement(AccessBuilder::ForFixedArrayElement()), load,
+      Int32Constant(0), Parameter(2), load, w.if_true);
+  Finish(&w, store, load);
+
+  EXPECT_EQ(1, Optimize());
+  EXPECT_THAT(load, IsLoadField(access, object, start(), start()));
+  EXPECT_EQ(w.effect_phi, NodeProperties::GetEffectInput(store));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadFieldWithStoreFieldInLoop) {
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* object = Parameter(0);
+  While w = NewWhile(Parameter(1));
+  Node* load = graph()->NewNode(simplified()->LoadField(access), object,
+                                w.effect_phi, w.loop);
+  Node* store = graph()->NewNode(simplified()->StoreField(access), object,
+                                 Parameter(2), load, w.if_true);
+  Finish(&w, store, load);
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_THAT(load, IsLoadField(access, object, w.effect_phi, w.loop));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadElementWithStoreElementInLoop) {
+  ElementAccess const access = AccessBuilder::ForFixedArrayElement();
+  Node* object = Parameter(0);
+  Node* index = Int32Constant(0);
+  While w = NewWhile(Parameter(1));
+  Node* load = graph()->NewNode(simplified()->LoadElement(access), object,
+                                index, w.effect_phi, w.loop);
+  Node* store =
+      graph()->NewNode(simplified()->StoreElement(access), object, index,
+                       Parameter(2), load, w.if_true);
+  Finish(&w, store, load);
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_THAT(load, IsLoadElement(access, object, index, w.effect_phi, w.loop));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadFieldWithVariantInput) {
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  While w = NewWhile(Parameter(1));
+  Node* phi =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                       Parameter(0), Parameter(0), w.loop);
+  Node* load = graph()->NewNode(simplified()->LoadField(access), phi,
+                                w.effect_phi, w.loop);
+  phi->ReplaceInput(1, load);
+  Finish(&w, load, load);
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_THAT(load, IsLoadField(access, phi, w.effect_phi, w.loop));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, LoadFieldInLoopBody) {
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* object = Parameter(0);
+  While w = NewWhile(Parameter(1));
+  Node* load = graph()->NewNode(simplified()->LoadField(access), object,
+                                w.effect_phi, w.if_true);
+  Finish(&w, load, load);
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_THAT(load, IsLoadField(access, object, w.effect_phi, w.if_true));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,243 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-vectorizer.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVectorizerTest : public TypedGraphTest {
+ public:
+  LoopVectorizerTest()
+      : TypedGraphTest(3),
+        javascript_(zone()),
+        machine_(zone(), MachineType::PointerRepresentation(),
+                 MachineOperatorBuilder::kArrayBinop),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~LoopVectorizerTest() override {}
+
+ protected:
+  // The loop for (phi = initial; phi < end; phi++) dst[phi] = value, where
+  // value = lhs[phi] op rhs[phi], followed by a return of {phi}.
+  struct Kernel {
+    Node* loop;
+    Node* effect_phi;
+    Node* phi;
+    Node* stack_check;
+    Node* ret;
+  };
+
+  int Optimize() {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+    LoopVectorizer vectorizer(jsgraph(), loop_tree);
+    vectorizer.Optimize();
+    return vectorizer.vectorized_count();
+  }
+
+  Kernel NewKernel(ExternalArrayType type, const Operator* op, Node* dst,
+                   Node* lhs, Node* rhs, double initial, Node* end,
+                   bool with_stack_check = false) {
+    ElementAccess const access =
+        AccessBuilder::ForTypedArrayElement(type, true);
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* init = NumberConstant(initial);
+    Node* phi = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kTagged, 2), init, init, loop);
+    phi->ReplaceInput(1, graph()->NewNode(simplified()->NumberAdd(), phi,
+                                          NumberConstant(1)));
+    Node* check = graph()->NewNode(simplified()->NumberLessThan(), phi, end);
+    Node* branch = graph()->NewNode(common()->Branch(), check, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* exit = graph()->NewNode(common()->IfFalse(), branch);
+    Node* body = if_true;
+    Node* effect = effect_phi;
+    Node* stack_check = nullptr;
+    if (with_stack_check) {
+      Node* locals = graph()->NewNode(common()->StateValues(1), phi);
+      Node* empty = graph()->NewNode(common()->StateValues(0));
+      Node* frame_state = graph()->NewNode(
+          common()->FrameState(BailoutId::None(),
+                               OutputFrameStateCombine::Ignore(), nullptr),
+          empty, locals, empty, NumberConstant(0), UndefinedConstant(),
+          graph()->start());
+      stack_check = body = effect =
+          graph()->NewNode(javascript()->StackCheck(), Parameter(2),
+                           frame_state, effect, if_true);
+    }
+    loop->ReplaceInput(1, body);
+
+    Node* left = graph()->NewNode(simplified()->LoadElement(access), lhs, phi,
+                                  effect, body);
+    Node* right = graph()->NewNode(simplified()->LoadElement(access), rhs,
+                                   phi, left, body);
+    Node* value = graph()->NewNode(op, left, right);
+    Node* store = graph()->NewNode(simplified()->StoreElement(access), dst,
+                                   phi, value, right, body);
+    effect_phi->ReplaceInput(1, store);
+
+    Node* terminate =
+        graph()->NewNode(common()->Terminate(), effect_phi, loop);
+    Node* ret = graph()->NewNode(common()->Return(), phi, effect_phi, exit);
+    graph()->SetEnd(graph()->NewNode(common()->End(2), ret, terminate));
+    return {loop, effect_phi, phi, stack_check, ret};
+  }
+
+  // Checks that {k} was strip-mined into a loop over an ArrayBinop of
+  // {dst}, {lhs} and {rhs} from {phi} up to min(phi + strip size, end), and
+  // returns the ArrayBinop.
+  Node* CheckStripMined(Kernel const& k, Node* dst, Node* lhs, Node* rhs,
+                        Node* end) {
+    Node* array_binop = k.effect_phi->InputAt(1);
+    EXPECT_EQ(IrOpcode::kArrayBinop, array_binop->opcode());
+    EXPECT_EQ(dst, array_binop->InputAt(0));
+    EXPECT_EQ(lhs, array_binop->InputAt(1));
+    EXPECT_EQ(rhs, array_binop->InputAt(2));
+    EXPECT_EQ(k.phi, array_binop->InputAt(3));
+    Node* next = array_binop->InputAt(4);
+    EXPECT_EQ(next, k.phi->InputAt(1));
+    EXPECT_EQ(IrOpcode::kSelect, next->opcode());
+    EXPECT_EQ(end, next->InputAt(2));
+    Node* upper = next->InputAt(1);
+    EXPECT_EQ(IrOpcode::kNumberAdd, upper->opcode());
+    EXPECT_EQ(k.phi, upper->InputAt(0));
+    EXPECT_THAT(next->InputAt(0), IsNumberLessThan(upper, end));
+    EXPECT_EQ(k.loop->InputAt(1), NodeProperties::GetControlInput(array_binop));
+    EXPECT_EQ(start(), k.loop->InputAt(0));
+    EXPECT_EQ(k.effect_phi, NodeProperties::GetEffectInput(k.ret));
+    EXPECT_EQ(k.phi, NodeProperties::GetValueInput(k.ret, 0));
+    return array_binop;
+  }
+
+  template <typename T>
+  Node* ArrayConstant(T* array) {
+    return jsgraph()->PointerConstant(array);
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  JSOperatorBuilder* javascript() { return &javascript_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+
+TEST_F(LoopVectorizerTest, Float64Multiply) {
+  double a[100], b[100], c[100];
+  Node* dst = ArrayConstant(c);
+  Node* lhs = ArrayConstant(a);
+  Node* rhs = ArrayConstant(b);
+  Node* end = NumberConstant(100);
+  Kernel k = NewKernel(kExternalFloat64Array, simplified()->NumberMultiply(),
+                       dst, lhs, rhs, 0, end);
+
+  EXPECT_EQ(1, Optimize());
+  Node* array_binop = CheckStripMined(k, dst, lhs, rhs, end);
+  ASSERT_EQ(IrOpcode::kArrayBinop, array_binop->opcode());
+  ArrayBinopParameters const params = ArrayBinopParametersOf(array_binop->op());
+  EXPECT_EQ(MachineRepresentation::kFloat64, params.representation());
+  EXPECT_EQ(ArrayBinopKind::kMul, params.kind());
+  EXPECT_EQ(k.effect_phi, NodeProperties::GetEffectInput(array_binop));
+}
+
+
+TEST_F(LoopVectorizerTest, StackCheckIsKept) {
+  double a[100], b[100], c[100];
+  Node* dst = ArrayConstant(c);
+  Node* lhs = ArrayConstant(a);
+  Node* rhs = ArrayConstant(b);
+  Node* end = Parameter(Type::Signed32(), 0);
+  Kernel k = NewKernel(kExternalFloat64Array, simplified()->NumberAdd(), dst,
+                       lhs, rhs, 0, end, true);
+
+  EXPECT_EQ(1, Optimize());
+  Node* array_binop = CheckStripMined(k, dst, lhs, rhs, end);
+  EXPECT_EQ(k.stack_check, NodeProperties::GetEffectInput(array_binop));
+  EXPECT_EQ(k.stack_check, NodeProperties::GetControlInput(array_binop));
+  EXPECT_EQ(k.effect_phi, NodeProperties::GetEffectInput(k.stack_check));
+  EXPECT_EQ(k.stack_check, k.loop->InputAt(1));
+}
+
+
+TEST_F(LoopVectorizerTest, Int32AddInPlace) {
+  int32_t a[64], b[64];
+  Node* lhs = ArrayConstant(a);
+  Kernel k = NewKernel(kExternalInt32Array, simplified()->NumberAdd(), lhs,
+                       lhs, ArrayConstant(b), 1, NumberConstant(64));
+
+  EXPECT_EQ(1, Optimize());
+  Node* array_binop = k.effect_phi->InputAt(1);
+  ASSERT_EQ(IrOpcode::kArrayBinop, array_binop->opcode());
+  ArrayBinopParameters const params = ArrayBinopParametersOf(array_binop->op());
+  EXPECT_EQ(MachineRepresentation::kWord32, params.representation());
+  EXPECT_EQ(ArrayBinopKind::kAdd, params.kind());
+}
+
+
+TEST_F(LoopVectorizerTest, Int32MultiplyIsNotVectorized) {
+  int32_t a[64], b[64], c[64];
+  Kernel k = NewKernel(kExternalInt32Array, simplified()->NumberMultiply(),
+                       ArrayConstant(c), ArrayConstant(a), ArrayConstant(b), 0,
+                       NumberConstant(64));
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_EQ(IrOpcode::kStoreElement, k.effect_phi->InputAt(1)->opcode());
+  EXPECT_EQ(start(), k.loop->InputAt(0));
+}
+
+
+TEST_F(LoopVectorizerTest, OverlappingArraysAreNotVectorized) {
+  double a[101], b[100];
+  Kernel k = NewKernel(kExternalFloat64Array, simplified()->NumberAdd(),
+                       ArrayConstant(&a[1]), ArrayConstant(&a[0]),
+                       ArrayConstant(b), 0, NumberConstant(100));
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_EQ(IrOpcode::kStoreElement, k.effect_phi->InputAt(1)->opcode());
+}
+
+
+TEST_F(LoopVectorizerTest, NonInt32EndIsNotVectorized) {
+  float a[100], b[100], c[100];
+  Kernel k = NewKernel(kExternalFloat32Array, simplified()->NumberSubtract(),
+                       ArrayConstant(c), ArrayConstant(a), ArrayConstant(b), 0,
+                       Parameter(Type::Number(), 0));
+
+  EXPECT_EQ(0, Optimize());
+  EXPECT_EQ(IrOpcode::kStoreElement, k.effect_phi->InputAt(1)->opcode());
+}
+
+
+TEST_F(LoopVectorizerTest, FinalValueIsKept) {
+  // The loop may not be entered, so {phi} is not necessarily {end} after it.
+  float a[100], b[100], c[100];
+  Node* dst = ArrayConstant(c);
+  Node* lhs = ArrayConstant(a);
+  Node* rhs = ArrayConstant(b);
+  Node* end = Parameter(Type::Signed32(), 0);
+  Kernel k = NewKernel(kExternalFloat32Array, simplified()->NumberDivide(),
+                       dst, lhs, rhs, 0, end);
+
+  EXPECT_EQ(1, Optimize());
+  CheckStripMined(k, dst, lhs, rhs, end);
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
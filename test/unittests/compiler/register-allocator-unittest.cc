@@ -701,6 +701,109 @@ TEST_F(RegisterAllocatorTest, MultipleDeferredBlockSpills) {
 }
 
 
+class ColoringAllocatorTest : public RegisterAllocatorTest {
+ public:
+  ColoringAllocatorTest() : saved_flag_(FLAG_turbo_coloring_regalloc) {
+    FLAG_turbo_coloring_regalloc = true;
+  }
+  ~ColoringAllocatorTest() override {
+    FLAG_turbo_coloring_regalloc = saved_flag_;
+  }
+
+ private:
+  bool saved_flag_;
+};
+
+
+TEST_F(ColoringAllocatorTest, SimpleLoop) {
+  StartBlock();
+  auto i_reg = DefineConstant();
+  auto k_reg = DefineConstant();
+  EndBlock();
+
+  {
+    StartLoop(1);
+
+    StartBlock();
+    auto phi = Phi(i_reg, 2);
+    auto ipp = EmitOI(Same(), Reg(phi), Use(k_reg));
+    SetInput(phi, 1, ipp);
+    EndBlock(Jump(0));
+
+    EndLoop();
+  }
+
+  Allocate();
+}
+
+
+TEST_F(ColoringAllocatorTest, UncolorableRangesAreSplit) {
+  // More values are live in the loop than there are registers, so some of
+  // them are left to the linear scan, which has to split them.
+  const size_t kNumRegs = 3;
+  const size_t kParams = kNumRegs + 1;
+  SetNumRegs(kNumRegs, kNumRegs);
+
+  StartBlock();
+  auto constant = DefineConstant();
+  VReg parameters[kParams];
+  for (size_t i = 0; i < arraysize(parameters); ++i) {
+    parameters[i] = DefineConstant();
+  }
+  EndBlock();
+
+  PhiInstruction* phis[kParams];
+  {
+    StartLoop(2);
+
+    StartBlock();
+    for (size_t i = 0; i < arraysize(parameters); ++i) {
+      phis[i] = Phi(parameters[i], 2);
+    }
+    for (size_t i = 0; i < arraysize(parameters); ++i) {
+      auto result = EmitOI(Same(), Reg(phis[i]), Use(constant));
+      SetInput(phis[i], 1, result);
+    }
+    EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+    StartBlock();
+    EndBlock(Jump(-1));
+
+    EndLoop();
+  }
+
+  StartBlock();
+  Return(DefineConstant());
+  EndBlock();
+
+  Allocate();
+}
+
+
+TEST_F(ColoringAllocatorTest, RangesAcrossCalls) {
+  StartBlock();
+  auto x = EmitOI(Reg(0));
+  auto y = EmitOI(Reg());
+  EndBlock(Branch(Reg(x), 1, 2));
+
+  StartBlock();
+  EmitCall(Slot(-1));
+  auto occupy = EmitOI(Reg(0));
+  EndBlock(Jump(2));
+
+  StartBlock();
+  EndBlock(FallThrough());
+
+  StartBlock();
+  Use(occupy);
+  EmitOI(Reg(), Reg(y));
+  Return(Reg(x));
+  EndBlock();
+
+  Allocate();
+}
+
+
 namespace {
 
 enum class ParameterType { kFixedSlot, kSlot, kRegister, kFixedRegister };
@@ -0,0 +1,56 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class InstructionSchedulerX64Test : public TestWithZone {
+ protected:
+  // Returns an instruction with one output and two inputs in registers.
+  Instruction* NewInstruction(InstructionCode opcode) {
+    InstructionOperand output(
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1));
+    InstructionOperand inputs[] = {
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2),
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 3)};
+    return Instruction::New(zone(), opcode, 1, &output, 2, inputs, 0, nullptr);
+  }
+
+  bool CanBeSpeculated(InstructionCode opcode) {
+    InstructionScheduler scheduler(zone(), nullptr);
+    return scheduler.CanBeSpeculated(NewInstruction(opcode));
+  }
+};
+
+
+TEST_F(InstructionSchedulerX64Test, SpeculatesArithmetic) {
+  EXPECT_TRUE(CanBeSpeculated(kX64Add32));
+  EXPECT_TRUE(CanBeSpeculated(kX64Imul));
+  EXPECT_TRUE(CanBeSpeculated(kSSEFloat64Div));
+}
+
+
+TEST_F(InstructionSchedulerX64Test, DoesNotSpeculateTrappingInstructions) {
+  // Even with unconstrained operands, which the instruction selector doesn't
+  // produce for them on x64.
+  EXPECT_FALSE(CanBeSpeculated(kX64Idiv));
+  EXPECT_FALSE(CanBeSpeculated(kX64Idiv32));
+  EXPECT_FALSE(CanBeSpeculated(kX64Udiv));
+  EXPECT_FALSE(CanBeSpeculated(kX64Udiv32));
+}
+
+
+TEST_F(InstructionSchedulerX64Test, DoesNotSpeculateMemoryAccesses) {
+  EXPECT_FALSE(CanBeSpeculated(kX64Movq));
+  EXPECT_FALSE(CanBeSpeculated(kX64Movl | AddressingModeField::encode(
+                                             kMode_MR)));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -1334,6 +1334,31 @@ TEST_F(InstructionSelectorTest, Word32Clz) {
   EXPECT_EQ(s.ToVreg(n), s.ToVreg(s[0]->Output()));
 }
 
+
+TEST_F(InstructionSelectorTest, SchedulingHoistsFromFallthroughBlock) {
+  bool const instruction_scheduling = FLAG_turbo_instruction_scheduling;
+  FLAG_turbo_instruction_scheduling = true;
+  StreamBuilder m(this, MachineType::Int32(), MachineType::Int32(),
+                  MachineType::Int32(), MachineType::Int32());
+  Node* const p0 = m.Parameter(0);
+  Node* const p1 = m.Parameter(1);
+  Node* const p2 = m.Parameter(2);
+  RawMachineLabel a, b;
+  m.Branch(p0, &a, &b);
+  m.Bind(&a);
+  m.Return(m.Word32Xor(p1, p2));
+  m.Bind(&b);
+  m.Return(m.Word32Xor(p2, p1));
+  Stream s = m.Build();
+  FLAG_turbo_instruction_scheduling = instruction_scheduling;
+  // Only the xor of the fallthrough block is moved above the branch.
+  ASSERT_EQ(3U, s.size());
+  EXPECT_EQ(kX64Xor32, s[0]->arch_opcode());
+  EXPECT_EQ(kFlags_none, s[0]->flags_mode());
+  EXPECT_EQ(kFlags_branch, s[1]->flags_mode());
+  EXPECT_EQ(kX64Xor32, s[2]->arch_opcode());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -21,6 +21,9 @@ class BytecodeArrayBuilderTest : public TestWithIsolateAndZone {
 
 
 TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
+  // Register loads are only generated by fusing loads with a Star.
+  bool old_flag_ignition_superinstructions = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = true;
   BytecodeArrayBuilder builder(isolate(), zone(), 0, 1, 131);
 
   CHECK_EQ(builder.locals_count(), 131);
@@ -76,6 +79,18 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
       .StoreNamedProperty(reg, name, 0, LanguageMode::STRICT)
       .StoreKeyedProperty(reg, reg, 0, LanguageMode::STRICT);
 
+  // Emit loads into registers.
+  builder.LoadUndefined()
+      .StoreAccumulatorInRegister(reg)
+      .LoadGlobal(name, 1, TypeofMode::NOT_INSIDE_TYPEOF)
+      .StoreAccumulatorInRegister(other)
+      .LoadContextSlot(reg, 1)
+      .StoreAccumulatorInRegister(wide)
+      .LoadNamedProperty(reg, name, 0)
+      .StoreAccumulatorInRegister(other)
+      .LoadKeyedProperty(reg, 0)
+      .StoreAccumulatorInRegister(other);
+
   // Emit load / store lookup slots.
   builder.LoadLookupSlot(name, TypeofMode::NOT_INSIDE_TYPEOF)
       .LoadLookupSlot(name, TypeofMode::INSIDE_TYPEOF)
@@ -210,6 +225,9 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   // Emit stack check bytecode.
   builder.StackCheck(0);
 
+  // Emit an OSR poll bytecode.
+  builder.OsrPoll(1);
+
   // Emit throw and re-throw in it's own basic block so that the rest of the
   // code isn't omitted due to being dead.
   BytecodeLabel after_throw;
@@ -307,6 +325,7 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   Handle<BytecodeArray> the_array = builder.ToBytecodeArray();
   CHECK_EQ(the_array->frame_size(),
            builder.fixed_and_temporary_register_count() * kPointerSize);
+  FLAG_ignition_superinstructions = old_flag_ignition_superinstructions;
 
   // Build scorecard of bytecodes encountered in the BytecodeArray.
   std::vector<int> scorecard(Bytecodes::ToByte(Bytecode::kLast) + 1);
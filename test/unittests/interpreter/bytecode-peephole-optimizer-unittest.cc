@@ -0,0 +1,248 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/factory.h"
+#include "src/interpreter/bytecode-peephole-optimizer.h"
+#include "src/interpreter/constant-array-builder.h"
+#include "src/objects-inl.h"
+#include "src/objects.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+class BytecodePeepholeOptimizerTest : public BytecodePipelineStage,
+                                      public TestWithIsolateAndZone {
+ public:
+  BytecodePeepholeOptimizerTest()
+      : constant_array_builder_(isolate(), zone()),
+        peephole_optimizer_(&constant_array_builder_, this),
+        written_(zone()) {}
+  ~BytecodePeepholeOptimizerTest() override {}
+
+  // BytecodePipelineStage interface.
+  void Write(BytecodeNode* node) override { written_.push_back(*node); }
+  size_t FlushForOffset() override { return written_.size(); }
+  void FlushBasicBlock() override {}
+
+  ConstantArrayBuilder* constant_array() { return &constant_array_builder_; }
+  BytecodePeepholeOptimizer* optimizer() { return &peephole_optimizer_; }
+
+  const ZoneVector<BytecodeNode>& written() const { return written_; }
+
+ private:
+  ConstantArrayBuilder constant_array_builder_;
+  BytecodePeepholeOptimizer peephole_optimizer_;
+  ZoneVector<BytecodeNode> written_;
+};
+
+TEST_F(BytecodePeepholeOptimizerTest, LdarAfterStarIsElided) {
+  Register reg(0);
+  BytecodeNode star(Bytecode::kStar, reg.ToOperand(), OperandScale::kSingle);
+  BytecodeNode ldar(Bytecode::kLdar, reg.ToOperand(), OperandScale::kSingle);
+  optimizer()->Write(&star);
+  optimizer()->Write(&ldar);
+  CHECK_EQ(written().size(), 1u);
+  CHECK_EQ(written()[0], star);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, StarAfterLdarOfOtherRegisterIsKept) {
+  Register first(0);
+  Register second(1);
+  BytecodeNode ldar(Bytecode::kLdar, first.ToOperand(), OperandScale::kSingle);
+  BytecodeNode star(Bytecode::kStar, second.ToOperand(),
+                    OperandScale::kSingle);
+  optimizer()->Write(&ldar);
+  optimizer()->Write(&star);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[1], star);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, NoElisionAcrossBasicBlocks) {
+  Register reg(0);
+  BytecodeNode star(Bytecode::kStar, reg.ToOperand(), OperandScale::kSingle);
+  BytecodeNode ldar(Bytecode::kLdar, reg.ToOperand(), OperandScale::kSingle);
+  optimizer()->Write(&star);
+  optimizer()->FlushBasicBlock();
+  optimizer()->Write(&ldar);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[1], ldar);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, ElisionAfterFlushForOffset) {
+  Register reg(0);
+  BytecodeNode star(Bytecode::kStar, reg.ToOperand(), OperandScale::kSingle);
+  BytecodeNode ldar(Bytecode::kLdar, reg.ToOperand(), OperandScale::kSingle);
+  optimizer()->Write(&star);
+  CHECK_EQ(optimizer()->FlushForOffset(), 1u);
+  optimizer()->Write(&ldar);
+  CHECK_EQ(written().size(), 1u);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, ToNameAfterNameConstantIsElided) {
+  Handle<String> name = isolate()->factory()->NewStringFromStaticChars("a");
+  size_t index = constant_array()->Insert(name);
+  BytecodeNode load(Bytecode::kLdaConstant, static_cast<uint32_t>(index),
+                    OperandScale::kSingle);
+  BytecodeNode to_name(Bytecode::kToName);
+  optimizer()->Write(&load);
+  optimizer()->Write(&to_name);
+  CHECK_EQ(written().size(), 1u);
+  CHECK_EQ(written()[0], load);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, ToNameAfterNumberConstantIsKept) {
+  Handle<Object> number = isolate()->factory()->NewNumber(3.14);
+  size_t index = constant_array()->Insert(number);
+  BytecodeNode load(Bytecode::kLdaConstant, static_cast<uint32_t>(index),
+                    OperandScale::kSingle);
+  BytecodeNode to_name(Bytecode::kToName);
+  optimizer()->Write(&load);
+  optimizer()->Write(&to_name);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[1], to_name);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, JumpAfterTestDropsToBoolean) {
+  Register reg(0);
+  BytecodeNode test(Bytecode::kTestEqual, reg.ToOperand(),
+                    OperandScale::kSingle);
+  BytecodeNode jump(Bytecode::kJumpIfToBooleanTrue, 0, OperandScale::kSingle);
+  optimizer()->Write(&test);
+  optimizer()->Write(&jump);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[1].bytecode(), Bytecode::kJumpIfTrue);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, JumpAfterLoadKeepsToBoolean) {
+  Register reg(0);
+  BytecodeNode ldar(Bytecode::kLdar, reg.ToOperand(), OperandScale::kSingle);
+  BytecodeNode jump(Bytecode::kJumpIfToBooleanFalse, 0,
+                    OperandScale::kSingle);
+  optimizer()->Write(&ldar);
+  optimizer()->Write(&jump);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[1].bytecode(), Bytecode::kJumpIfToBooleanFalse);
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, ElidedSourcePositionMovesToNext) {
+  Register reg(0);
+  BytecodeNode star(Bytecode::kStar, reg.ToOperand(), OperandScale::kSingle);
+  BytecodeNode ldar(Bytecode::kLdar, reg.ToOperand(), OperandScale::kSingle);
+  ldar.source_info().Update({3, true});
+  BytecodeNode add(Bytecode::kAdd, reg.ToOperand(), OperandScale::kSingle);
+  add.source_info().Update({7, false});
+  optimizer()->Write(&star);
+  optimizer()->Write(&ldar);
+  optimizer()->Write(&add);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[1].bytecode(), Bytecode::kAdd);
+  CHECK(written()[1].source_info().is_statement());
+  CHECK_EQ(written()[1].source_info().source_position(), 3);
+}
+
+class BytecodePeepholeOptimizerSuperinstructionsTest
+    : public BytecodePeepholeOptimizerTest {
+ public:
+  BytecodePeepholeOptimizerSuperinstructionsTest()
+      : old_flag_(FLAG_ignition_superinstructions) {
+    FLAG_ignition_superinstructions = true;
+  }
+  ~BytecodePeepholeOptimizerSuperinstructionsTest() override {
+    FLAG_ignition_superinstructions = old_flag_;
+  }
+
+ private:
+  bool old_flag_;
+};
+
+TEST_F(BytecodePeepholeOptimizerSuperinstructionsTest, LoadAndStarAreFused) {
+  Register object(0);
+  Register target(1);
+  BytecodeNode load(Bytecode::kLoadIC, object.ToOperand(), 3, 4,
+                    OperandScale::kSingle);
+  load.source_info().Update({11, false});
+  BytecodeNode star(Bytecode::kStar, target.ToOperand(),
+                    OperandScale::kSingle);
+  optimizer()->Write(&load);
+  CHECK_EQ(written().size(), 0u);
+  optimizer()->Write(&star);
+  CHECK_EQ(written().size(), 1u);
+  CHECK_EQ(written()[0].bytecode(), Bytecode::kLdrNamedProperty);
+  CHECK_EQ(written()[0].operand(0), static_cast<uint32_t>(object.ToOperand()));
+  CHECK_EQ(written()[0].operand(1), 3u);
+  CHECK_EQ(written()[0].operand(2), 4u);
+  CHECK_EQ(written()[0].operand(3), static_cast<uint32_t>(target.ToOperand()));
+  CHECK_EQ(written()[0].source_info().source_position(), 11);
+
+  // The accumulator is reloaded from the register when it is read.
+  BytecodeNode ret(Bytecode::kReturn);
+  optimizer()->Write(&ret);
+  CHECK_EQ(written().size(), 3u);
+  CHECK_EQ(written()[1].bytecode(), Bytecode::kLdar);
+  CHECK_EQ(written()[1].operand(0), static_cast<uint32_t>(target.ToOperand()));
+  CHECK_EQ(written()[2], ret);
+}
+
+TEST_F(BytecodePeepholeOptimizerSuperinstructionsTest, DeadReloadIsElided) {
+  Register target(0);
+  BytecodeNode load(Bytecode::kLdaUndefined);
+  BytecodeNode star(Bytecode::kStar, target.ToOperand(),
+                    OperandScale::kSingle);
+  BytecodeNode ldar(Bytecode::kLdar, target.ToOperand(), OperandScale::kSingle);
+  BytecodeNode zero(Bytecode::kLdaZero);
+  optimizer()->Write(&load);
+  optimizer()->Write(&star);
+  optimizer()->Write(&ldar);
+  optimizer()->Write(&star);
+  optimizer()->Write(&zero);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[0].bytecode(), Bytecode::kLdrUndefined);
+  CHECK_EQ(written()[1], zero);
+}
+
+TEST_F(BytecodePeepholeOptimizerSuperinstructionsTest, WideRegisterWidensLoad) {
+  Register target(1000);
+  BytecodeNode load(Bytecode::kLdaGlobal, 1, 2, OperandScale::kSingle);
+  BytecodeNode star(Bytecode::kStar, target.ToOperand(),
+                    OperandScale::kDouble);
+  optimizer()->Write(&load);
+  optimizer()->Write(&star);
+  optimizer()->FlushBasicBlock();
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[0].bytecode(), Bytecode::kLdrGlobal);
+  CHECK_EQ(written()[0].operand_scale(), OperandScale::kDouble);
+  CHECK_EQ(written()[1].bytecode(), Bytecode::kLdar);
+}
+
+TEST_F(BytecodePeepholeOptimizerSuperinstructionsTest,
+       StarWithSourcePositionIsNotFused) {
+  Register target(0);
+  BytecodeNode load(Bytecode::kLdaGlobal, 1, 2, OperandScale::kSingle);
+  BytecodeNode star(Bytecode::kStar, target.ToOperand(),
+                    OperandScale::kSingle);
+  star.source_info().Update({5, true});
+  optimizer()->Write(&load);
+  optimizer()->Write(&star);
+  CHECK_EQ(written().size(), 2u);
+  CHECK_EQ(written()[0], load);
+  CHECK_EQ(written()[1], star);
+}
+
+TEST_F(BytecodePeepholeOptimizerSuperinstructionsTest,
+       FlushForOffsetWritesDeferredLoad) {
+  Register target(0);
+  BytecodeNode load(Bytecode::kLdaContextSlot, target.ToOperand(), 2,
+                    OperandScale::kSingle);
+  optimizer()->Write(&load);
+  CHECK_EQ(optimizer()->FlushForOffset(), 1u);
+  CHECK_EQ(written()[0], load);
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
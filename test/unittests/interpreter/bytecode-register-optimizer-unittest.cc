@@ -0,0 +1,157 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/interpreter/bytecode-register-optimizer.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+class BytecodeRegisterOptimizerTest : public BytecodePipelineStage,
+                                      public TestWithIsolateAndZone {
+ public:
+  BytecodeRegisterOptimizerTest()
+      : register_optimizer_(zone(), this), written_(zone()) {}
+  ~BytecodeRegisterOptimizerTest() override {}
+
+  // BytecodePipelineStage interface.
+  void Write(BytecodeNode* node) override { written_.push_back(*node); }
+  size_t FlushForOffset() override { return written_.size(); }
+  void FlushBasicBlock() override {}
+
+  BytecodeRegisterOptimizer* optimizer() { return &register_optimizer_; }
+
+  const ZoneVector<BytecodeNode>& written() const { return written_; }
+
+  void Emit(Bytecode bytecode) {
+    BytecodeNode node(bytecode);
+    optimizer()->Write(&node);
+  }
+
+  void Emit(Bytecode bytecode, Register reg) {
+    BytecodeNode node(bytecode, reg.ToOperand(), OperandScale::kSingle);
+    optimizer()->Write(&node);
+  }
+
+  void Emit(Bytecode bytecode, Register reg0, Register reg1) {
+    BytecodeNode node(bytecode, reg0.ToOperand(), reg1.ToOperand(),
+                      OperandScale::kSingle);
+    optimizer()->Write(&node);
+  }
+
+  void CheckWritten(size_t index, Bytecode bytecode) {
+    CHECK_LT(index, written().size());
+    CHECK_EQ(written()[index].bytecode(), bytecode);
+  }
+
+  void CheckWritten(size_t index, Bytecode bytecode, Register reg) {
+    CheckWritten(index, bytecode);
+    CHECK_EQ(written()[index].operand(0),
+             static_cast<uint32_t>(reg.ToOperand()));
+  }
+
+ private:
+  BytecodeRegisterOptimizer register_optimizer_;
+  ZoneVector<BytecodeNode> written_;
+};
+
+TEST_F(BytecodeRegisterOptimizerTest, DeadLdarIsDropped) {
+  Emit(Bytecode::kLdar, Register(0));
+  Emit(Bytecode::kLdaZero);
+  Emit(Bytecode::kReturn);
+  CHECK_EQ(written().size(), 2u);
+  CheckWritten(0, Bytecode::kLdaZero);
+  CheckWritten(1, Bytecode::kReturn);
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, LdarIsMaterializedForReads) {
+  Emit(Bytecode::kLdar, Register(0));
+  Emit(Bytecode::kAdd, Register(1));
+  CHECK_EQ(written().size(), 2u);
+  CheckWritten(0, Bytecode::kLdar, Register(0));
+  CheckWritten(1, Bytecode::kAdd, Register(1));
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, StarOfDeferredLdarBecomesMov) {
+  Emit(Bytecode::kLdar, Register(0));
+  Emit(Bytecode::kStar, Register(1));
+  CHECK_EQ(written().size(), 1u);
+  CheckWritten(0, Bytecode::kMov, Register(0));
+  CHECK_EQ(written()[0].operand(1),
+           static_cast<uint32_t>(Register(1).ToOperand()));
+
+  // The accumulator, r0 and r1 are all equivalent now.
+  Emit(Bytecode::kLdar, Register(1));
+  Emit(Bytecode::kStar, Register(0));
+  Emit(Bytecode::kMov, Register(1), Register(0));
+  CHECK_EQ(written().size(), 1u);
+
+  Emit(Bytecode::kReturn);
+  CHECK_EQ(written().size(), 3u);
+  CheckWritten(1, Bytecode::kLdar, Register(0));
+  CheckWritten(2, Bytecode::kReturn);
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, StarToEquivalentRegisterIsElided) {
+  Emit(Bytecode::kLdaZero);
+  Emit(Bytecode::kStar, Register(0));
+  Emit(Bytecode::kMov, Register(0), Register(1));
+  Emit(Bytecode::kStar, Register(1));
+  Emit(Bytecode::kLdar, Register(0));
+  CHECK_EQ(written().size(), 3u);
+  CheckWritten(0, Bytecode::kLdaZero);
+  CheckWritten(1, Bytecode::kStar, Register(0));
+  CheckWritten(2, Bytecode::kMov, Register(0));
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, OverwrittenSourceIsMaterialized) {
+  Emit(Bytecode::kLdar, Register(0));
+  Emit(Bytecode::kMov, Register(1), Register(0));
+  CHECK_EQ(written().size(), 2u);
+  CheckWritten(0, Bytecode::kLdar, Register(0));
+  CheckWritten(1, Bytecode::kMov, Register(1));
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, OutputOperandsBreakEquivalence) {
+  Emit(Bytecode::kLdaZero);
+  Emit(Bytecode::kStar, Register(0));
+  BytecodeNode for_in_prepare(Bytecode::kForInPrepare, Register(0).ToOperand(),
+                              OperandScale::kSingle);
+  optimizer()->Write(&for_in_prepare);
+  Emit(Bytecode::kStar, Register(2));
+  CHECK_EQ(written().size(), 4u);
+  CheckWritten(3, Bytecode::kStar, Register(2));
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, FlushMaterializesAccumulator) {
+  Emit(Bytecode::kLdar, Register(0));
+  CHECK_EQ(optimizer()->FlushForOffset(), 1u);
+  CheckWritten(0, Bytecode::kLdar, Register(0));
+
+  // Equivalences do not survive the end of a basic block.
+  optimizer()->FlushBasicBlock();
+  Emit(Bytecode::kLdar, Register(0));
+  Emit(Bytecode::kReturn);
+  CHECK_EQ(written().size(), 3u);
+  CheckWritten(1, Bytecode::kLdar, Register(0));
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, ElidedSourcePositionMovesToNext) {
+  BytecodeNode ldar(Bytecode::kLdar, Register(0).ToOperand(),
+                    OperandScale::kSingle);
+  ldar.source_info().Update({5, true});
+  optimizer()->Write(&ldar);
+  Emit(Bytecode::kLdaZero);
+  CHECK_EQ(written().size(), 1u);
+  CheckWritten(0, Bytecode::kLdaZero);
+  CHECK(written()[0].source_info().is_statement());
+  CHECK_EQ(written()[0].source_info().source_position(), 5);
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
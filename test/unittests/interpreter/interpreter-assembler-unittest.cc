@@ -344,6 +344,38 @@ TARGET_TEST_F(InterpreterAssemblerTest, Dispatch) {
   }
 }
 
+TARGET_TEST_F(InterpreterAssemblerTest, ThreadedDispatch) {
+  TRACED_FOREACH(interpreter::Bytecode, bytecode, kBytecodes) {
+    InterpreterAssemblerForTest m(this, bytecode, OperandScale::kSingle,
+                                  DispatchMode::kThreaded);
+    Node* tail_call_node = m.Dispatch();
+
+    OperandScale operand_scale = OperandScale::kSingle;
+    Matcher<Node*> next_bytecode_offset_matcher = IsIntPtrAdd(
+        IsParameter(InterpreterDispatchDescriptor::kBytecodeOffsetParameter),
+        IsIntPtrConstant(
+            interpreter::Bytecodes::Size(bytecode, operand_scale)));
+    Matcher<Node*> target_handler_matcher = m.IsLoad(
+        MachineType::AnyTagged(),
+        IsParameter(InterpreterDispatchDescriptor::kDispatchTableParameter),
+        IsWordShl(next_bytecode_offset_matcher,
+                  IsIntPtrConstant(kPointerSizeLog2)));
+    Matcher<Node*> code_target_matcher =
+        IsIntPtrAdd(target_handler_matcher,
+                    IsIntPtrConstant(Code::kHeaderSize - kHeapObjectTag));
+
+    EXPECT_THAT(
+        tail_call_node,
+        IsTailCall(
+            _, code_target_matcher,
+            IsParameter(InterpreterDispatchDescriptor::kAccumulatorParameter),
+            next_bytecode_offset_matcher,
+            IsParameter(InterpreterDispatchDescriptor::kBytecodeArrayParameter),
+            IsParameter(InterpreterDispatchDescriptor::kDispatchTableParameter),
+            _, _));
+  }
+}
+
 TARGET_TEST_F(InterpreterAssemblerTest, Jump) {
   // If debug code is enabled we emit extra code in Jump.
   if (FLAG_debug_code) return;
@@ -25,9 +25,10 @@ class InterpreterAssemblerTest : public TestWithIsolateAndZone {
    public:
     InterpreterAssemblerForTest(
         InterpreterAssemblerTest* test, Bytecode bytecode,
-        OperandScale operand_scale = OperandScale::kSingle)
+        OperandScale operand_scale = OperandScale::kSingle,
+        DispatchMode dispatch_mode = DispatchMode::kTable)
         : InterpreterAssembler(test->isolate(), test->zone(), bytecode,
-                               operand_scale) {}
+                               operand_scale, dispatch_mode) {}
     ~InterpreterAssemblerForTest() override;
 
     Matcher<compiler::Node*> IsLoad(
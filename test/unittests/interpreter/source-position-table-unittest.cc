@@ -79,6 +79,16 @@ TEST_F(SourcePositionTableTest, EncodeAscending) {
   CHECK(!builder.ToSourcePositionTable().is_null());
 }
 
+TEST_F(SourcePositionTableTest, OmitSourcePositions) {
+  SourcePositionTableBuilder builder(
+      isolate(), zone(), SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS);
+  CHECK(builder.Omit());
+  for (int i = 0; i < arraysize(offsets); i++) {
+    builder.AddStatementPosition(offsets[i], offsets[i]);
+  }
+  CHECK_EQ(builder.ToSourcePositionTable()->length(), 0);
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,127 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "src/parsing/character-runs.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+std::vector<uint16_t> ToCodeUnits(const char* chars) {
+  std::vector<uint16_t> code_units;
+  for (const char* c = chars; *c != '\0'; c++) {
+    code_units.push_back(static_cast<uint8_t>(*c));
+  }
+  return code_units;
+}
+
+// Returns the length of |run| in |code_units| with a prefix of |padding| code
+// units that are part of the run, so that the end is found both by the
+// vectorized and the scalar loop.
+template <typename Char>
+size_t RunLengthAfter(CharacterRun run, uint16_t padding_char, size_t padding,
+                      const std::vector<uint16_t>& code_units) {
+  std::vector<Char> chars(padding, static_cast<Char>(padding_char));
+  for (uint16_t code_unit : code_units) {
+    chars.push_back(static_cast<Char>(code_unit));
+  }
+  return CharacterRunLength(run, chars.data(), chars.size()) - padding;
+}
+
+// Checks the run length for both one-byte and UTF-16 code units.
+void ExpectRunLength(size_t expected, CharacterRun run, uint16_t padding_char,
+                     size_t padding, const std::vector<uint16_t>& code_units) {
+  EXPECT_EQ(expected,
+            RunLengthAfter<uint8_t>(run, padding_char, padding, code_units));
+  EXPECT_EQ(expected,
+            RunLengthAfter<uint16_t>(run, padding_char, padding, code_units));
+}
+
+}  // namespace
+
+TEST(CharacterRunsTest, WhiteSpace) {
+  for (size_t padding = 0; padding < 40; padding++) {
+    ExpectRunLength(0u, CharacterRun::kWhiteSpace, ' ', padding,
+                    ToCodeUnits("x"));
+    ExpectRunLength(3u, CharacterRun::kWhiteSpace, ' ', padding,
+                    ToCodeUnits(" \t x"));
+    ExpectRunLength(2u, CharacterRun::kWhiteSpace, '\t', padding,
+                    ToCodeUnits("  \n"));
+    ExpectRunLength(2u, CharacterRun::kWhiteSpace, ' ', padding,
+                    ToCodeUnits("  "));
+  }
+}
+
+TEST(CharacterRunsTest, SingleLineComment) {
+  for (size_t padding = 0; padding < 40; padding++) {
+    ExpectRunLength(5u, CharacterRun::kSingleLineComment, 'a', padding,
+                    ToCodeUnits("x*/ y\n"));
+    ExpectRunLength(1u, CharacterRun::kSingleLineComment, 'a', padding,
+                    ToCodeUnits("x\r"));
+    std::vector<uint16_t> one_byte = {0xFF, 0x80, 0x85, 0xA0, '\n'};
+    ExpectRunLength(4u, CharacterRun::kSingleLineComment, 'a', padding,
+                    one_byte);
+    std::vector<uint16_t> separators = {'x', 0x2027, 0x2029, 0x2028};
+    EXPECT_EQ(2u, RunLengthAfter<uint16_t>(CharacterRun::kSingleLineComment,
+                                           'a', padding, separators));
+    std::vector<uint16_t> non_ascii = {0xFFFF, 0x8000, 0xD800, 0x2028};
+    EXPECT_EQ(3u, RunLengthAfter<uint16_t>(CharacterRun::kSingleLineComment,
+                                           'a', padding, non_ascii));
+  }
+}
+
+TEST(CharacterRunsTest, MultiLineComment) {
+  for (size_t padding = 0; padding < 40; padding++) {
+    ExpectRunLength(3u, CharacterRun::kMultiLineComment, ' ', padding,
+                    ToCodeUnits("ab/*/"));
+    ExpectRunLength(2u, CharacterRun::kMultiLineComment, ' ', padding,
+                    ToCodeUnits("ab\n*/"));
+    ExpectRunLength(4u, CharacterRun::kMultiLineComment, ' ', padding,
+                    ToCodeUnits("abcd"));
+  }
+}
+
+TEST(CharacterRunsTest, AsciiIdentifierPart) {
+  for (size_t padding = 0; padding < 40; padding++) {
+    ExpectRunLength(10u, CharacterRun::kAsciiIdentifierPart, 'a', padding,
+                    ToCodeUnits("azAZ09_$xy.z"));
+    ExpectRunLength(0u, CharacterRun::kAsciiIdentifierPart, 'a', padding,
+                    ToCodeUnits("@"));
+    ExpectRunLength(0u, CharacterRun::kAsciiIdentifierPart, 'a', padding,
+                    ToCodeUnits("["));
+    ExpectRunLength(0u, CharacterRun::kAsciiIdentifierPart, 'a', padding,
+                    ToCodeUnits("`"));
+    ExpectRunLength(0u, CharacterRun::kAsciiIdentifierPart, 'a', padding,
+                    ToCodeUnits("{"));
+    std::vector<uint16_t> one_byte = {'a', 0xE1, 'b'};
+    ExpectRunLength(1u, CharacterRun::kAsciiIdentifierPart, 'a', padding,
+                    one_byte);
+    std::vector<uint16_t> non_ascii = {'a', 0x8061};
+    EXPECT_EQ(1u, RunLengthAfter<uint16_t>(CharacterRun::kAsciiIdentifierPart,
+                                           'a', padding, non_ascii));
+  }
+}
+
+TEST(CharacterRunsTest, StringLiteral) {
+  for (size_t padding = 0; padding < 40; padding++) {
+    ExpectRunLength(4u, CharacterRun::kDoubleQuotedString, 'a', padding,
+                    ToCodeUnits("a'b \""));
+    ExpectRunLength(1u, CharacterRun::kDoubleQuotedString, 'a', padding,
+                    ToCodeUnits("a\\\""));
+    ExpectRunLength(0u, CharacterRun::kDoubleQuotedString, 'a', padding,
+                    ToCodeUnits("\n"));
+    std::vector<uint16_t> non_ascii = {'a', 0x7F, 0x80};
+    ExpectRunLength(2u, CharacterRun::kDoubleQuotedString, 'a', padding,
+                    non_ascii);
+    ExpectRunLength(3u, CharacterRun::kSingleQuotedString, 'a', padding,
+                    ToCodeUnits("a\"b'"));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,50 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "src/parsing/keyword-table.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+int Lookup(const char* word) {
+  return KeywordTable::Lookup(reinterpret_cast<const uint8_t*>(word),
+                              static_cast<int>(strlen(word)));
+}
+
+}  // namespace
+
+TEST(KeywordTableTest, FindsEveryWord) {
+  for (int i = 0; i < KeywordTable::kWordCount; i++) {
+    Vector<const uint8_t> word = KeywordTable::word(i);
+    EXPECT_EQ(i, KeywordTable::Lookup(word.start(), word.length()));
+  }
+}
+
+TEST(KeywordTableTest, Tokens) {
+  EXPECT_EQ(Token::FUNCTION, KeywordTable::token(Lookup("function")));
+  EXPECT_EQ(Token::YIELD, KeywordTable::token(Lookup("yield")));
+  EXPECT_EQ(Token::TRUE_LITERAL, KeywordTable::token(Lookup("true")));
+  EXPECT_EQ(Token::FUTURE_STRICT_RESERVED_WORD,
+            KeywordTable::token(Lookup("implements")));
+  EXPECT_EQ(Token::IDENTIFIER, KeywordTable::token(Lookup("length")));
+  EXPECT_EQ(Token::IDENTIFIER, KeywordTable::token(Lookup("prototype")));
+  EXPECT_EQ(Token::IDENTIFIER, KeywordTable::token(Lookup("hasOwnProperty")));
+}
+
+TEST(KeywordTableTest, RejectsOtherWords) {
+  const char* others[] = {"a",      "x",      "fo",      "functio",
+                          "yields", "lenght", "lengthy", "Function",
+                          "THIS",   "await_", "_",       "hasOwnPropertyX"};
+  for (const char* other : others) {
+    EXPECT_EQ(KeywordTable::kNotFound, Lookup(other)) << other;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
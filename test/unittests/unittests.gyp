@@ -24,6 +24,7 @@
       ],
       'sources': [  ### gcmole(all) ###
         'atomic-utils-unittest.cc',
+        'base/accounting-allocator-unittest.cc',
         'base/bits-unittest.cc',
         'base/cpu-unittest.cc',
         'base/division-by-constant-unittest.cc',
@@ -40,6 +41,8 @@
         'base/utils/random-number-generator-unittest.cc',
         'cancelable-tasks-unittest.cc',
         'char-predicates-unittest.cc',
+        'compiler/allocation-folding-unittest.cc',
+        'compiler/bounds-check-elimination-unittest.cc',
         'compiler/branch-elimination-unittest.cc',
         'compiler/change-lowering-unittest.cc',
         'compiler/coalesced-live-ranges-unittest.cc',
@@ -71,7 +74,9 @@
         'compiler/liveness-analyzer-unittest.cc',
         'compiler/live-range-unittest.cc',
         'compiler/load-elimination-unittest.cc',
+        'compiler/loop-invariant-code-motion-unittest.cc',
         'compiler/loop-peeling-unittest.cc',
+        'compiler/loop-vectorizer-unittest.cc',
         'compiler/machine-operator-reducer-unittest.cc',
         'compiler/machine-operator-unittest.cc',
         'compiler/move-optimizer-unittest.cc',
@@ -97,6 +102,8 @@
         'interpreter/bytecodes-unittest.cc',
         'interpreter/bytecode-array-builder-unittest.cc',
         'interpreter/bytecode-array-iterator-unittest.cc',
+        'interpreter/bytecode-peephole-optimizer-unittest.cc',
+        'interpreter/bytecode-register-optimizer-unittest.cc',
         'interpreter/bytecode-register-allocator-unittest.cc',
         'interpreter/constant-array-builder-unittest.cc',
         'interpreter/interpreter-assembler-unittest.cc',
@@ -113,6 +120,8 @@
         'heap/scavenge-job-unittest.cc',
         'heap/slot-set-unittest.cc',
         'locked-queue-unittest.cc',
+        'parsing/character-runs-unittest.cc',
+        'parsing/keyword-table-unittest.cc',
         'run-all-unittests.cc',
         'test-utils.h',
         'test-utils.cc',
@@ -163,6 +172,7 @@
         }],
         ['v8_target_arch=="x64"', {
           'sources': [  ### gcmole(arch:x64) ###
+            'compiler/x64/instruction-scheduler-x64-unittest.cc',
             'compiler/x64/instruction-selector-x64-unittest.cc',
           ],
         }],
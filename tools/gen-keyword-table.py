@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+# Copyright 2016 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Finds the perfect hash of the parser's keyword table.
+
+Reads the words listed in src/parsing/keyword-table.cc, searches for hash
+multipliers under which no two words share a slot and prints the multipliers
+and the slot table to paste into keyword-table.h and keyword-table.cc.
+
+Usage: tools/gen-keyword-table.py [path/to/keyword-table.cc]
+"""
+
+from __future__ import print_function
+
+import os
+import random
+import re
+import sys
+
+SLOT_COUNT = 512
+MIN_LENGTH = 2
+MAX_LENGTH = 14
+EMPTY_SLOT = 0xFF
+MAX_ATTEMPTS = 1000000
+SLOTS_PER_LINE = 12
+
+
+def ReadWords(path):
+  with open(path) as f:
+    return re.findall(r'V\("([^"]+)", Token::\w+\)', f.read())
+
+
+def Hash(word, multipliers):
+  # Must match KeywordTable::Hash.
+  first, second, third, last = multipliers
+  chars = [ord(c) for c in word]
+  third_char = chars[2] if len(chars) > 2 else 0
+  value = (chars[0] * first + chars[1] * second + third_char * third +
+           chars[-1] * last + len(chars))
+  return value & 0xFFFFFFFF & (SLOT_COUNT - 1)
+
+
+def FindMultipliers(words):
+  rng = random.Random(0)
+  for _ in range(MAX_ATTEMPTS):
+    multipliers = [rng.randrange(1, 1 << 12) for _ in range(4)]
+    slots = set()
+    for word in words:
+      slot = Hash(word, multipliers)
+      if slot in slots: break
+      slots.add(slot)
+    else:
+      return multipliers
+  return None
+
+
+def Main():
+  root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+  path = (sys.argv[1] if len(sys.argv) > 1 else
+          os.path.join(root, 'src', 'parsing', 'keyword-table.cc'))
+  words = ReadWords(path)
+  if len(words) >= EMPTY_SLOT:
+    print('Too many words: %d' % len(words), file=sys.stderr)
+    return 1
+  for word in words:
+    if not MIN_LENGTH <= len(word) <= MAX_LENGTH:
+      print('Bad word length: %s' % word, file=sys.stderr)
+      return 1
+  multipliers = FindMultipliers(words)
+  if multipliers is None:
+    print('No perfect hash found, increase SLOT_COUNT', file=sys.stderr)
+    return 1
+
+  names = ['kFirstCharMultiplier', 'kSecondCharMultiplier',
+           'kThirdCharMultiplier', 'kLastCharMultiplier']
+  for name, value in zip(names, multipliers):
+    print('  static const uint32_t %s = %d;' % (name, value))
+  print()
+
+  slots = [EMPTY_SLOT] * SLOT_COUNT
+  for index, word in enumerate(words):
+    slots[Hash(word, multipliers)] = index
+  print('const uint8_t KeywordTable::kSlots[kSlotCount] = {')
+  for i in range(0, SLOT_COUNT, SLOTS_PER_LINE):
+    line = ', '.join('%3d' % s for s in slots[i:i + SLOTS_PER_LINE])
+    print('    %s,' % line)
+  print('};')
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(Main())
@@ -32,6 +32,15 @@ examples:
   # Print the hottest 15 bytecode dispatch pairs reading from data.json
   $ tools/ignition/bytecode_dispatches_report.py -t -n 15 data.json
 
+  # Print the hottest bytecodes dispatching to Star, which are candidates
+  # for fusing into register loads (see --ignition-superinstructions),
+  # and which of them are fused already
+  $ tools/ignition/bytecode_dispatches_report.py -f
+
+  # Compare the dispatches of two runs, e.g. without and with
+  # --ignition-reo, listing the bytecodes whose counts changed the most
+  $ tools/ignition/bytecode_dispatches_report.py -c before.json after.json
+
   # Save heatmap to default filename v8.ignition_dispatches_counters.svg
   $ tools/ignition/bytecode_dispatches_report.py -p
 
@@ -42,6 +51,17 @@ examples:
   $ tools/ignition/bytecode_dispatches_report.py -p -i
 """
 
+# Bytecodes which --ignition-superinstructions fuses with a following Star,
+# and their register load forms (cf. GetRegisterLoadForm in
+# src/interpreter/bytecode-peephole-optimizer.cc).
+__REGISTER_LOAD_FORMS = {
+  "LdaUndefined": "LdrUndefined",
+  "LdaGlobal": "LdrGlobal",
+  "LdaContextSlot": "LdrContextSlot",
+  "LoadIC": "LdrNamedProperty",
+  "KeyedLoadIC": "LdrKeyedProperty",
+}
+
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
 __COUNTER_MAX = 2**__COUNTER_BITS - 1
 
@@ -72,6 +92,40 @@ def print_top_bytecode_dispatch_pairs(dispatches_table, top_count):
     print "{:>12d}\t{} -> {}".format(counter, source, destination)
 
 
+# Only Star is a fusion target: a fused bytecode writes the register
+# operand of the Star instead of the accumulator, which is all the bytecode
+# graph builder can support after a lazy deopt.
+def find_top_fusion_candidates(dispatches_table, top_count):
+  total_count = sum(sum(counters_from_source.values())
+                    for counters_from_source in dispatches_table.values())
+  candidates = []
+  for source, counters_from_source in dispatches_table.items():
+    counter = counters_from_source.get("Star", 0)
+    if counter > 0:
+      candidates.append((source, counter, float(counter) / total_count,
+                         __REGISTER_LOAD_FORMS.get(source)))
+  return heapq.nlargest(top_count, candidates, key=lambda x: x[1])
+
+
+def find_fused_dispatches_ratio(dispatches_table):
+  total_count = sum(sum(counters_from_source.values())
+                    for counters_from_source in dispatches_table.values())
+  fused_count = sum(dispatches_table.get(source, {}).get("Star", 0)
+                    for source in __REGISTER_LOAD_FORMS)
+  return float(fused_count) / total_count if total_count else 0
+
+
+def print_top_fusion_candidates(dispatches_table, top_count):
+  top_fusion_candidates = find_top_fusion_candidates(dispatches_table,
+                                                     top_count)
+  print "Top {} bytecodes dispatching to Star:".format(top_count)
+  for source, counter, ratio, fused_form in top_fusion_candidates:
+    print "{:>12d}\t{:>6.2%}\t{} -> Star\t{}".format(
+      counter, ratio, source, fused_form or "(not fused)")
+  print "Dispatches saved by fusing: {:.2%}".format(
+    find_fused_dispatches_ratio(dispatches_table))
+
+
 def find_top_bytecodes(dispatches_table):
   top_bytecodes = []
   for bytecode, counters_from_bytecode in dispatches_table.items():
@@ -87,6 +141,32 @@ def print_top_bytecodes(dispatches_table):
     print "{:>12d}\t{}".format(counter, bytecode)
 
 
+def compare_bytecodes(baseline_table, dispatches_table):
+  baseline_counts = dict(find_top_bytecodes(baseline_table))
+  counts = dict(find_top_bytecodes(dispatches_table))
+  changes = []
+  for bytecode in set(baseline_counts) | set(counts):
+    baseline_count = baseline_counts.get(bytecode, 0)
+    count = counts.get(bytecode, 0)
+    if count != baseline_count:
+      changes.append((bytecode, baseline_count, count))
+  changes.sort(key=lambda x: (x[2] - x[1], x[0]))
+  return sum(baseline_counts.values()), sum(counts.values()), changes
+
+
+def print_bytecode_comparison(baseline_table, dispatches_table, top_count):
+  baseline_total, total, changes = compare_bytecodes(baseline_table,
+                                                     dispatches_table)
+  print "Total dispatches: {} -> {} ({:+.2%})".format(
+    baseline_total, total,
+    float(total - baseline_total) / baseline_total if baseline_total else 0)
+  print "Top {} changed bytecodes:".format(top_count)
+  changes.sort(key=lambda x: abs(x[2] - x[1]), reverse=True)
+  for bytecode, baseline_count, count in changes[:top_count]:
+    print "{:>12d}\t{:>12d}\t{:>+12d}\t{}".format(
+      baseline_count, count, count - baseline_count, bytecode)
+
+
 def build_counters_matrix(dispatches_table):
   labels = sorted(dispatches_table.keys())
 
@@ -166,12 +246,25 @@ def parse_command_line():
     action="store_true",
     help="print the top bytecode dispatch pairs"
   )
+  command_line_parser.add_argument(
+    "--top-fusion-candidates", "-f",
+    action="store_true",
+    help=("print the top bytecodes dispatching to Star, with their share of "
+          "all dispatches and their fused register load form, if any")
+  )
+  command_line_parser.add_argument(
+    "--compare-to", "-c",
+    metavar="<baseline filename>",
+    help=("compare the dispatch counts against those of a baseline run, "
+          "and print the bytecodes whose counts changed the most")
+  )
   command_line_parser.add_argument(
     "--top-bytecode-dispatch-pairs-number", "-n",
     metavar="N",
     type=int,
     default=10,
-    help="print N top bytecode dispatch pairs when running with -t (default 10)"
+    help=("print N top bytecode dispatch pairs when running with -t or -f, "
+          "or N top changed bytecodes with -c (default 10)")
   )
   command_line_parser.add_argument(
     "--output-filename", "-o",
@@ -212,6 +305,15 @@ def main():
   elif program_options.top_bytecode_dispatch_pairs:
     print_top_bytecode_dispatch_pairs(
       dispatches_table, program_options.top_bytecode_dispatch_pairs_number)
+  elif program_options.compare_to:
+    with open(program_options.compare_to) as stream:
+      baseline_table = json.load(stream)
+    print_bytecode_comparison(
+      baseline_table, dispatches_table,
+      program_options.top_bytecode_dispatch_pairs_number)
+  elif program_options.top_fusion_candidates:
+    print_top_fusion_candidates(
+      dispatches_table, program_options.top_bytecode_dispatch_pairs_number)
   else:
     print_top_bytecodes(dispatches_table)
 
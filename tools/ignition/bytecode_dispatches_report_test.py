@@ -19,6 +19,48 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ('a', 'b',  8),
       ('c', 'c',  7)])
 
+  def test_find_top_fusion_candidates(self):
+    top_candidates = bdr.find_top_fusion_candidates({
+      "LdaGlobal": {"Star": 30, "Return": 10},
+      "LoadIC": {"Star": 50},
+      "Star": {"LdaGlobal": 10},
+      "Ldar": {"Add": 100}}, 5)
+    self.assertListEqual(top_candidates, [
+      ('LoadIC', 50, 0.25, 'LdrNamedProperty'),
+      ('LdaGlobal', 30, 0.15, 'LdrGlobal')])
+
+  def test_find_top_fusion_candidates_not_fused(self):
+    top_candidates = bdr.find_top_fusion_candidates({
+      "Add": {"Star": 60},
+      "LdaUndefined": {"Star": 20, "Return": 20}}, 5)
+    self.assertListEqual(top_candidates, [
+      ('Add', 60, 0.6, None),
+      ('LdaUndefined', 20, 0.2, 'LdrUndefined')])
+
+  def test_find_fused_dispatches_ratio(self):
+    ratio = bdr.find_fused_dispatches_ratio({
+      "Add": {"Star": 60},
+      "LdaUndefined": {"Star": 20, "Return": 20},
+      "LoadIC": {"Star": 40},
+      "Star": {"LoadIC": 60}})
+    self.assertEqual(ratio, 0.3)
+
+  def test_compare_bytecodes(self):
+    baseline_total, total, changes = bdr.compare_bytecodes({
+      "Ldar": {"Star": 40, "Add": 20},
+      "Star": {"Ldar": 50},
+      "Add": {"Return": 10}}, {
+      "Ldar": {"Add": 20},
+      "Mov": {"Ldar": 10},
+      "Star": {"Ldar": 10},
+      "Add": {"Return": 10}})
+    self.assertEqual(baseline_total, 120)
+    self.assertEqual(total, 50)
+    self.assertListEqual(changes, [
+      ('Ldar', 60, 20),
+      ('Star', 50, 10),
+      ('Mov', 0, 10)])
+
   def test_build_counters_matrix(self):
     counters_matrix, xlabels, ylabels = bdr.build_counters_matrix({
       "a": {"a": 10, "b":  8, "c":  7},